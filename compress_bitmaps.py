@@ -0,0 +1,168 @@
+# Create src/ui/RAK14000_bitmaps.cpp from the images in assets/bitmaps
+#
+# The images are binary PBM files (P4), same layout as used by
+# Adafruit_GFX::drawBitmap(). Each image is compressed with PackBits,
+# the display decodes it while drawing with PartialEPD::draw_packed().
+#
+# Run from the project folder after changing an image:
+#   python compress_bitmaps.py
+#
+# Every image is decoded again after compression and compared with the
+# original, the file is not written if an image does not match.
+
+import os
+import sys
+
+BITMAP_DIR = os.path.join("assets", "bitmaps")
+TARGET = os.path.join("src", "ui", "RAK14000_bitmaps.cpp")
+
+# Images in the order they are written to the source file
+# The 32x32 icons stay uncompressed in RAK14000_graphics.cpp, they
+# have no long runs and do not get smaller
+IMAGES = [
+    "good_air",
+    "bad_air",
+    "worried_air",
+    "rak_img",
+    "built_img",
+    "wisblock_img",
+]
+
+# Names of the size variables, kept from the uncompressed images
+SIZE_NAMES = {
+    "good_air": ("good_air_width", "good_air_height", "good_air_len"),
+    "bad_air": ("bad_air_width", "bad_air_height", "bad_air_len"),
+    "worried_air": ("worried_air_width", "worried_air_height", "worried_air_len"),
+    "wisblock_img": ("wisblock_width", "wisblock_height", "wisblock_length"),
+}
+
+
+def read_pbm(file_name):
+    """Read a binary PBM file, returns width, height and pixel data"""
+    with open(file_name, mode="rb") as f:
+        data = f.read()
+
+    # Header: magic, width, height, each followed by one whitespace
+    fields = []
+    pos = 0
+    while len(fields) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos) + 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        fields.append(data[start:pos])
+    pos += 1
+
+    if fields[0] != b"P4":
+        raise ValueError(file_name + " is not a binary PBM file")
+    width = int(fields[1])
+    height = int(fields[2])
+    pixels = data[pos:pos + (width + 7) // 8 * height]
+    if len(pixels) != (width + 7) // 8 * height:
+        raise ValueError(file_name + " is too short")
+    return width, height, pixels
+
+
+def packbits(data):
+    """Compress with PackBits
+    Header n = 0..127: n + 1 bytes follow
+    Header n = 129..255: next byte is repeated 257 - n times"""
+    out = bytearray()
+    pos = 0
+    while pos < len(data):
+        # Length of the run starting at pos
+        run = 1
+        while pos + run < len(data) and run < 128 and data[pos + run] == data[pos]:
+            run += 1
+        if run > 2 or (run == 2 and pos + run == len(data)):
+            out.append(257 - run)
+            out.append(data[pos])
+            pos += run
+            continue
+
+        # Literal bytes up to the next run of 3 or more equal bytes,
+        # shorter runs are cheaper inside the literal bytes
+        start = pos
+        while pos < len(data) and pos - start < 128:
+            if data[pos:pos + 3] == bytes([data[pos]]) * 3:
+                break
+            pos += 1
+        out.append(pos - start - 1)
+        out.extend(data[start:pos])
+    return bytes(out)
+
+
+def unpackbits(data):
+    """Decode PackBits, same as PartialEPD::draw_packed()"""
+    out = bytearray()
+    pos = 0
+    while pos < len(data):
+        header = data[pos]
+        pos += 1
+        if header < 128:
+            out.extend(data[pos:pos + header + 1])
+            pos += header + 1
+        elif header > 128:
+            out.extend(bytes([data[pos]]) * (257 - header))
+            pos += 1
+    return bytes(out)
+
+
+def c_array(data):
+    """Format bytes as C array content"""
+    lines = []
+    for idx in range(0, len(data), 12):
+        lines.append("\t" + ", ".join("0x%02x" % b for b in data[idx:idx + 12]) + ",")
+    lines[-1] = lines[-1][:-1]
+    return "\n".join(lines)
+
+
+def main():
+    source = []
+    source.append("/**")
+    source.append(" * @file RAK14000_bitmaps.cpp")
+    source.append(" * @author Bernd Giesecke (bernd@giesecke.tk)")
+    source.append(" * @brief PackBits compressed images for the EPD display")
+    source.append(" *        Created by compress_bitmaps.py from assets/bitmaps, do not edit")
+    source.append(" * @version 0.1")
+    source.append(" * @date 2024-03-18")
+    source.append(" *")
+    source.append(" * @copyright Copyright (c) 2024")
+    source.append(" * Some images cortesy of <a href=\"https://www.flaticon.com/free-icons\" title=\"Freepik - Flaticon\">Icons created by Freepik - Flaticon</a>")
+    source.append(" */")
+    source.append("#include <stdint.h>")
+
+    raw_total = 0
+    packed_total = 0
+    for name in IMAGES:
+        width, height, pixels = read_pbm(os.path.join(BITMAP_DIR, name + ".pbm"))
+        packed = packbits(pixels)
+        if unpackbits(packed) != pixels:
+            print("Decoded " + name + " does not match the original")
+            sys.exit(1)
+
+        width_name, height_name, len_name = SIZE_NAMES.get(
+            name, (name + "_width", name + "_height", name + "_length"))
+        source.append("")
+        source.append("// %dx%d, %d bytes uncompressed" % (width, height, len(pixels)))
+        source.append("const uint8_t %s[] = {" % name)
+        source.append(c_array(packed) + "};")
+        source.append("uint16_t %s = %d;" % (width_name, width))
+        source.append("uint16_t %s = %d;" % (height_name, height))
+        source.append("uint16_t %s = %d;" % (len_name, len(packed)))
+
+        print("%-16s %5d -> %5d bytes" % (name, len(pixels), len(packed)))
+        raw_total += len(pixels)
+        packed_total += len(packed)
+
+    with open(TARGET, mode="w", newline="\n") as f:
+        f.write("\n".join(source) + "\n")
+    print("Total %d -> %d bytes, written to %s" % (raw_total, packed_total, TARGET))
+
+
+if __name__ == "__main__":
+    main()
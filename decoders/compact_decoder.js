@@ -0,0 +1,188 @@
+// Decoder for the compact payload format of the RAK10702 Indoor Comfort Node
+//
+// Compact packets are sent on fPort 3, batch packets on fPort 4, Cayenne LPP packets on fPort 2.
+// The field names are the same as the names of the Cayenne LPP decoder.
+//
+// Packet layout, bits are packed MSB first:
+// - 1 byte header, 2 bits version, 1 bit difference packet, 1 bit 0, 4 bits sequence number
+// - 1 byte sequence number of the reference packet, only in difference packets
+// - 2 bytes bitmap, bit n set if value n of FIELDS is included
+// - the included values
+//   absolute packet: value with the bits of FIELDS
+//   difference packet: 2 bits encoding, 0 = same as reference, 1 = 4 bits difference,
+//   2 = 8 bits difference, 3 = absolute value. Differences are zigzag coded.
+//
+// Difference packets need the values of the reference packet. The reference
+// is always a packet that was acknowledged by the server. A backend that
+// wants to use difference packets has to keep the decoded packets by their
+// sequence number and pass the reference to decodeCompact().
+// decodeUplink() has no memory, it returns only the sequence numbers for
+// difference packets.
+//
+// Batch packet layout:
+// - 1 byte header, 2 bits version, 2 bits 0, 4 bits number of readings
+// - per reading, oldest first: 16 bits seconds between the reading and sending
+//   the packet, 16 bits bitmap and the values as in an absolute packet
+
+// name, bits, signed, offset, scale, same order as compact_fields[] in compact_payload.cpp
+var FIELDS = [
+	["voltage_1", 9, false, 0, 0.01],
+	["humidity_2", 8, false, 0, 0.5],
+	["temperature_3", 11, true, 0, 0.1],
+	["barometer_4", 13, false, 3000, 0.1],
+	["illuminance_5", 16, false, 0, 1],
+	["humidity_6", 8, false, 0, 0.5],
+	["temperature_7", 11, true, 0, 0.1],
+	["barometer_8", 13, false, 3000, 0.1],
+	["illuminance_15", 16, false, 0, 1],
+	["voc_16", 9, false, 0, 1],
+	["concentration_35", 14, false, 0, 1],
+	["voc_40", 10, false, 0, 1],
+	["voc_41", 10, false, 0, 1],
+	["voc_42", 10, false, 0, 1],
+	["presence_48", 1, false, 0, 1],
+];
+
+var COMPACT_VERSION = 1;
+var COMPACT_FPORT = 3;
+var BATCH_FPORT = 4;
+
+function BitReader(bytes, pos) {
+	this.bytes = bytes;
+	this.pos = pos;
+	this.read = function (bits) {
+		var value = 0;
+		for (var bit = 0; bit < bits; bit++) {
+			var byte = this.bytes[this.pos >> 3];
+			if (byte === undefined) {
+				throw new Error("Packet too short");
+			}
+			value = value * 2 + ((byte >> (7 - (this.pos & 7))) & 1);
+			this.pos++;
+		}
+		return value;
+	};
+}
+
+function signExtend(value, bits) {
+	return value >= Math.pow(2, bits - 1) ? value - Math.pow(2, bits) : value;
+}
+
+// Read the values of the bitmap as absolute values
+function readValues(reader, bitmap, result) {
+	for (var idx = 0; idx < FIELDS.length; idx++) {
+		if ((bitmap & (1 << idx)) === 0) {
+			continue;
+		}
+		var field = FIELDS[idx];
+		var code = reader.read(field[1]);
+		if (field[2]) {
+			code = signExtend(code, field[1]);
+		}
+		result.codes[field[0]] = code;
+		result.data[field[0]] = Math.round((code + field[3]) * field[4] * 100) / 100;
+	}
+}
+
+// Decode a batch packet
+// Returns a list of {age, data}, age is the time in seconds between the reading and sending the packet
+function decodeBatch(bytes) {
+	if ((bytes[0] >> 6) !== COMPACT_VERSION) {
+		throw new Error("Unknown version " + (bytes[0] >> 6));
+	}
+	var readings = [];
+	var reader = new BitReader(bytes, 8);
+	for (var num = 0; num < (bytes[0] & 0x0F); num++) {
+		var reading = { age: reader.read(16), codes: {}, data: {} };
+		readValues(reader, reader.read(16), reading);
+		readings.push({ age: reading.age, data: reading.data });
+	}
+	return readings;
+}
+
+// Decode a compact packet
+// reference: result of decodeCompact() for the reference packet, only needed for difference packets
+// Returns {seq, ref_seq, delta, codes, data}, codes are the raw values used as reference later
+function decodeCompact(bytes, reference) {
+	if ((bytes[0] >> 6) !== COMPACT_VERSION) {
+		throw new Error("Unknown version " + (bytes[0] >> 6));
+	}
+	var result = {
+		seq: bytes[0] & 0x0F,
+		delta: (bytes[0] & 0x20) !== 0,
+		codes: {},
+		data: {},
+	};
+	var reader = new BitReader(bytes, 8);
+	if (result.delta) {
+		result.ref_seq = reader.read(8) & 0x0F;
+		if (!reference) {
+			return result;
+		}
+		if (reference.seq !== result.ref_seq) {
+			throw new Error("Reference " + reference.seq + " does not match " + result.ref_seq);
+		}
+	}
+	var bitmap = reader.read(16);
+	if (!result.delta) {
+		readValues(reader, bitmap, result);
+		return result;
+	}
+
+	for (var idx = 0; idx < FIELDS.length; idx++) {
+		if ((bitmap & (1 << idx)) === 0) {
+			continue;
+		}
+		var field = FIELDS[idx];
+		var bits = field[1];
+		var code;
+		var encoding = reader.read(2);
+		if (encoding === 3) {
+			code = reader.read(bits);
+			if (field[2]) {
+				code = signExtend(code, bits);
+			}
+		} else {
+			var ref_code = reference.codes[field[0]];
+			if (ref_code === undefined) {
+				throw new Error(field[0] + " missing in reference");
+			}
+			var zigzag = encoding === 0 ? 0 : reader.read(encoding === 1 ? 4 : 8);
+			var diff = (zigzag & 1) ? -((zigzag + 1) >> 1) : zigzag >> 1;
+			code = ref_code + diff;
+		}
+		result.codes[field[0]] = code;
+		result.data[field[0]] = Math.round((code + field[3]) * field[4] * 100) / 100;
+	}
+	return result;
+}
+
+// TTN / Chirpstack v4 entry point
+function decodeUplink(input) {
+	if (input.fPort === BATCH_FPORT) {
+		try {
+			return { data: { readings: decodeBatch(input.bytes) } };
+		} catch (err) {
+			return { errors: [err.message] };
+		}
+	}
+	if (input.fPort !== COMPACT_FPORT) {
+		return { errors: ["Not a compact packet, use the Cayenne LPP decoder for fPort " + input.fPort] };
+	}
+	try {
+		var result = decodeCompact(input.bytes, null);
+		if (result.delta) {
+			return {
+				data: { seq: result.seq, ref_seq: result.ref_seq },
+				warnings: ["Difference packet, needs the reference packet"],
+			};
+		}
+		return { data: result.data };
+	} catch (err) {
+		return { errors: [err.message] };
+	}
+}
+
+if (typeof module !== "undefined") {
+	module.exports = { decodeCompact: decodeCompact, decodeBatch: decodeBatch, decodeUplink: decodeUplink, FIELDS: FIELDS };
+}
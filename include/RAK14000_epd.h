@@ -12,49 +12,88 @@
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_EPD.h>
+#include "epd_partial.h"
+#include "RAK14000_fonts.h"
+#include "quantized_series.h"
+#include "tiered_history.h"
 
 // For text length calculations
-extern int16_t txt_x1;
-extern int16_t txt_y1;
 extern uint16_t txt_w;
 extern uint16_t txt_w2;
-extern uint16_t txt_h;
 
 // For text and image placements
 extern uint16_t x_text;
 extern uint16_t y_text;
-extern uint16_t s_text;
 extern uint16_t w_text;
 extern uint16_t h_text;
 extern uint16_t x_graph;
-extern uint16_t y_graph;
-extern uint16_t h_bar;
-extern uint16_t w_bar;
-extern float bar_divider;
-extern uint16_t spacer;
 
-extern Adafruit_SSD1681 display;
+/** Widgets of the scientific UI */
+#define WIDGET_DIVIDER 0
+#define WIDGET_VOC_GRAPH 1
+#define WIDGET_CO2_GRAPH 2
+#define WIDGET_CO2_VALUE 3
+#define WIDGET_PM 4
+#define WIDGET_TEMP 5
+#define WIDGET_HUMID 6
+#define WIDGET_BARO 7
+#define WIDGET_LIGHT 8
+
+/** Widget styles */
+#define STYLE_ROW 0	   // Icon, value and unit in one row
+#define STYLE_COLUMN 1 // Icon above, value and unit right aligned
+
+/** Max number of widgets on one screen */
+#define WIDGETS_MAX 16
+/** Distance of the bars in the graphs */
+#define GRAPH_BAR_STEP 2
+
+/** Widget of the scientific UI */
+struct widget_s
+{
+	/** WIDGET_xxx */
+	uint8_t type;
+	/** STYLE_ROW or STYLE_COLUMN */
+	uint8_t style;
+	/** Icon position */
+	int16_t icon_x;
+	int16_t icon_y;
+	/** Graph area or value position, depends on the widget type */
+	int16_t x;
+	int16_t y;
+	int16_t w;
+	int16_t h;
+};
+
+extern widget_s g_widgets[];
+extern uint8_t g_widgets_num;
+
+extern PartialEPD display;
 
 extern uint16_t bg_color;
 extern uint16_t txt_color;
 
-extern const uint16_t num_values;
-extern uint16_t voc_values[];
-extern float temp_values[];
-extern float humid_values[];
-extern float baro_values[];
-extern float co2_values[];
-extern uint16_t pm10_values[];
-extern uint16_t pm25_values[];
-extern uint16_t pm100_values[];
-extern float light_values[];
-extern uint8_t voc_idx;
-extern uint8_t temp_idx;
-extern uint8_t humid_idx;
-extern uint8_t baro_idx;
-extern uint8_t co2_idx;
-extern uint8_t pm_idx;
-extern uint8_t light_idx;
+/** Number of values in the history, 1/4 of the display width */
+static constexpr uint16_t num_values = 400 / 4;
+extern TieredHistory<num_values> voc_values;
+extern QuantizedSeries<num_values> temp_values;
+extern QuantizedSeries<num_values> humid_values;
+extern QuantizedSeries<num_values> baro_values;
+extern TieredHistory<num_values, true> co2_values;
+extern QuantizedSeries<num_values> pm10_values;
+extern QuantizedSeries<num_values> pm25_values;
+extern QuantizedSeries<num_values> pm100_values;
+extern QuantizedSeries<num_values> light_values;
+/** Screen layers, the static layer is drawn once and kept as template */
+#define LAYER_STATIC 0
+#define LAYER_VALUES 1
+/** Layer that is drawn, LAYER_STATIC or LAYER_VALUES */
+extern uint8_t g_draw_layer;
+
+/** Selected graph time base, TIER_RAW, TIER_HOUR or TIER_DAY */
+extern uint8_t g_graph_tier;
+/** Offset of the history time stamps, continues the time after a reset without RTC */
+extern uint32_t g_history_time_offset;
 
 extern char disp_text[60];
 
@@ -67,39 +106,44 @@ extern char *months_txt[];
 void text_rak14000(int16_t x, int16_t y, char *text, uint16_t text_color, uint32_t text_size);
 void scientific_rak14000(void);
 void rak14000_start_screen(bool startup);
+void draw_start_screen_rak14000(bool startup);
+void render_rak14000(void);
+bool dump_frame_rak14000(uint8_t screen);
 void status_ui_rak14000(void);
-void voc_rak14000(void);
-void co2_rak14000(bool has_pm);
-void pm_rak14000(void);
-void temp_rak14000(bool has_pm, bool has_baro);
-void humid_rak14000(bool has_pm, bool has_baro);
-void baro_rak14000(bool has_pm);
+void layout_rak14000(uint16_t caps);
+void graph_axis_rak14000(const widget_s &widget);
+void voc_rak14000(const widget_s &widget);
+void co2_rak14000(const widget_s &widget);
+void pm_rak14000(const widget_s &widget);
+void value_rak14000(const widget_s &widget);
 void icon_rak14000(void);
 void draw_bar_rak14000(uint8_t level, uint16_t x, uint16_t y);
-void light_rak14000(bool has_pm);
 void set_voc_rak14000(uint16_t voc_value);
 void set_temp_rak14000(float temp_value);
 void set_humid_rak14000(float humid_value);
 void set_co2_rak14000(float co2_value);
 void set_baro_rak14000(float baro_value);
 void set_pm_rak14000(uint16_t pm10_env, uint16_t pm25_env, uint16_t pm100_env);
+void set_light_rak14000(float light_value);
+uint32_t history_time(void);
 
-extern unsigned char good_air[];
+// Large images are PackBits compressed, draw them with display.draw_packed()
+extern const uint8_t good_air[];
 extern uint16_t good_air_width;
 extern uint16_t good_air_height;
 extern uint16_t good_air_len;
 
-extern unsigned char bad_air[];
+extern const uint8_t bad_air[];
 extern uint16_t bad_air_width;
 extern uint16_t bad_air_height;
 extern uint16_t bad_air_len;
 
-extern unsigned char worried_air[];
+extern const uint8_t worried_air[];
 extern uint16_t worried_air_width;
 extern uint16_t worried_air_height;
 extern uint16_t worried_air_len;
 
-extern unsigned char rak_img[];
+extern const uint8_t rak_img[];
 extern uint16_t rak_img_width;
 extern uint16_t rak_img_height;
 extern uint16_t rak_img_length;
@@ -139,26 +183,22 @@ extern uint16_t pm_img_width;
 extern uint16_t pm_img_height;
 extern uint16_t pm_img_length;
 
-extern unsigned char built_img[];
+extern const uint8_t built_img[];
 extern uint16_t built_img_width;
 extern uint16_t built_img_height;
 extern uint16_t built_img_length;
 
-extern unsigned char wisblock_img[];
+extern const uint8_t wisblock_img[];
 extern uint16_t wisblock_width;
 extern uint16_t wisblock_height;
 extern uint16_t wisblock_length;
 
 extern uint8_t RAK_EPD_10pt_Bitmaps[];
 
-extern GFXglyph RAK_EPD_10pt_Glyphs[];
-
 extern GFXfont RAK_EPD_10pt;
 
 extern uint8_t RAK_EPD_20pt_Bitmaps[];
 
-extern GFXglyph RAK_EPD_20pt_Glyphs[];
-
 extern GFXfont RAK_EPD_20pt;
 
 #define SMALL_FONT &RAK_EPD_10pt
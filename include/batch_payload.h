@@ -0,0 +1,51 @@
+/**
+ * @file batch_payload.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Send several sensor readings in one packet
+ *        The readings are stored and sent together when the batch is full
+ *        or when the next reading would not fit into the max payload size
+ *        of the current data rate. Each reading is sent in the compact
+ *        format with the time since the reading.
+ * @version 0.1
+ * @date 2024-03-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _BATCH_PAYLOAD_H_
+#define _BATCH_PAYLOAD_H_
+#include <stdint.h>
+
+/** fPort of batch packets */
+#define BATCH_FPORT 4
+/** Max number of readings in one batch, 4 bits in the packet header */
+#define BATCH_SAMPLES_MAX 15
+/** Max size of a batch packet, largest LoRaWAN payload of all regions */
+#define BATCH_PACKET_MAX 242
+/** Bits of each reading before its values, time offset and bitmap */
+#define BATCH_SAMPLE_HDR_BITS 32
+
+/** Results of add_batch_sample() */
+#define BATCH_OFF 0		// Batching not used
+#define BATCH_STORED 1	// Reading stored, space for more readings
+#define BATCH_SEND 2	// Reading stored, batch should be sent now
+#define BATCH_INVALID 3 // Reading could not be converted, not stored
+
+/** Stored reading */
+struct batch_sample_s
+{
+	/** Time of the reading in seconds since power up */
+	uint32_t time;
+	/** Bitmap of the values */
+	uint16_t bitmap;
+	/** Values without offset */
+	int32_t values[COMPACT_FIELDS_MAX];
+};
+
+// Forward declarations
+uint8_t add_batch_sample(const uint8_t *lpp, uint8_t lpp_len);
+lmh_error_status send_batch(void);
+
+extern uint8_t g_batch_samples;
+
+#endif // _BATCH_PAYLOAD_H_
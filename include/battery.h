@@ -0,0 +1,40 @@
+/**
+ * @file battery.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Battery monitor
+ *        The battery voltage is measured once per sensor cycle with
+ *        hardware oversampling and filtered. All users read the filtered
+ *        value instead of starting their own ADC conversion.
+ *        The discharge slope is estimated from the filtered value to
+ *        calculate the remaining runtime.
+ * @version 0.1
+ * @date 2024-03-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _BATTERY_H_
+#define _BATTERY_H_
+#include <stdint.h>
+
+/** Samples averaged by the SAADC for one conversion */
+#define BATT_OVERSAMPLING 64
+/** Weight of a new sample in the filtered value is 1 / BATT_FILTER_WEIGHT */
+#define BATT_FILTER_WEIGHT 4
+/** Weight of a new slope in the filtered slope is 1 / BATT_SLOPE_WEIGHT */
+#define BATT_SLOPE_WEIGHT 4
+/** Min time between two slope calculations in ms */
+#define BATT_SLOPE_INTERVAL 3600000
+/** Battery voltage that counts as empty in mV */
+#define BATT_EMPTY_MV 3300.0
+/** Below this voltage in mV the device is powered from USB without battery */
+#define BATT_MIN_MV 1000.0
+
+// Forward declarations
+void init_battery(void);
+void sample_battery(void);
+float battery_mv(void);
+float battery_slope(void);
+int32_t battery_runtime(void);
+
+#endif // _BATTERY_H_
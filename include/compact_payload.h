@@ -0,0 +1,74 @@
+/**
+ * @file compact_payload.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Compact payload format
+ *        The Cayenne LPP packet is converted into a bit packed packet.
+ *        A bitmap tells which values are included, each value uses only
+ *        the bits needed for the resolution of the sensor.
+ *        Optional values are sent as difference to the last packet that
+ *        was acknowledged by the LoRaWAN server.
+ *        Decoder is in decoders/compact_decoder.js
+ * @version 0.1
+ * @date 2024-03-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _COMPACT_PAYLOAD_H_
+#define _COMPACT_PAYLOAD_H_
+#include <stdint.h>
+
+/** Payload formats */
+#define PAYLOAD_LPP 0
+#define PAYLOAD_COMPACT 1
+#define PAYLOAD_DELTA 2
+#define PAYLOAD_NUM 3
+
+/** fPort of compact packets, Cayenne LPP packets use fPort 2 */
+#define COMPACT_FPORT 3
+/** Format version in the packet header */
+#define COMPACT_VERSION 1
+/** Max number of values, one bit per value in the bitmap */
+#define COMPACT_FIELDS_MAX 16
+/** Max number of packets a difference packet can be after its reference packet */
+#define COMPACT_DELTA_MAX 15
+/** Max size of a compact packet, header, reference, bitmap and all values as absolute values */
+#define COMPACT_SIZE_MAX 32
+
+/** Header bits */
+#define COMPACT_HDR_DELTA 0x20
+#define COMPACT_HDR_SEQ 0x0F
+
+/** Value encoding in difference packets, 2 bits per value */
+#define COMPACT_DELTA_SAME 0  // Same value as in the reference packet
+#define COMPACT_DELTA_4 1	  // Difference in 4 bits, zigzag coded
+#define COMPACT_DELTA_8 2	  // Difference in 8 bits, zigzag coded
+#define COMPACT_DELTA_FULL 3 // Absolute value
+
+/** Value in the compact packet */
+struct compact_field_s
+{
+	/** Cayenne LPP channel of the value */
+	uint8_t channel;
+	/** Number of bits */
+	uint8_t bits;
+	/** Flag if the value is signed */
+	bool is_signed;
+	/** Offset subtracted from the Cayenne LPP value */
+	int16_t offset;
+};
+
+// Forward declarations
+int8_t lpp_size(uint8_t type);
+bool compact_values(const uint8_t *lpp, uint8_t lpp_len, int32_t *values, uint16_t *bitmap);
+uint16_t compact_bits(uint16_t bitmap);
+void compact_put_bits(uint8_t *packet, uint16_t *pos, uint32_t value, uint8_t bits);
+void compact_put_values(uint8_t *packet, uint16_t *pos, uint16_t bitmap, const int32_t *values);
+uint8_t encode_compact(const uint8_t *lpp, uint8_t lpp_len, uint8_t *packet);
+bool compact_needs_ack(void);
+void compact_tx_started(bool confirmed);
+void compact_tx_finished(bool acked);
+
+extern uint8_t g_payload_format;
+
+#endif // _COMPACT_PAYLOAD_H_
@@ -0,0 +1,115 @@
+/**
+ * @file epd_partial.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief SSD1681/SSD1683 driver with partial refresh
+ *        The last frame sent to the display is kept as a copy. On a refresh
+ *        only the display lines that changed are sent and updated with the
+ *        partial refresh waveform. A full refresh is done every
+ *        EPD_FULL_REFRESH_CYCLE partial refreshes to remove ghosting.
+ *        Frames that are identical to the shown frame are skipped.
+ *        The static part of a screen can be kept as template, a new frame
+ *        starts from a copy of the template.
+ *        Pixels can be read back from the display buffer for frame dumps.
+ *        Bar graphs are written directly into the display buffer.
+ *        PackBits compressed bitmaps are decoded while drawing.
+ *        The refresh does not wait for the display update, the update
+ *        is finished when the next refresh starts or with wait_update().
+ *        The display is only reset and initialized if it was powered down,
+ *        between updates the controller keeps its settings.
+ * @version 0.1
+ * @date 2024-03-15
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _EPD_PARTIAL_H_
+#define _EPD_PARTIAL_H_
+#include <Adafruit_EPD.h>
+
+/** Number of partial refreshes before a full refresh is forced */
+#define EPD_FULL_REFRESH_CYCLE 10
+/** Max number of changed areas sent in one partial refresh */
+#define EPD_BANDS_MAX 8
+/** Changed areas closer than this number of lines are sent as one area */
+#define EPD_BAND_GAP 8
+
+/**
+ * @brief SSD1681 with tracking of the changed display lines
+ *        Changed lines are grouped into bands, each band is written
+ *        as one RAM window. Bands always cover the full line.
+ *
+ */
+class PartialEPD : public Adafruit_SSD1681
+{
+public:
+	PartialEPD(int width, int height, int16_t SID, int16_t SCLK, int16_t DC, int16_t RST,
+			   int16_t CS, int16_t SRCS, int16_t MISO, int16_t BUSY = -1);
+
+	bool refresh(bool force_full = false);
+	void powerDown(void) override;
+	bool update_busy(void);
+	bool update_done(void);
+	void wait_update(void);
+	void store_template(uint32_t key);
+	bool restore_template(uint32_t key);
+	bool get_pixel(int16_t x, int16_t y);
+	void draw_bars(int16_t x, int16_t step, int16_t bottom, const int16_t *tops, uint16_t count, uint16_t color);
+	void draw_packed(int16_t x, int16_t y, const uint8_t *packed, int16_t w, int16_t h, uint16_t color);
+
+	/** Number of skipped refreshes, frame did not change */
+	uint32_t skip_count = 0;
+	/** Number of full refreshes */
+	uint32_t full_count = 0;
+	/** Number of partial refreshes */
+	uint32_t partial_count = 0;
+	/** Bytes sent to the display RAM in the last refresh */
+	uint32_t last_bytes = 0;
+	/** Time the last refresh blocked the caller in ms */
+	uint32_t last_time = 0;
+	/** Time the display was busy with the last update in ms */
+	uint32_t last_busy = 0;
+	/** Bytes sent to the display RAM since boot */
+	uint32_t total_bytes = 0;
+	/** Time spent in display code since boot in ms, drawing, sending and waiting */
+	uint32_t total_blocked = 0;
+
+private:
+	struct band_s
+	{
+		uint16_t first;
+		uint16_t last;
+	};
+
+	void blit_byte(int16_t x, int16_t y, uint8_t bits, uint16_t color);
+	uint16_t find_bands(band_s *bands);
+	uint32_t write_lines(uint8_t ram, uint16_t first, uint16_t last, const uint8_t *source);
+	void start_update(bool partial);
+	void finish_update(void);
+
+	/** Copy of the frame that is currently shown */
+	uint8_t *_shown = NULL;
+	/** Flag if _shown matches the display */
+	bool _shown_valid = false;
+	/** Flag if the display was powered up and not powered down since */
+	bool _powered = false;
+	/** Partial refreshes since the last full refresh */
+	uint8_t _partials = 0;
+	/** Flag if a display update was started and not finished */
+	volatile bool _updating = false;
+	/** Start time of the display update */
+	volatile uint32_t _update_start = 0;
+	/** End time of the display update, set by update_done(), 0 if not known */
+	volatile uint32_t _update_end = 0;
+	/** Areas that have to be written into the old image RAM after the partial update */
+	band_s _old_bands[EPD_BANDS_MAX];
+	/** Number of areas in _old_bands */
+	uint16_t _old_num = 0;
+	/** Static part of the screen */
+	uint8_t *_template = NULL;
+	/** Layout the template was drawn for */
+	uint32_t _template_key = 0;
+	/** Flag if _template is valid */
+	bool _template_valid = false;
+};
+
+#endif // _EPD_PARTIAL_H_
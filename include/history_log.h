@@ -0,0 +1,71 @@
+/**
+ * @file history_log.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Persistent log of the sensor value history
+ *        Samples are appended to rotating segment files in the InternalFS
+ *        and replayed into the value history after a reset.
+ *        The hourly and daily aggregates of VOC and CO2 are saved in an
+ *        extra file when new aggregates were added.
+ * @version 0.1
+ * @date 2024-03-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _HISTORY_LOG_H_
+#define _HISTORY_LOG_H_
+#include <stdint.h>
+
+/** Series IDs in the log records */
+#define HIST_VOC 0
+#define HIST_TEMP 1
+#define HIST_HUMID 2
+#define HIST_BARO 3
+#define HIST_CO2 4
+#define HIST_PM10 5
+#define HIST_PM25 6
+#define HIST_PM100 7
+#define HIST_LIGHT 8
+/** Series ID of the segment header, time holds the segment sequence number */
+#define HIST_SEGMENT 0xFF
+
+/** Number of segment files */
+#define HIST_SEG_NUM 3
+/** Max size of a segment file, one flash block of the file system */
+#define HIST_SEG_SIZE 4096
+/** Size of the write buffer, one program page of the file system */
+#define HIST_BATCH_SIZE 256
+
+/** Log record, 8 bytes */
+struct __attribute__((packed)) history_record_s
+{
+	uint32_t time;
+	int16_t code;
+	uint8_t series;
+	uint8_t crc;
+};
+
+/** Header of the hourly or daily aggregates of a series in the tier file, followed by num tier_entry_s */
+struct __attribute__((packed)) tier_header_s
+{
+	uint32_t last_slot;
+	uint16_t num;
+	uint8_t series;
+	uint8_t tier;
+};
+
+/** Saved aggregates of one time slot */
+struct __attribute__((packed)) tier_entry_s
+{
+	int16_t mean;
+	int16_t low;
+	int16_t high;
+};
+
+// Forward declarations
+void init_history_log(void);
+void add_history_log(uint8_t series, int16_t code, uint32_t time);
+void flush_history_log(void);
+void history_tiers_changed(void);
+
+#endif // _HISTORY_LOG_H_
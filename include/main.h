@@ -18,6 +18,12 @@
 #include <nrfx_power.h>
 #include "debug.h"
 #include "RAK14000_epd.h"
+#include "history_log.h"
+#include "sensor_registry.h"
+#include "battery.h"
+#include "compact_payload.h"
+#include "batch_payload.h"
+#include "payload_packer.h"
 
 // RAK19024 Base Board
 #if _CUSTOM_BOARD_ == 1		// RAK19024
@@ -36,6 +42,9 @@
 #define EPD_POWER WB_IO2	// EPD power enable pin
 #endif
 #define SET_PIN WB_IO6 // PM sensor enable pin
+#ifndef RTC_INT
+#define RTC_INT WB_IO5 // Interrupt pin for RTC alarm, depends on the slot of the RAK12002
+#endif
 
 /** Wakeup triggers for application events */
 #define MOTION 0b1000000000000000
@@ -54,6 +63,8 @@
 #define N_DISP_JOIN 0b1111110111111111
 #define RST_REQ 0b0000000100000000
 #define N_RST_REQ 0b1111111011111111
+#define SENSOR_REQ 0b0000000010000000
+#define N_SENSOR_REQ 0b1111111101111111
 #define APP_EVENT 0b1111111110000001
 
 // Structures and Unions
@@ -77,12 +88,22 @@ struct date_time_s
 #endif
 
 // Forward declarations
-void send_delayed(TimerHandle_t unused);
+void sensor_wakeup(TimerHandle_t unused);
 void init_user_at(void);
 void read_batt_settings(void);
 void save_batt_settings(bool check_batt_enables);
 void read_ui_settings(void);
 void save_ui_settings(uint8_t ui_selected);
+void read_graph_settings(void);
+void save_graph_settings(uint8_t graph_tier);
+void read_align_settings(void);
+void save_align_settings(bool align);
+void read_payload_settings(void);
+void save_payload_settings(uint8_t format);
+void read_batch_settings(void);
+void save_batch_settings(uint8_t samples);
+void read_prio_settings(void);
+void save_prio_settings(void);
 
 // Global Variables
 extern WisCayenne g_solution_data;
@@ -101,6 +122,7 @@ extern bool has_rak12019;
 extern bool has_rak12037;
 extern bool has_rak12039;
 extern bool has_rak12047;
+extern bool has_rak14000;
 extern bool g_has_rgb;
 extern bool g_voc_valid;
 extern float g_last_temp;
@@ -115,5 +137,7 @@ extern bool g_occupied;
 extern bool g_is_using_battery;
 extern bool g_rgb_on;
 extern time_t g_app_start_time;
+extern time_t g_boot_init_time;
+extern time_t g_boot_uplink_time;
 
 #endif
\ No newline at end of file
@@ -38,6 +38,10 @@ void shutdown_rak1906(void);
 bool init_rak12002(void);
 void set_rak12002(uint16_t year, uint8_t month, uint8_t date, uint8_t hour, uint8_t minute);
 void read_rak12002(void);
+uint32_t get_rak12002_epoch(void);
+uint32_t align_rak12002(void);
+void set_align_rak12002(bool enable);
+extern bool g_rtc_align;
 
 bool init_rak12010(void);
 void read_rak12010();
@@ -49,6 +53,8 @@ void read_rak12019(void);
 
 bool init_rak12037(void);
 void read_rak12037(void);
+bool request_rak12037(void);
+bool poll_rak12037(void);
 void startup_rak12037(void);
 void shutdown_rak12037(void);
 uint16_t get_calib_rak12037(void);
@@ -65,8 +71,14 @@ void read_rak12047(void);
 void run_rak12047_algo(void);
 void startup_rak12047(void);
 void shutdown_rak12047(void);
+void save_rak12047_state(void);
+bool restore_rak12047_state(void);
 void voc_read_wakeup(TimerHandle_t unused);
 
+// Sensor schedule stuff
+void start_sensor_schedule(uint32_t min_length);
+void run_sensor_schedule(void);
+
 // RAK14000 EPD stuff
 void init_rak14000(void);
 void clear_rak14000(void);
@@ -0,0 +1,35 @@
+/**
+ * @file payload_packer.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Fit Cayenne LPP packets into the max payload size of the data rate
+ *        If the packet is too big, the values are sorted by priority and
+ *        packed until the packet is full. The values that did not fit are
+ *        sent in a follow up packet or together with the next reading.
+ * @version 0.1
+ * @date 2024-03-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _PAYLOAD_PACKER_H_
+#define _PAYLOAD_PACKER_H_
+#include <stdint.h>
+
+/** fPort of Cayenne LPP packets */
+#define LPP_FPORT 2
+/** Max number of channels in the priority list */
+#define PACKER_PRIO_MAX 8
+/** Max size of a Cayenne LPP packet including the deferred values */
+#define PACKER_LPP_MAX 64
+/** Max number of values in a Cayenne LPP packet, smallest value is 3 bytes */
+#define PACKER_VALUES_MAX (PACKER_LPP_MAX / 3)
+
+// Forward declarations
+uint8_t lora_max_payload(void);
+lmh_error_status send_lpp_packet(const uint8_t *lpp, uint8_t lpp_len);
+bool send_lpp_deferred(void);
+
+extern uint8_t g_lpp_priority[PACKER_PRIO_MAX];
+extern uint8_t g_lpp_priority_num;
+
+#endif // _PAYLOAD_PACKER_H_
@@ -0,0 +1,162 @@
+/**
+ * @file quantized_series.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Fixed point sensor value history
+ *        Values are stored as int16_t codes with a per series scale
+ *        (resolution) and offset and are decoded when read.
+ *        value = code * scale + offset
+ *        Min, max, mean and variance are only kept if STATS is set,
+ *        without them a series of N values takes 2 * N + 12 bytes.
+ * @version 0.1
+ * @date 2024-03-06
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _QUANTIZED_SERIES_H_
+#define _QUANTIZED_SERIES_H_
+#include <math.h>
+#include <type_traits>
+#include "ring_series.h"
+
+/**
+ * @brief Iterator, decodes the values from oldest to newest
+ *        Same type for series with and without statistics
+ *
+ * @tparam N max number of stored values
+ */
+template <uint16_t N>
+class QuantizedIterator
+{
+public:
+	QuantizedIterator(typename RingBuffer<int16_t, N>::iterator code_it, float scale, float offset) : _code_it(code_it), _scale(scale), _offset(offset) {}
+	float operator*(void) const { return *_code_it * _scale + _offset; }
+	QuantizedIterator &operator++(void)
+	{
+		++_code_it;
+		return *this;
+	}
+	bool operator!=(const QuantizedIterator &other) const { return _code_it != other._code_it; }
+	bool operator==(const QuantizedIterator &other) const { return _code_it == other._code_it; }
+
+private:
+	typename RingBuffer<int16_t, N>::iterator _code_it;
+	float _scale;
+	float _offset;
+};
+
+/**
+ * @brief Decoded values of a series, used to draw series with and without statistics the same way
+ *
+ * @tparam N max number of stored values
+ */
+template <uint16_t N>
+class QuantizedRange
+{
+public:
+	QuantizedRange(QuantizedIterator<N> first, QuantizedIterator<N> last) : _first(first), _last(last) {}
+	QuantizedIterator<N> begin(void) const { return _first; }
+	QuantizedIterator<N> end(void) const { return _last; }
+	bool empty(void) const { return _first == _last; }
+
+private:
+	QuantizedIterator<N> _first;
+	QuantizedIterator<N> _last;
+};
+
+/**
+ * @brief Ring buffer of quantized values
+ *        Statistics are kept on the codes and decoded on request
+ *
+ * @tparam N max number of stored values
+ * @tparam STATS true to keep min, max, mean and variance
+ */
+template <uint16_t N, bool STATS = false>
+class QuantizedSeries
+{
+public:
+	typedef QuantizedIterator<N> iterator;
+
+	/**
+	 * @brief Construct a new quantized series
+	 *
+	 * @param scale resolution of the stored values, e.g. 0.01 for 0.01 °C
+	 * @param offset value that is stored as code 0
+	 */
+	QuantizedSeries(float scale, float offset) : _scale(scale), _offset(offset) {}
+
+	/**
+	 * @brief Convert a value into its code, clipped to the int16_t range
+	 *
+	 * @param value value to convert
+	 * @return int16_t code
+	 */
+	int16_t encode(float value) const
+	{
+		float code = roundf((value - _offset) / _scale);
+		if (code > 32767.0)
+		{
+			return 32767;
+		}
+		if (code < -32768.0)
+		{
+			return -32768;
+		}
+		return (int16_t)code;
+	}
+
+	/**
+	 * @brief Convert a code back into a value
+	 *
+	 * @param code code to convert
+	 * @return float value
+	 */
+	float decode(int16_t code) const { return code * _scale + _offset; }
+
+	/**
+	 * @brief Add a new value
+	 *
+	 * @param value new value, quantized to the series resolution
+	 */
+	void push(float value) { _codes.push(encode(value)); }
+
+	/**
+	 * @brief Add an already encoded value
+	 *
+	 * @param code new code
+	 */
+	void push_code(int16_t code) { _codes.push(code); }
+
+	float latest(void) const { return _codes.empty() ? 0.0 : decode(_codes.latest()); }
+	float oldest(void) const { return _codes.empty() ? 0.0 : decode(_codes.oldest()); }
+	float operator[](uint16_t idx) const { return decode(_codes[idx]); }
+	int16_t latest_code(void) const { return _codes.latest(); }
+	int16_t code(uint16_t idx) const { return _codes[idx]; }
+
+	// Only available with STATS
+	float min_value(void) const { return _codes.empty() ? 0.0 : decode(_codes.min_value()); }
+	float max_value(void) const { return _codes.empty() ? 0.0 : decode(_codes.max_value()); }
+	float mean(void) const { return _codes.empty() ? 0.0 : _codes.mean() * _scale + _offset; }
+	float variance(void) const { return _codes.variance() * _scale * _scale; }
+
+	float resolution(void) const { return _scale; }
+	void clear(void) { _codes.clear(); }
+	uint16_t size(void) const { return _codes.size(); }
+	bool empty(void) const { return _codes.empty(); }
+	bool full(void) const { return _codes.full(); }
+	static constexpr uint16_t capacity(void) { return N; }
+
+	iterator begin(void) const { return iterator(_codes.begin(), _scale, _offset); }
+	iterator end(void) const { return iterator(_codes.end(), _scale, _offset); }
+	QuantizedRange<N> range(void) const { return QuantizedRange<N>(begin(), end()); }
+
+private:
+	/** Stored codes, with statistics only if needed */
+	typename std::conditional<STATS, RingSeries<int16_t, N>, RingBuffer<int16_t, N>>::type _codes;
+	/** Resolution of a code step */
+	float _scale;
+	/** Value of code 0 */
+	float _offset;
+};
+
+#endif // _QUANTIZED_SERIES_H_
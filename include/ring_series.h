@@ -0,0 +1,321 @@
+/**
+ * @file ring_series.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Fixed size ring buffer for the sensor value history
+ *        New values overwrite the oldest value once the buffer is full,
+ *        no values are shifted. Iteration is always oldest to newest.
+ *        RingSeries adds min, max, mean and variance of the stored values,
+ *        updated with each new value, no scan over the buffer is required.
+ * @version 0.1
+ * @date 2024-03-04
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _RING_SERIES_H_
+#define _RING_SERIES_H_
+#include <stdint.h>
+
+/**
+ * @brief Ring buffer with head/count indices
+ *
+ * @tparam T arithmetic type of the stored values
+ * @tparam N max number of stored values
+ */
+template <typename T, uint16_t N>
+class RingBuffer
+{
+public:
+	/**
+	 * @brief Iterator, walks the values from oldest to newest
+	 *
+	 */
+	class iterator
+	{
+	public:
+		iterator(const RingBuffer *buffer, uint16_t pos) : _buffer(buffer), _pos(pos) {}
+		T operator*(void) const { return (*_buffer)[_pos]; }
+		iterator &operator++(void)
+		{
+			_pos++;
+			return *this;
+		}
+		bool operator!=(const iterator &other) const { return _pos != other._pos; }
+		bool operator==(const iterator &other) const { return _pos == other._pos; }
+
+	private:
+		const RingBuffer *_buffer;
+		uint16_t _pos;
+	};
+
+	RingBuffer(void) { clear(); }
+
+	/**
+	 * @brief Add a new value, overwrites the oldest value if the buffer is full
+	 *
+	 * @param value new value
+	 */
+	void push(T value)
+	{
+		_values[_head] = value;
+		_head = (_head + 1) % N;
+		if (_count < N)
+		{
+			_count++;
+		}
+	}
+
+	/**
+	 * @brief Get the latest added value
+	 *
+	 * @return T latest value or 0 if the buffer is empty
+	 */
+	T latest(void) const
+	{
+		if (_count == 0)
+		{
+			return T();
+		}
+		return _values[(_head + N - 1) % N];
+	}
+
+	/**
+	 * @brief Get the oldest value
+	 *
+	 * @return T oldest value or 0 if the buffer is empty
+	 */
+	T oldest(void) const
+	{
+		if (_count == 0)
+		{
+			return T();
+		}
+		return _values[(_head + N - _count) % N];
+	}
+
+	/**
+	 * @brief Access a value by its age
+	 *
+	 * @param idx 0 = oldest value, size() - 1 = latest value
+	 * @return T value
+	 */
+	T operator[](uint16_t idx) const
+	{
+		return _values[(_head + N - _count + idx) % N];
+	}
+
+	/**
+	 * @brief Remove all values
+	 *
+	 */
+	void clear(void)
+	{
+		_head = 0;
+		_count = 0;
+	}
+
+	uint16_t size(void) const { return _count; }
+	bool empty(void) const { return _count == 0; }
+	bool full(void) const { return _count == N; }
+	static constexpr uint16_t capacity(void) { return N; }
+
+	iterator begin(void) const { return iterator(this, 0); }
+	iterator end(void) const { return iterator(this, _count); }
+
+protected:
+	/** Value storage */
+	T _values[N];
+	/** Next write position */
+	uint16_t _head;
+	/** Number of stored values */
+	uint16_t _count;
+};
+
+/**
+ * @brief Ring buffer with sliding window statistics
+ *        Min and max are kept in monotonic queues of buffer positions,
+ *        mean and variance from running sums that are recalculated
+ *        once per buffer wrap to avoid accumulated rounding errors.
+ *        The queues take two times the buffer size, use RingBuffer for
+ *        series that do not need the statistics.
+ *
+ * @tparam T arithmetic type of the stored values
+ * @tparam N max number of stored values
+ */
+template <typename T, uint16_t N>
+class RingSeries : public RingBuffer<T, N>
+{
+public:
+	RingSeries(void) { clear(); }
+
+	/**
+	 * @brief Add a new value, overwrites the oldest value if the buffer is full
+	 *        O(1) amortized, including the statistics update
+	 *
+	 * @param value new value
+	 */
+	void push(T value)
+	{
+		uint16_t head = this->_head;
+		if (this->_count == N)
+		{
+			// Oldest value at head is dropped from the window
+			if (_min_q.front() == head)
+			{
+				_min_q.pop_front();
+			}
+			if (_max_q.front() == head)
+			{
+				_max_q.pop_front();
+			}
+			_sum -= this->_values[head];
+			_sum_sq -= (double)this->_values[head] * this->_values[head];
+		}
+
+		RingBuffer<T, N>::push(value);
+
+		// Remove all values from the back that can never become min or max again
+		while (!_min_q.empty() && (this->_values[_min_q.back()] >= value))
+		{
+			_min_q.pop_back();
+		}
+		_min_q.push_back(head);
+		while (!_max_q.empty() && (this->_values[_max_q.back()] <= value))
+		{
+			_max_q.pop_back();
+		}
+		_max_q.push_back(head);
+
+		_sum += value;
+		_sum_sq += (double)value * value;
+
+		// Recalculate the sums once per wrap to get rid of rounding errors
+		if ((this->_head == 0) && (this->_count == N))
+		{
+			_sum = 0.0;
+			_sum_sq = 0.0;
+			for (uint16_t idx = 0; idx < N; idx++)
+			{
+				_sum += this->_values[idx];
+				_sum_sq += (double)this->_values[idx] * this->_values[idx];
+			}
+		}
+	}
+
+	/**
+	 * @brief Smallest value in the buffer
+	 *
+	 * @return T min value or 0 if the buffer is empty
+	 */
+	T min_value(void) const
+	{
+		if (this->_count == 0)
+		{
+			return T();
+		}
+		return this->_values[_min_q.front()];
+	}
+
+	/**
+	 * @brief Largest value in the buffer
+	 *
+	 * @return T max value or 0 if the buffer is empty
+	 */
+	T max_value(void) const
+	{
+		if (this->_count == 0)
+		{
+			return T();
+		}
+		return this->_values[_max_q.front()];
+	}
+
+	/**
+	 * @brief Mean of the values in the buffer
+	 *
+	 * @return float mean value or 0 if the buffer is empty
+	 */
+	float mean(void) const
+	{
+		if (this->_count == 0)
+		{
+			return 0.0;
+		}
+		return (float)(_sum / this->_count);
+	}
+
+	/**
+	 * @brief Population variance of the values in the buffer
+	 *
+	 * @return float variance or 0 if the buffer is empty
+	 */
+	float variance(void) const
+	{
+		if (this->_count == 0)
+		{
+			return 0.0;
+		}
+		double avg = _sum / this->_count;
+		double var = (_sum_sq / this->_count) - (avg * avg);
+		return var > 0.0 ? (float)var : 0.0;
+	}
+
+	/**
+	 * @brief Remove all values
+	 *
+	 */
+	void clear(void)
+	{
+		RingBuffer<T, N>::clear();
+		_min_q.clear();
+		_max_q.clear();
+		_sum = 0.0;
+		_sum_sq = 0.0;
+	}
+
+private:
+	/**
+	 * @brief Fixed size double ended queue of buffer positions
+	 *        Never holds more than N entries, the window size
+	 *
+	 */
+	class PosQueue
+	{
+	public:
+		void clear(void)
+		{
+			_first = 0;
+			_len = 0;
+		}
+		bool empty(void) const { return _len == 0; }
+		uint16_t front(void) const { return _pos[_first]; }
+		uint16_t back(void) const { return _pos[(_first + _len - 1) % N]; }
+		void push_back(uint16_t pos)
+		{
+			_pos[(_first + _len) % N] = pos;
+			_len++;
+		}
+		void pop_front(void)
+		{
+			_first = (_first + 1) % N;
+			_len--;
+		}
+		void pop_back(void) { _len--; }
+
+	private:
+		uint16_t _pos[N];
+		uint16_t _first;
+		uint16_t _len;
+	};
+
+	/** Positions of the min candidates, values ascending */
+	PosQueue _min_q;
+	/** Positions of the max candidates, values descending */
+	PosQueue _max_q;
+	/** Running sum of the stored values */
+	double _sum;
+	/** Running sum of the squared stored values */
+	double _sum_sq;
+};
+
+#endif // _RING_SERIES_H_
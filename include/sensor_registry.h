@@ -0,0 +1,91 @@
+/**
+ * @file sensor_registry.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Common interface of the sensor drivers
+ *        All supported modules are listed in one table, initialization,
+ *        sensor readings, AT commands and display use this table instead
+ *        of checking each module separately.
+ * @version 0.1
+ * @date 2024-03-14
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _SENSOR_REGISTRY_H_
+#define _SENSOR_REGISTRY_H_
+#include <stdint.h>
+
+/** Measured values, used to select the display layout */
+#define SENSOR_CAP_TEMP 0x0001
+#define SENSOR_CAP_HUMID 0x0002
+#define SENSOR_CAP_BARO 0x0004
+#define SENSOR_CAP_LIGHT 0x0008
+#define SENSOR_CAP_CO2 0x0010
+#define SENSOR_CAP_PM 0x0020
+#define SENSOR_CAP_VOC 0x0040
+#define SENSOR_CAP_RTC 0x0080
+
+/** Sensor flags */
+#define SENSOR_BOOT_READ 0x01 // Read once during boot
+#define SENSOR_ALWAYS_ON 0x02 // Runs in the background, not started or stopped per reading
+#define SENSOR_SLOW_WAKE 0x04 // Needs some time after power up before it answers on the I2C bus
+
+/** Max time after the bus scan to wait for slow waking modules */
+#define SENSOR_WAKE_TIME 5000
+/** Time between two probes of slow waking modules */
+#define SENSOR_PROBE_INTERVAL 250
+
+/** Module has no separate power supply */
+#define SENSOR_NO_POWER 0xFF
+
+/** Max number of entries in the sensor table */
+#define SENSOR_DRIVERS_MAX 16
+
+/** Sensor driver */
+struct sensor_driver_s
+{
+	/** Module name */
+	const char *name;
+	/** Flag if the module was found */
+	bool *available;
+	/** Initialization, returns true if the module was found. NULL if initialized separately */
+	bool (*init)(void);
+	/** Wake up for a reading, can be NULL */
+	void (*startup)(void);
+	/** Check if a reading is finished, can be NULL if the reading is immediately available */
+	bool (*ready)(void);
+	/** Read the values and add them to the payload, can be NULL */
+	void (*read)(void);
+	/** Put into sleep mode after a reading, can be NULL */
+	void (*shutdown)(void);
+	/** First LPP channel used in the payload, 0 if none */
+	uint8_t lpp_channel;
+	/** Measured values SENSOR_CAP_xxx */
+	uint16_t caps;
+	/** Time from startup until the sensor can start a measurement in ms */
+	uint32_t warmup_ms;
+	/** Time of one measurement after the warm-up in ms */
+	uint32_t conversion_ms;
+	/** Power enable pin or SENSOR_NO_POWER */
+	uint8_t power_pin;
+	/** I2C address */
+	uint8_t i2c_addr;
+	/** SENSOR_BOOT_READ, SENSOR_ALWAYS_ON, SENSOR_SLOW_WAKE */
+	uint8_t flags;
+};
+
+extern const sensor_driver_s sensor_drivers[];
+extern const uint8_t sensor_drivers_num;
+
+// Forward declarations
+void scan_i2c_bus(void);
+bool i2c_found(uint8_t addr);
+void init_sensors(void);
+void probe_slow_sensors(void);
+bool slow_probe_running(void);
+void stop_slow_probe(bool power_off);
+bool request_sensors(void);
+void read_sensors(void);
+uint16_t sensor_caps(void);
+
+#endif // _SENSOR_REGISTRY_H_
@@ -0,0 +1,282 @@
+/**
+ * @file tiered_history.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Multi resolution sensor value history
+ *        Raw samples (one per send interval) are kept together with
+ *        hourly and daily min/max/mean aggregates. The aggregates are
+ *        built while the samples come in, the graphs only read them.
+ *        The aggregates can be saved and restored, samples replayed after
+ *        a restore are not aggregated twice.
+ * @version 0.1
+ * @date 2024-03-08
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _TIERED_HISTORY_H_
+#define _TIERED_HISTORY_H_
+#include "quantized_series.h"
+
+/** Graph time bases / history tiers */
+#define TIER_RAW 0
+#define TIER_HOUR 1
+#define TIER_DAY 2
+#define TIER_NUM 3
+
+/**
+ * @brief History with raw, hourly and daily tiers
+ *
+ * @tparam N number of entries per tier
+ * @tparam STATS true to keep the min/max statistics needed for graph scaling
+ */
+template <uint16_t N, bool STATS = false>
+class TieredHistory
+{
+public:
+	/**
+	 * @brief Aggregates of one time base
+	 *        Codes of a time slot are accumulated until the first sample
+	 *        of the next slot arrives, then min, max and mean are stored.
+	 *
+	 */
+	class Tier
+	{
+	public:
+		Tier(uint32_t period, float scale, float offset) : mean(scale, offset), low(scale, offset), high(scale, offset), _period(period), _count(0), _last_slot(0) {}
+
+		/**
+		 * @brief Add a raw sample code
+		 *
+		 * @param code sample code
+		 * @param now sample time in seconds
+		 * @return true if the aggregates of a finished time slot were stored
+		 */
+		bool add(int16_t code, uint32_t now)
+		{
+			uint32_t slot = now / _period;
+			bool stored = false;
+			if ((_count != 0) && (slot != _slot))
+			{
+				flush();
+				stored = true;
+			}
+			if (_count == 0)
+			{
+				_slot = slot;
+				_sum = 0;
+				_low = code;
+				_high = code;
+			}
+			_sum += code;
+			_count++;
+			if (code < _low)
+			{
+				_low = code;
+			}
+			if (code > _high)
+			{
+				_high = code;
+			}
+			return stored;
+		}
+
+		/**
+		 * @brief Add saved aggregates of a finished time slot
+		 *
+		 * @param slot time slot of the aggregates
+		 * @param mean_code mean code
+		 * @param low_code lowest code
+		 * @param high_code highest code
+		 */
+		void restore(uint32_t slot, int16_t mean_code, int16_t low_code, int16_t high_code)
+		{
+			mean.push_code(mean_code);
+			low.push_code(low_code);
+			high.push_code(high_code);
+			_last_slot = slot;
+		}
+
+		/**
+		 * @brief Check if the time slot of a sample is already stored
+		 *
+		 * @param now sample time in seconds
+		 * @return true if the aggregates of the time slot are stored
+		 */
+		bool stored(uint32_t now) const { return !mean.empty() && ((now / _period) <= _last_slot); }
+
+		/** Time slot of the last stored aggregates */
+		uint32_t last_slot(void) const { return _last_slot; }
+
+		/** Mean value per time slot */
+		QuantizedSeries<N> mean;
+		/** Lowest value per time slot */
+		QuantizedSeries<N, STATS> low;
+		/** Highest value per time slot */
+		QuantizedSeries<N, STATS> high;
+
+	private:
+		/**
+		 * @brief Store the aggregates of the finished time slot
+		 *
+		 */
+		void flush(void)
+		{
+			mean.push_code((int16_t)roundf((float)_sum / _count));
+			low.push_code(_low);
+			high.push_code(_high);
+			_last_slot = _slot;
+			_count = 0;
+		}
+
+		/** Length of a time slot in seconds */
+		uint32_t _period;
+		/** Time slot that is currently accumulated */
+		uint32_t _slot;
+		/** Sum of the codes in the current time slot */
+		int32_t _sum;
+		/** Number of codes in the current time slot */
+		uint16_t _count;
+		/** Lowest code in the current time slot */
+		int16_t _low;
+		/** Highest code in the current time slot */
+		int16_t _high;
+		/** Time slot of the last stored aggregates */
+		uint32_t _last_slot;
+	};
+
+	/**
+	 * @brief Construct a new tiered history
+	 *
+	 * @param scale resolution of the stored values
+	 * @param offset value that is stored as code 0
+	 */
+	TieredHistory(float scale, float offset) : _raw(scale, offset), _hour(3600, scale, offset), _day(86400, scale, offset) {}
+
+	/**
+	 * @brief Add a new sample
+	 *
+	 * @param value sample value
+	 * @param now sample time in seconds
+	 * @return true if hourly or daily aggregates were stored
+	 */
+	bool push(float value, uint32_t now) { return push_code(_raw.encode(value), now); }
+
+	/**
+	 * @brief Add an already encoded sample
+	 *
+	 * @param code sample code
+	 * @param now sample time in seconds
+	 * @return true if hourly or daily aggregates were stored
+	 */
+	bool push_code(int16_t code, uint32_t now)
+	{
+		_raw.push_code(code);
+		bool stored = _hour.add(code, now);
+		return _day.add(code, now) || stored;
+	}
+
+	/**
+	 * @brief Add a sample from the history log after the aggregates were restored
+	 *        Samples of time slots that are already stored are only added to the raw samples
+	 *
+	 * @param code sample code
+	 * @param now sample time in seconds
+	 */
+	void replay_code(int16_t code, uint32_t now)
+	{
+		_raw.push_code(code);
+		if (!_hour.stored(now))
+		{
+			_hour.add(code, now);
+		}
+		if (!_day.stored(now))
+		{
+			_day.add(code, now);
+		}
+	}
+
+	/**
+	 * @brief Aggregates of a time base, used to save and restore them
+	 *
+	 * @param tier TIER_HOUR or TIER_DAY
+	 * @return Tier& hourly or daily aggregates
+	 */
+	Tier &tier(uint8_t tier) { return tier == TIER_DAY ? _day : _hour; }
+	const Tier &tier(uint8_t tier) const { return tier == TIER_DAY ? _day : _hour; }
+
+	/**
+	 * @brief Values to draw for a time base
+	 *
+	 * @param tier TIER_RAW, TIER_HOUR or TIER_DAY
+	 * @return QuantizedRange<N> raw samples or mean per time slot
+	 */
+	QuantizedRange<N> series(uint8_t tier) const
+	{
+		switch (tier)
+		{
+		case TIER_HOUR:
+			return _hour.mean.range();
+		case TIER_DAY:
+			return _day.mean.range();
+		default:
+			return _raw.range();
+		}
+	}
+
+	/**
+	 * @brief Lowest value of a time base, used for graph scaling
+	 *        Only available with STATS
+	 *
+	 * @param tier TIER_RAW, TIER_HOUR or TIER_DAY
+	 * @return float lowest value
+	 */
+	float min_value(uint8_t tier) const
+	{
+		switch (tier)
+		{
+		case TIER_HOUR:
+			return _hour.low.min_value();
+		case TIER_DAY:
+			return _day.low.min_value();
+		default:
+			return _raw.min_value();
+		}
+	}
+
+	/**
+	 * @brief Highest value of a time base, used for graph scaling
+	 *        Only available with STATS
+	 *
+	 * @param tier TIER_RAW, TIER_HOUR or TIER_DAY
+	 * @return float highest value
+	 */
+	float max_value(uint8_t tier) const
+	{
+		switch (tier)
+		{
+		case TIER_HOUR:
+			return _hour.high.max_value();
+		case TIER_DAY:
+			return _day.high.max_value();
+		default:
+			return _raw.max_value();
+		}
+	}
+
+	float latest(void) const { return _raw.latest(); }
+	int16_t latest_code(void) const { return _raw.latest_code(); }
+	int16_t encode(float value) const { return _raw.encode(value); }
+	const QuantizedSeries<N, STATS> &raw(void) const { return _raw; }
+	uint16_t size(void) const { return _raw.size(); }
+	bool empty(void) const { return _raw.empty(); }
+
+private:
+	/** Raw samples */
+	QuantizedSeries<N, STATS> _raw;
+	/** Hourly aggregates */
+	Tier _hour;
+	/** Daily aggregates */
+	Tier _day;
+};
+
+#endif // _TIERED_HISTORY_H_
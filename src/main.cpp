@@ -25,6 +25,11 @@ SoftwareTimer g_sensor_timer;
 /** Start time of application */
 time_t g_app_start_time;
 
+/** Time from boot until the end of init_app in ms */
+time_t g_boot_init_time = 0;
+/** Time from boot until the first uplink in ms */
+time_t g_boot_uplink_time = 0;
+
 /** No screen update flag for join success */
 bool second_screen = false;
 
@@ -132,18 +137,18 @@ bool init_app(void)
 	digitalWrite(PIR_POWER, HIGH);
 
 	// Check if device is running from battery
-	float batt_val = read_batt();
-	MYLOG("APP", "Battery level is %.3f", batt_val);
-	g_is_using_battery = batt_val < 1000.0 ? false : true;
+	init_battery();
+	MYLOG("APP", "Battery level is %.3f", battery_mv());
+	g_is_using_battery = battery_mv() < BATT_MIN_MV ? false : true;
 
 	/// \todo only for testing
 	// g_is_using_battery = true;
 
 	Wire.begin();
 	delay(100);
-	Wire.beginTransmission(0x52);
-	byte error = Wire.endTransmission();
-	if (error == 0)
+	// Find all connected I2C devices at once
+	scan_i2c_bus();
+	if (i2c_found(0x52))
 	{
 		if (!init_rak12002())
 		{
@@ -162,70 +167,14 @@ bool init_app(void)
 #if HAS_EPD > 0
 	MYLOG("APP", "Init RAK14000");
 	init_rak14000();
+
+	// Restore the value history from the log
+	init_history_log();
 #endif
 
 	// Enable the modules
-	has_rak1901 = init_rak1901();
-	if (has_rak1901)
-	{
-		startup_rak1901();
-		delay(250);
-		read_rak1901();
-		if (g_is_using_battery)
-			shutdown_rak1901();
-		AT_PRINTF("+EVT:RAK1901 OK\n");
-	}
-	has_rak1902 = init_rak1902();
-	if (has_rak1902)
-	{
-		AT_PRINTF("+EVT:RAK1902 OK\n");
-	}
-	has_rak1903 = init_rak1903();
-	if (has_rak1903)
-	{
-		AT_PRINTF("+EVT:RAK1903 OK\n");
-	}
-	has_rak1906 = init_rak1906();
-	if (has_rak1906)
-	{
-		AT_PRINTF("+EVT:RAK1906 OK\n");
-	}
-	has_rak12010 = init_rak12010();
-	if (has_rak1906)
-	{
-		AT_PRINTF("+EVT:RAK12010 OK\n");
-	}
-	// if (!g_is_using_battery)
-	{
-		has_rak12039 = init_rak12039();
-		if (has_rak12039)
-		{
-			MYLOG("APP", "PM initialized");
-			if (g_is_using_battery)
-				startup_rak12039();
-			read_rak12039();
-			if (g_is_using_battery)
-				shutdown_rak12039();
-			AT_PRINTF("+EVT:RAK12039 OK\n");
-		}
-	}
-	has_rak12037 = init_rak12037();
-	if (has_rak12037)
-	{
-		MYLOG("APP", "CO2 initialized");
-		if (g_is_using_battery)
-			startup_rak12037();
-		read_rak12037();
-		if (g_is_using_battery)
-			shutdown_rak12037();
-		AT_PRINTF("+EVT:RAK12037 OK\n");
-	}
-	has_rak12047 = init_rak12047();
-	if (has_rak12047)
-	{
-		MYLOG("APP", "VOC initialized");
-		AT_PRINTF("+EVT:RAK12047 OK\n");
-	}
+	init_sensors();
+
 	has_rgb = init_rgb();
 	if (has_rgb)
 	{
@@ -252,27 +201,27 @@ bool init_app(void)
 		}
 	}
 
-	if (g_is_using_battery)
+	// If slow waking modules are still probed, the probing switches the power off
+	if (g_is_using_battery && !slow_probe_running())
 	{
 		// Power down the whole system
 		MYLOG("APP", "Shut down power");
 		// Disable CO2 & PM POWER
 		digitalWrite(CO2_PM_POWER, LOW);
 	}
-	if (has_rak12039)
-	{
-		// Prepare timer to send after the sensors were awake for 30 seconds
-		g_sensor_timer.begin(30000, send_delayed, NULL, false);
-	}
-	else
-	{
-		// Prepare timer to send after the sensors were awake for 12 seconds
-		g_sensor_timer.begin(12000, send_delayed, NULL, false);
-	}
+	// Prepare timer for the sensor startup schedule, period is set by the schedule
+	g_sensor_timer.begin(1000, sensor_wakeup, NULL, false);
+
+	// Get the payload format, batch size and value priorities
+	read_payload_settings();
+	read_batch_settings();
+	read_prio_settings();
 
 	// Initialize User AT commands
 	init_user_at();
 
+	g_boot_init_time = millis();
+	MYLOG("APP", "Init done after %ld ms", g_boot_init_time);
 	return true;
 }
 
@@ -302,51 +251,25 @@ void app_event_handler(void)
 		// Set a no screen update flag for join success
 		second_screen = true;
 
-		if (g_is_using_battery)
-		{
-			digitalWrite(CO2_PM_POWER, HIGH);
-			digitalWrite(SET_PIN, HIGH);
-		}
-		// Start sensor measurements
-		if (has_rak1901)
-		{
-			startup_rak1901();
-		}
-		if (has_rak1902)
-		{
-			startup_rak1902();
-		}
-		if (has_rak1903)
-		{
-			startup_rak1903();
-		}
-		if (has_rak1906)
-		{
-			startup_rak1906();
-		}
-		if (has_rak12010)
-		{
-			startup_rak12010();
-		}
-		if (has_rak12037)
-		{
-			startup_rak12037();
-		}
-		if (has_rak12039)
-		{
-			startup_rak12039();
-		}
-		if (has_rak12047)
-		{
-			// Always running in the background
-		}
-
-		g_sensor_timer.start();
+		// Start sensor measurements, each sensor and its power supply is started just in time
+		// RAK12047 is always running in the background
+		// If aligned to the RTC, the readings are done at the end of the minute after the alarm
+		start_sensor_schedule(align_rak12002());
 	}
 
 	/*********************************************************/
 	/* Sensor reading end event handling                     */
 	/*********************************************************/
+	// Sensors that have no data yet are not waited for
+	// SEND_NOW is set again when their reading is finished
+	if ((g_task_event_type & SEND_NOW) == SEND_NOW)
+	{
+		if (!request_sensors())
+		{
+			g_task_event_type &= N_SEND_NOW;
+		}
+	}
+
 	if ((g_task_event_type & SEND_NOW) == SEND_NOW)
 	{
 		g_task_event_type &= N_SEND_NOW;
@@ -355,59 +278,42 @@ void app_event_handler(void)
 		g_solution_data.reset();
 
 		// Read last measurement from available sensors
-		if (has_rak1901)
-		{
-			read_rak1901();
-			shutdown_rak1901();
-		}
-		if (has_rak1902)
-		{
-			shutdown_rak1902();
-		}
-		if (has_rak1903)
-		{
-			read_rak1903();
-			shutdown_rak1903();
-		}
-		if (has_rak1906)
-		{
-			read_rak1906();
-			shutdown_rak1906();
-		}
-		if (has_rak12010)
-		{
-			read_rak12010();
-			shutdown_rak12010();
-		}
-		if (has_rak12037)
-		{
-			read_rak12037();
-			shutdown_rak12037();
-		}
-		if (has_rak12039)
-		{
-			startup_rak12039();
-			delay(500);
-			read_rak12039();
-			shutdown_rak12039();
-		}
-		if (has_rak12047)
-		{
-			read_rak12047();
-		}
-		// Get battery level
-		float batt_level_f = read_batt();
-		g_solution_data.addVoltage(LPP_CHANNEL_BATT, batt_level_f / 1000.0);
+		read_sensors();
+
+		// Get battery level, the displays use the same filtered value
+		sample_battery();
+		g_solution_data.addVoltage(LPP_CHANNEL_BATT, battery_mv() / 1000.0);
 
 		// Add occupation information
 		g_solution_data.addPresence(LPP_CHANNEL_SWITCH, g_occupied);
 
 		if (g_lorawan_settings.lorawan_enable)
 		{
-			if (g_lpwan_has_joined)
+			uint8_t batch_result = BATCH_OFF;
+			if (g_lpwan_has_joined && (g_batch_samples != 0))
 			{
+				batch_result = add_batch_sample(g_solution_data.getBuffer(), g_solution_data.getSize());
+			}
+
+			if (batch_result == BATCH_STORED)
+			{
+				// Reading is sent later together with the next readings
+				MYLOG("APP", "Reading stored for batch");
+				api_wake_loop(DISP_UPDATE);
+			}
+			else if (g_lpwan_has_joined)
+			{
+				// Convert to compact payload if selected, Cayenne LPP is sent if the conversion fails
+				uint8_t compact_packet[COMPACT_SIZE_MAX];
+				uint8_t compact_len = 0;
+				if ((batch_result == BATCH_OFF) && (g_payload_format != PAYLOAD_LPP))
+				{
+					compact_len = encode_compact(g_solution_data.getBuffer(), g_solution_data.getSize(), compact_packet);
+				}
+
 				// Send a confirmed package every 30 packets to check connection
-				if (check_connection > 30)
+				// Reference packets of the compact payload are sent confirmed as well
+				if ((check_connection > 30) || ((compact_len != 0) && compact_needs_ack()))
 				{
 					g_lorawan_settings.confirmed_msg_enabled = LMH_CONFIRMED_MSG;
 					check_connection = 0;
@@ -418,11 +324,43 @@ void app_event_handler(void)
 				}
 				check_connection++;
 
-				lmh_error_status result = send_lora_packet(g_solution_data.getBuffer(), g_solution_data.getSize(), 2);
+				lmh_error_status result;
+				if (batch_result == BATCH_SEND)
+				{
+					result = send_batch();
+				}
+				else if (batch_result == BATCH_INVALID)
+				{
+					// Reading cannot be stored in the batch, send it as Cayenne LPP
+					result = send_lpp_packet(g_solution_data.getBuffer(), g_solution_data.getSize());
+				}
+				else if (compact_len != 0)
+				{
+					result = send_lora_packet(compact_packet, compact_len, COMPACT_FPORT);
+					if (result == LMH_SUCCESS)
+					{
+						// Only an enqueued packet can become the reference for difference packets
+						compact_tx_started(g_lorawan_settings.confirmed_msg_enabled == LMH_CONFIRMED_MSG);
+					}
+					else if (result == LMH_ERROR)
+					{
+						// Too big for the data rate, the Cayenne LPP values can be split
+						result = send_lpp_packet(g_solution_data.getBuffer(), g_solution_data.getSize());
+					}
+				}
+				else
+				{
+					// Values that do not fit into the data rate are sent later
+					result = send_lpp_packet(g_solution_data.getBuffer(), g_solution_data.getSize());
+				}
 				switch (result)
 				{
 				case LMH_SUCCESS:
 					MYLOG("APP", "Packet enqueued");
+					if (g_boot_uplink_time == 0)
+					{
+						g_boot_uplink_time = millis();
+					}
 					break;
 				case LMH_BUSY:
 					MYLOG("APP", "LoRa transceiver is busy");
@@ -442,7 +380,10 @@ void app_event_handler(void)
 		else
 		{
 			g_solution_data.addDevID(LPP_CHANNEL_DEVID, &g_lorawan_settings.node_device_eui[4]);
-			send_p2p_packet(g_solution_data.getBuffer(), g_solution_data.getSize());
+			if (send_p2p_packet(g_solution_data.getBuffer(), g_solution_data.getSize()) && (g_boot_uplink_time == 0))
+			{
+				g_boot_uplink_time = millis();
+			}
 		}
 
 		if (g_is_using_battery)
@@ -452,6 +393,26 @@ void app_event_handler(void)
 		}
 	}
 
+	/*********************************************************/
+	/* Sensor schedule and CO2 sensor poll event handling    */
+	/*********************************************************/
+	if ((g_task_event_type & SENSOR_REQ) == SENSOR_REQ)
+	{
+		g_task_event_type &= N_SENSOR_REQ;
+
+		// Check for slow waking modules after boot
+		probe_slow_sensors();
+
+		// Start sensors that are due
+		run_sensor_schedule();
+
+		if (has_rak12037 && poll_rak12037())
+		{
+			// CO2 reading finished, continue with the sensor readings
+			api_wake_loop(SEND_NOW);
+		}
+	}
+
 	/*********************************************************/
 	/* Display event handling                                */
 	/*********************************************************/
@@ -596,6 +557,8 @@ void app_event_handler(void)
 		// Power up display
 		startup_rak14000();
 		rak14000_start_screen(false);
+		flush_history_log();
+		save_rak12047_state();
 		delay(3000);
 		api_reset();
 	}
@@ -701,6 +664,13 @@ void lora_data_handler(void)
 			{
 				MYLOG("APP", "LPWAN TX cycle %s", g_rx_fin_result ? "finished ACK" : "failed NAK");
 			}
+			// Acknowledged packets are the reference for compact difference packets
+			compact_tx_finished(g_rx_fin_result);
+			// Send the values that did not fit into the last packet
+			if (g_lpwan_has_joined && send_lpp_deferred())
+			{
+				MYLOG("APP", "Deferred values enqueued");
+			}
 			if (!g_rx_fin_result)
 			{
 				// Increase fail send counter
@@ -709,6 +679,8 @@ void lora_data_handler(void)
 				if (send_fail == 10)
 				{
 					// Too many failed sendings, reset node and try to rejoin
+					flush_history_log();
+					save_rak12047_state();
 					delay(100);
 					api_reset();
 				}
@@ -2,6 +2,13 @@
  * @file RAK12002_rtc.cpp
  * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
  * @brief Initialization and usage of RAK12002 RTC module
+ *        The RTC is read once during boot and then every RTC_SYNC_INTERVAL
+ *        with one burst read of the time registers. In between the time
+ *        is counted from millis(), which runs from the RTC1 tick counter.
+ *        Reading the time does not need any I2C access.
+ *        Optional the sensor readings are started by the RTC alarm, then
+ *        the readings are aligned to the RTC time. With a send interval of
+ *        5 minutes the readings are done at :00, :05, :10, ...
  * @version 0.2
  * @date 2024-02-21
  *
@@ -17,6 +24,282 @@ Melopero_RV3028 rtc;
 /** Structure for date and time from RTC */
 date_time_s g_date_time;
 
+/** I2C address of the RV3028 */
+#define RV3028_ADDR 0x52
+/** First time register of the RV3028, seconds, minutes, hours, weekday, date, month, year */
+#define RV3028_REG_SECONDS 0x00
+/** Number of time registers */
+#define RV3028_TIME_REGS 7
+/** Time between two reads of the RTC in ms */
+#define RTC_SYNC_INTERVAL 3600000
+/** Differences up to this number of seconds are the unknown fraction of the RTC second and are not corrected */
+#define RTC_DRIFT_MAX 1
+/** RV3028 alarm registers, minutes, hours and weekday/date */
+#define RV3028_REG_ALARM 0x07
+/** RV3028 status register and alarm flag */
+#define RV3028_REG_STATUS 0x0E
+#define RV3028_AF 0x04
+/** RV3028 control 1 register and weekday/date alarm select */
+#define RV3028_REG_CONTROL1 0x0F
+#define RV3028_WADA 0x20
+/** RV3028 control 2 register and alarm interrupt enable */
+#define RV3028_REG_CONTROL2 0x10
+#define RV3028_AIE 0x08
+/** The alarm has minute resolution, it triggers the readings one minute before the aligned time */
+#define RTC_ALIGN_LEAD 60000
+/** Min time in seconds between the calculation and the next alarm */
+#define RTC_ALIGN_MARGIN 30
+/** Min interval in seconds, with 1 minute the next alarm would restart the cycle at its end and the reading is lost */
+#define RTC_ALIGN_MIN 120
+
+/** Flag if the sensor readings are started by the RTC alarm */
+bool g_rtc_align = false;
+/** Flag if the RTC alarm interrupt was triggered */
+static volatile bool rtc_alarm = false;
+
+/** Time of the software clock in seconds since 1970-01-01 at clock_base_ms */
+static uint32_t clock_base_epoch = 0;
+/** millis() at clock_base_epoch */
+static uint32_t clock_base_ms = 0;
+/** millis() of the last RTC read */
+static uint32_t clock_sync_ms = 0;
+/** Flag if the software clock was set from the RTC */
+static bool clock_valid = false;
+
+/**
+ * @brief Convert a BCD coded register value
+ *
+ * @param bcd register value
+ * @return uint8_t decimal value
+ */
+static uint8_t bcd_to_dec(uint8_t bcd)
+{
+	return (bcd >> 4) * 10 + (bcd & 0x0F);
+}
+
+/**
+ * @brief Read all time registers of the RV3028 in one I2C transfer
+ *        The RV3028 does not update the time registers during the transfer,
+ *        the values can not roll over between the registers.
+ *
+ * @param date_time structure for the date and time
+ * @return true if the registers were read and hold a valid date
+ * @return false if the RTC did not answer or the date is invalid
+ */
+static bool read_rak12002_regs(date_time_s *date_time)
+{
+	uint8_t regs[RV3028_TIME_REGS];
+
+	Wire.beginTransmission(RV3028_ADDR);
+	Wire.write(RV3028_REG_SECONDS);
+	if (Wire.endTransmission(false) != 0)
+	{
+		return false;
+	}
+	if (Wire.requestFrom(RV3028_ADDR, RV3028_TIME_REGS) != RV3028_TIME_REGS)
+	{
+		return false;
+	}
+	for (uint8_t idx = 0; idx < RV3028_TIME_REGS; idx++)
+	{
+		regs[idx] = Wire.read();
+	}
+
+	date_time->second = bcd_to_dec(regs[0] & 0x7F);
+	date_time->minute = bcd_to_dec(regs[1] & 0x7F);
+	date_time->hour = bcd_to_dec(regs[2] & 0x3F);
+	date_time->weekday = regs[3] & 0x07;
+	date_time->date = bcd_to_dec(regs[4] & 0x3F);
+	date_time->month = bcd_to_dec(regs[5] & 0x1F);
+	date_time->year = 2000 + bcd_to_dec(regs[6]);
+
+	return (date_time->month >= 1) && (date_time->month <= 12) && (date_time->date >= 1) && (date_time->date <= 31) && (date_time->hour < 24) && (date_time->minute < 60) && (date_time->second < 60);
+}
+
+/**
+ * @brief Convert a value to BCD code for the RTC registers
+ *
+ * @param dec decimal value 0 to 99
+ * @return uint8_t BCD value
+ */
+static uint8_t dec_to_bcd(uint8_t dec)
+{
+	return ((dec / 10) << 4) | (dec % 10);
+}
+
+/**
+ * @brief Convert date and time to seconds since 1970-01-01
+ *
+ * @param date_time date and time
+ * @return uint32_t seconds since 1970-01-01 00:00:00
+ */
+static uint32_t date_to_epoch(const date_time_s *date_time)
+{
+	// Days since 1970-01-01, March based year to simplify leap day handling
+	int32_t year = date_time->year - (date_time->month <= 2 ? 1 : 0);
+	int32_t era = year / 400;
+	uint32_t year_of_era = year - era * 400;
+	uint32_t day_of_year = (153 * (date_time->month + (date_time->month > 2 ? -3 : 9)) + 2) / 5 + date_time->date - 1;
+	uint32_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+	int32_t days = era * 146097 + (int32_t)day_of_era - 719468;
+
+	return (uint32_t)days * 86400 + date_time->hour * 3600 + date_time->minute * 60 + date_time->second;
+}
+
+/**
+ * @brief Convert seconds since 1970-01-01 to date and time
+ *
+ * @param epoch seconds since 1970-01-01 00:00:00
+ * @param date_time structure for the date and time
+ */
+static void epoch_to_date(uint32_t epoch, date_time_s *date_time)
+{
+	uint32_t days = epoch / 86400;
+	uint32_t seconds = epoch % 86400;
+
+	date_time->hour = seconds / 3600;
+	date_time->minute = (seconds % 3600) / 60;
+	date_time->second = seconds % 60;
+	// 1970-01-01 was a Thursday, 0 = Sunday
+	date_time->weekday = (days + 4) % 7;
+
+	// Reverse of date_to_epoch(), March based year
+	uint32_t shifted = days + 719468;
+	uint32_t era = shifted / 146097;
+	uint32_t day_of_era = shifted - era * 146097;
+	uint32_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+	uint32_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+	uint32_t month_index = (5 * day_of_year + 2) / 153;
+
+	date_time->date = day_of_year - (153 * month_index + 2) / 5 + 1;
+	date_time->month = month_index < 10 ? month_index + 3 : month_index - 9;
+	date_time->year = year_of_era + era * 400 + (date_time->month <= 2 ? 1 : 0);
+}
+
+/**
+ * @brief Time of the software clock
+ *        The base is moved forward in full seconds, that keeps the
+ *        fraction of the second and avoids the wrap around of millis()
+ *
+ * @return uint32_t seconds since 1970-01-01 00:00:00
+ */
+static uint32_t clock_epoch(void)
+{
+	uint32_t seconds = (millis() - clock_base_ms) / 1000;
+	clock_base_epoch += seconds;
+	clock_base_ms += seconds * 1000;
+	return clock_base_epoch;
+}
+
+/**
+ * @brief Read the RTC and correct the software clock
+ *        If the RTC can not be read, the software clock keeps running
+ *
+ * @return true if the RTC was read
+ * @return false if the RTC read failed
+ */
+static bool sync_rak12002(void)
+{
+	date_time_s rtc_time;
+
+	clock_sync_ms = millis();
+	if (!read_rak12002_regs(&rtc_time))
+	{
+		MYLOG("RTC", "RTC read failed");
+		return false;
+	}
+	uint32_t rtc_epoch = date_to_epoch(&rtc_time);
+
+	if (!clock_valid)
+	{
+		clock_base_epoch = rtc_epoch;
+		clock_base_ms = clock_sync_ms;
+		clock_valid = true;
+		return true;
+	}
+
+	int32_t drift = (int32_t)(rtc_epoch - clock_epoch());
+	if ((drift > RTC_DRIFT_MAX) || (drift < -RTC_DRIFT_MAX))
+	{
+		MYLOG("RTC", "Clock corrected by %ld s", drift);
+		clock_base_epoch += drift;
+	}
+	return true;
+}
+
+/**
+ * @brief RTC alarm interrupt, starts the sensor readings
+ *
+ */
+static void rtc_alarm_int(void)
+{
+	// Edges on the pin while the alignment is off are not from the alarm
+	if (!g_rtc_align)
+	{
+		return;
+	}
+	rtc_alarm = true;
+	api_wake_loop(STATUS);
+}
+
+/**
+ * @brief Enable or disable the RTC alarm interrupt of the MCU
+ *        The interrupt is only attached while the readings are aligned to the RTC
+ *
+ * @param enable true to attach the interrupt
+ */
+static void set_rak12002_int(bool enable)
+{
+	if (enable)
+	{
+		pinMode(RTC_INT, INPUT_PULLUP);
+		attachInterrupt(RTC_INT, rtc_alarm_int, FALLING);
+	}
+	else
+	{
+		detachInterrupt(RTC_INT);
+	}
+}
+
+/**
+ * @brief Disable the RTC alarm interrupt and clear the alarm flag
+ *
+ */
+static void stop_rak12002_alarm(void)
+{
+	uint8_t reg_value = rtc.readFromRegister(RV3028_REG_CONTROL2);
+	rtc.writeToRegister(RV3028_REG_CONTROL2, reg_value & ~RV3028_AIE);
+	reg_value = rtc.readFromRegister(RV3028_REG_STATUS);
+	rtc.writeToRegister(RV3028_REG_STATUS, reg_value & ~RV3028_AF);
+}
+
+/**
+ * @brief Set the RTC alarm
+ *        Minutes, hours and date must match, the alarm can be up to one month ahead
+ *
+ * @param alarm_epoch alarm time in seconds since 1970-01-01, seconds are ignored
+ */
+static void set_rak12002_alarm(uint32_t alarm_epoch)
+{
+	date_time_s alarm_time;
+	epoch_to_date(alarm_epoch, &alarm_time);
+
+	stop_rak12002_alarm();
+
+	// Date alarm instead of weekday alarm
+	uint8_t reg_value = rtc.readFromRegister(RV3028_REG_CONTROL1);
+	rtc.writeToRegister(RV3028_REG_CONTROL1, reg_value | RV3028_WADA);
+
+	// Bit 7 = 0 enables the alarm for this register
+	rtc.writeToRegister(RV3028_REG_ALARM, dec_to_bcd(alarm_time.minute));
+	rtc.writeToRegister(RV3028_REG_ALARM + 1, dec_to_bcd(alarm_time.hour));
+	rtc.writeToRegister(RV3028_REG_ALARM + 2, dec_to_bcd(alarm_time.date));
+
+	reg_value = rtc.readFromRegister(RV3028_REG_CONTROL2);
+	rtc.writeToRegister(RV3028_REG_CONTROL2, reg_value | RV3028_AIE);
+	MYLOG("RTC", "Alarm at %d.%02d.%02d %d:%02d", alarm_time.year, alarm_time.month, alarm_time.date, alarm_time.hour, alarm_time.minute);
+}
+
 /**
  * @brief Initialize the RTC
  *
@@ -57,25 +340,27 @@ bool init_rak12002(void)
 
 	rtc.set24HourMode(); // Set the device to use the 24hour format (default) instead of the 12 hour format
 
-	g_date_time.year = rtc.getYear();
-	g_date_time.month = rtc.getMonth();
-	g_date_time.weekday = rtc.getWeekday();
-	g_date_time.date = rtc.getDate();
-	g_date_time.hour = rtc.getHour();
-	g_date_time.minute = rtc.getMinute();
-	g_date_time.second = rtc.getSecond();
+	// Alarm interrupt, only enabled if the readings are aligned to the RTC
+	read_align_settings();
+	if (g_rtc_align)
+	{
+		set_rak12002_int(true);
+	}
 
-	if ((g_date_time.year == 2165) && (g_date_time.month == 165) && (g_date_time.date == 165))
+	clock_valid = false;
+	if (!sync_rak12002())
 	{
 		MYLOG("RTC", "Returned values make no sense, no RTC attached");
 		return false;
 	}
+	read_rak12002();
 	MYLOG("RTC", "%d.%02d.%02d %d:%02d:%02d", g_date_time.year, g_date_time.month, g_date_time.date, g_date_time.hour, g_date_time.minute, g_date_time.second);
 	return true;
 }
 
 /**
  * @brief Set the RAK12002 date and time
+ *        The software clock is set from the RTC again on the next read
  *
  * @param year in 4 digit format, e.g. 2020
  * @param month 1 to 12
@@ -89,20 +374,87 @@ void set_rak12002(uint16_t year, uint8_t month, uint8_t date, uint8_t hour, uint
 	uint8_t weekday = (date + (uint16_t)((2.6 * month) - 0.2) - (2 * (year / 100)) + year + (uint16_t)(year / 4) + (uint16_t)(year / 400)) % 7;
 	MYLOG("RTC", "Calculated weekday is %d", weekday);
 	rtc.setTime(year, month, weekday, date, hour, minute, 0);
+	clock_valid = false;
 }
 
 /**
- * @brief Update g_data_time structure with current the date
- *        and time from the RTC
+ * @brief Update g_data_time structure with the current date
+ *        and time from the software clock
  *
  */
 void read_rak12002(void)
 {
-	g_date_time.year = rtc.getYear();
-	g_date_time.month = rtc.getMonth();
-	g_date_time.weekday = rtc.getWeekday();
-	g_date_time.date = rtc.getDate();
-	g_date_time.hour = rtc.getHour();
-	g_date_time.minute = rtc.getMinute();
-	g_date_time.second = rtc.getSecond();
-}
\ No newline at end of file
+	epoch_to_date(get_rak12002_epoch(), &g_date_time);
+}
+
+/**
+ * @brief Get the time as seconds since 1970-01-01
+ *        The RTC is only read if RTC_SYNC_INTERVAL has passed since the last read
+ *
+ * @return uint32_t seconds since 1970-01-01 00:00:00
+ */
+uint32_t get_rak12002_epoch(void)
+{
+	if (!clock_valid || ((millis() - clock_sync_ms) >= RTC_SYNC_INTERVAL))
+	{
+		sync_rak12002();
+	}
+	return clock_epoch();
+}
+
+/**
+ * @brief Set the RTC alarm for the next aligned reading
+ *        Called on the STATUS event. The next reading is at the next multiple
+ *        of the send interval, rounded up to full minutes, at least RTC_ALIGN_MIN.
+ *        The alarm is set one minute earlier, the sensors are started during
+ *        this minute.
+ *        The send timer of the API is stopped, it would start readings that are
+ *        not aligned.
+ *
+ * @return uint32_t min sensor cycle length in ms, RTC_ALIGN_LEAD if woken up by the alarm, otherwise 0
+ */
+uint32_t align_rak12002(void)
+{
+	bool woken_by_alarm = rtc_alarm;
+	rtc_alarm = false;
+
+	if (!has_rak12002 || !g_rtc_align || (g_lorawan_settings.send_repeat_time == 0))
+	{
+		return 0;
+	}
+	api_timer_stop();
+
+	uint32_t interval = (g_lorawan_settings.send_repeat_time + 59999) / 60000 * 60;
+	if (interval < RTC_ALIGN_MIN)
+	{
+		interval = RTC_ALIGN_MIN;
+	}
+	uint32_t lead = RTC_ALIGN_LEAD / 1000;
+	uint32_t next = ((get_rak12002_epoch() + lead + RTC_ALIGN_MARGIN) / interval + 1) * interval;
+	set_rak12002_alarm(next - lead);
+
+	return woken_by_alarm ? RTC_ALIGN_LEAD : 0;
+}
+
+/**
+ * @brief Enable or disable the alignment of the readings to the RTC time
+ *        If disabled, the send timer of the API starts the readings again
+ *
+ * @param enable true to start the readings by the RTC alarm
+ */
+void set_align_rak12002(bool enable)
+{
+	g_rtc_align = enable;
+	save_align_settings(enable);
+	set_rak12002_int(enable);
+	if (enable)
+	{
+		align_rak12002();
+		return;
+	}
+	stop_rak12002_alarm();
+	if (g_lorawan_settings.send_repeat_time != 0)
+	{
+		api_timer_restart(g_lorawan_settings.send_repeat_time);
+	}
+}
@@ -58,6 +58,10 @@ void read_rak12010(void)
 #endif
 
 	g_solution_data.addLuminosity(LPP_CHANNEL_LIGHT2, (uint32_t)g_last_light_lux);
+
+#if HAS_EPD > 0
+	set_light_rak14000(g_last_light_lux);
+#endif
 }
 
 /**
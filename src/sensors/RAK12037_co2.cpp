@@ -2,6 +2,9 @@
  * @file RAK12037_co2.cpp
  * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
  * @brief Functions for RAK12037 CO2 gas sensor
+ *        The sensor is handled without waiting in delay() loops.
+ *        A timer sets the SENSOR_REQ event to poll the sensor and
+ *        wake up the loop until the sensor is ready.
  * @version 0.2
  * @date 2024-02-21
  *
@@ -14,6 +17,38 @@
 /** Sensor instance */
 SCD30 scd30;
 
+/** Sensor states */
+#define CO2_OFF 0
+#define CO2_STARTING 1
+#define CO2_MEASURING 2
+#define CO2_WAIT_DATA 3
+#define CO2_DATA_READY 4
+#define CO2_STOPPING 5
+
+/** Current sensor state */
+uint8_t co2_state = CO2_OFF;
+/** Sensor state after the reading was taken, CO2_MEASURING or CO2_OFF */
+uint8_t co2_next_state = CO2_OFF;
+/** Flag if a reading was requested */
+bool co2_read_requested = false;
+/** Flag if the values of the last reading are valid */
+bool co2_valid = false;
+/** Flag if the sensor returned 0 ppm and a second value is awaited */
+bool co2_zero_retry = false;
+/** Start time of the current wait for the sensor */
+time_t co2_wait_start = 0;
+/** Timer to poll the sensor, sends SENSOR_REQ events */
+SoftwareTimer co2_poll_timer;
+/** Flag if the poll timer is created */
+bool co2_timer_created = false;
+
+/** Last values read from the sensor */
+uint16_t co2_reading = 0;
+float temp_reading = 0.0;
+float humid_reading = 0.0;
+
+static bool check_data_rak12037(void);
+
 /**
  * @brief Initialize MQ2 gas sensor
  *
@@ -40,6 +75,12 @@ bool init_rak12037(void)
 
 	MYLOG("CO2", "SCD30 found");
 
+	if (!co2_timer_created)
+	{
+		co2_poll_timer.begin(1000, sensor_wakeup, NULL, true);
+		co2_timer_created = true;
+	}
+
 	//**************init SCD30 sensor *****************************************************
 	// Change number of seconds between measurements: 2 to 1800 (30 minutes), stored in non-volatile memory of SCD30
 	scd30.setMeasurementInterval(2);
@@ -57,6 +98,7 @@ bool init_rak12037(void)
 
 	// Start the measurements
 	scd30.beginMeasuring();
+	co2_state = CO2_MEASURING;
 
 	// shutdown_rak12037();
 
@@ -64,49 +106,178 @@ bool init_rak12037(void)
 }
 
 /**
- * @brief Read CO2 sensor data
- *     Data is added to Cayenne LPP payload as channels
- *     LPP_CHANNEL_CO2_2, LPP_CHANNEL_CO2_Temp_2 and LPP_CHANNEL_CO2_HUMID_2
+ * @brief Request a CO2 reading
+ *        Does not wait for the sensor. If no data is available yet, the
+ *        poll timer is started and SENSOR_REQ events are used to check the
+ *        sensor until data is available or the timeout is reached.
  *
+ * @return true if the reading is finished and read_rak12037() can be called
+ * @return false if the reading is still in progress
  */
-void read_rak12037(void)
+bool request_rak12037(void)
 {
-	time_t start_time = millis();
-	while (!scd30.dataAvailable())
+	if (co2_state == CO2_DATA_READY)
 	{
-		MYLOG("CO2", "Waiting for data, sensor needs 20 seconds for first value");
-		delay(1000);
-		if ((millis() - start_time) > 20000)
+		return true;
+	}
+	co2_read_requested = true;
+	co2_wait_start = millis();
+	co2_zero_retry = false;
+	co2_valid = false;
+	if (co2_state == CO2_OFF)
+	{
+		MYLOG("CO2", "Measurement not running");
+		co2_next_state = CO2_OFF;
+		co2_state = CO2_DATA_READY;
+		return true;
+	}
+	if (co2_state == CO2_MEASURING)
+	{
+		co2_state = CO2_WAIT_DATA;
+		if (check_data_rak12037())
 		{
-			// timeout, no data available
-			MYLOG("CO2", "Timeout");
-			return;
+			return true;
 		}
+		co2_poll_timer.setPeriod(1000);
+		co2_poll_timer.start();
 	}
+	// CO2_STARTING or CO2_STOPPING, the poll timer is already running
+	return false;
+}
 
-	uint16_t co2_reading = scd30.getCO2();
-	float temp_reading = scd30.getTemperature();
-	float humid_reading = scd30.getHumidity();
-
-	if (co2_reading == 0)
+/**
+ * @brief Handle the SENSOR_REQ event from the poll timer
+ *        Continues the start, read or stop of the sensor,
+ *        only one I2C transaction per call
+ *
+ * @return true if a requested reading was finished
+ * @return false if nothing to report
+ */
+bool poll_rak12037(void)
+{
+	switch (co2_state)
 	{
-		start_time = millis();
-		while (!scd30.dataAvailable())
+	case CO2_STARTING:
+		if (scd30.begin(Wire) && scd30.beginMeasuring())
 		{
-			MYLOG("CO2", "Waiting again for data, sensor needs 20 seconds for first value");
-			delay(1000);
-			if ((millis() - start_time) > 20000)
+			MYLOG("CO2", "RAK12037 measurements started");
+			co2_poll_timer.stop();
+			co2_state = CO2_MEASURING;
+			if (co2_read_requested)
 			{
-				// timeout, no data available
-				MYLOG("CO2", "Timeout 2");
-				return;
+				co2_state = CO2_WAIT_DATA;
+				co2_wait_start = millis();
+				co2_poll_timer.setPeriod(1000);
+				co2_poll_timer.start();
 			}
 		}
+		else if ((millis() - co2_wait_start) > 3000)
+		{
+			MYLOG("CO2", "RAK12037 start failed");
+			co2_poll_timer.stop();
+			co2_state = CO2_OFF;
+			if (co2_read_requested)
+			{
+				co2_next_state = CO2_OFF;
+				co2_state = CO2_DATA_READY;
+				return true;
+			}
+		}
+		break;
+	case CO2_WAIT_DATA:
+		return check_data_rak12037();
+	case CO2_STOPPING:
+		if (scd30.StopMeasurement())
+		{
+			MYLOG("CO2", "RAK12037 stopped");
+		}
+		else if ((millis() - co2_wait_start) <= 3000)
+		{
+			break;
+		}
+		else
+		{
+			MYLOG("CO2", "Stop RAK12037 failed");
+		}
+		co2_poll_timer.stop();
+		co2_state = CO2_OFF;
+		if (co2_read_requested)
+		{
+			// Reading was requested while stopping, no data
+			co2_next_state = CO2_OFF;
+			co2_state = CO2_DATA_READY;
+			return true;
+		}
+		break;
+	default:
+		co2_poll_timer.stop();
+		break;
+	}
+	return false;
+}
+
+/**
+ * @brief Check if the sensor has new data and get it
+ *        The sensor needs up to 20 seconds for the first value,
+ *        if the first value is 0, it waits another 20 seconds
+ *
+ * @return true if the reading is finished (with or without data)
+ * @return false if still waiting for data
+ */
+static bool check_data_rak12037(void)
+{
+	if (scd30.dataAvailable())
+	{
 		co2_reading = scd30.getCO2();
 		temp_reading = scd30.getTemperature();
 		humid_reading = scd30.getHumidity();
-		MYLOG("CO2", "Second reading");
+		if ((co2_reading != 0) || co2_zero_retry)
+		{
+			co2_valid = true;
+			co2_poll_timer.stop();
+			co2_next_state = CO2_MEASURING;
+			co2_state = CO2_DATA_READY;
+			MYLOG("CO2", "Data after %ld ms", millis() - co2_wait_start);
+			return true;
+		}
+		MYLOG("CO2", "Waiting again for data, sensor needs 20 seconds for first value");
+		co2_zero_retry = true;
+		co2_wait_start = millis();
+		return false;
+	}
+
+	if ((millis() - co2_wait_start) > 20000)
+	{
+		// timeout, no data available
+		MYLOG("CO2", co2_zero_retry ? "Timeout 2" : "Timeout");
+		co2_poll_timer.stop();
+		co2_next_state = CO2_MEASURING;
+		co2_state = CO2_DATA_READY;
+		return true;
+	}
+	MYLOG("CO2", "Waiting for data, sensor needs 20 seconds for first value");
+	return false;
+}
+
+/**
+ * @brief Read CO2 sensor data
+ *     Data is added to Cayenne LPP payload as channels
+ *     LPP_CHANNEL_CO2_2, LPP_CHANNEL_CO2_Temp_2 and LPP_CHANNEL_CO2_HUMID_2
+ *     Requires a finished request_rak12037()
+ *
+ */
+void read_rak12037(void)
+{
+	co2_read_requested = false;
+	// Back to the state the sensor is in, a stopped sensor stays off
+	co2_state = co2_next_state;
+	if (!co2_valid)
+	{
+		MYLOG("CO2", "No CO2 data");
+		return;
 	}
+	co2_valid = false;
+
 	MYLOG("CO2", "CO2 level %dppm", co2_reading);
 	MYLOG("CO2", "Temperature %.2f", temp_reading);
 	MYLOG("CO2", "Humidity %.2f", humid_reading);
@@ -116,8 +287,6 @@ void read_rak12037(void)
 
 	g_solution_data.addConcentration(LPP_CHANNEL_CO2_2, co2_reading);
 
-	scd30.StopMeasurement();
-
 #if HAS_EPD > 0
 	set_co2_rak14000(co2_reading);
 #endif
@@ -125,69 +294,45 @@ void read_rak12037(void)
 
 /**
  * @brief Wake up RAK12037 from sleep
+ *        If the sensor does not respond, e.g. the power was just switched on,
+ *        the start is retried from the poll timer for up to 3 seconds.
+ *        The measurement interval and the self calibration setting are
+ *        stored in the sensor by init_rak12037() and survive a power off.
  *
  */
 void startup_rak12037(void)
 {
-	if (g_is_using_battery)
-	{ // Initialize the sensor
-		init_rak12037();
-	}
-	// Change number of seconds between measurements: 2 to 1800 (30 minutes), stored in non-volatile memory of SCD30
-	scd30.setMeasurementInterval(2);
-
-	bool start_success = false;
-	time_t start_timeout = millis();
-	while ((millis() - start_timeout) < 3000)
+	if (scd30.begin(Wire) && scd30.beginMeasuring())
 	{
-		if (scd30.begin(Wire))
-		{
-			MYLOG("CO2", "RAK12037 started");
-			start_success = true;
-			break;
-		}
-		delay(250);
-	}
-
-	if (!start_success)
-	{
-		MYLOG("CO2", "RAK12037 start failed");
+		MYLOG("CO2", "RAK12037 measurements started");
+		co2_state = CO2_MEASURING;
 		return;
 	}
-
-	// Start the measurements
-	start_timeout = millis();
-	while ((millis() - start_timeout) < 3000)
-	{
-		if (scd30.beginMeasuring())
-		{
-			MYLOG("CO2", "RAK12037 measurements started");
-			start_success = true;
-			return;
-		}
-		delay(250);
-	}
-	MYLOG("CO2", "RAK12037 start measurement failed");
+	co2_state = CO2_STARTING;
+	co2_wait_start = millis();
+	co2_poll_timer.setPeriod(250);
+	co2_poll_timer.start();
 }
 
 /**
  * @brief Put the RAK12037 into sleep mode
+ *        If the sensor does not respond, the stop is retried
+ *        from the poll timer for up to 3 seconds
  *
  */
 void shutdown_rak12037(void)
 {
-		scd30.readMeasurement();
-		time_t start_timeout = millis();
-		while ((millis() - start_timeout) < 3000)
-		{
-			if (scd30.StopMeasurement())
-			{
-				MYLOG("CO2", "RAK12037 stopped");
-				return;
-			}
-			delay(250);
-		}
-		MYLOG("CO2", "Stop RAK12037 failed");
+	scd30.readMeasurement();
+	if (scd30.StopMeasurement())
+	{
+		MYLOG("CO2", "RAK12037 stopped");
+		co2_state = CO2_OFF;
+		return;
+	}
+	co2_state = CO2_STOPPING;
+	co2_wait_start = millis();
+	co2_poll_timer.setPeriod(250);
+	co2_poll_timer.start();
 }
 
 /**
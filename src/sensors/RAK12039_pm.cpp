@@ -37,7 +37,6 @@ bool init_rak12039(void)
 	bool waiting = true;
 	while (waiting)
 	{
-		delay(500);
 		Wire.beginTransmission(0x12);
 		error = Wire.endTransmission();
 		if (error == 0)
@@ -45,11 +44,15 @@ bool init_rak12039(void)
 			MYLOG("PMS", "RAK12039 answered at %ld ms", millis());
 			waiting = false;
 		}
-		if ((millis() - wait_sensor) > 10000)
+		else if ((millis() - wait_sensor) > 10000)
 		{
 			MYLOG("PMS", "RAK12039 timeout after 10000 ms");
 			return false;
 		}
+		else
+		{
+			delay(500);
+		}
 	}
 
 	MYLOG("PMS", "Initialize PMSA003I");
@@ -13,6 +13,9 @@
 #include "main.h"
 #include <SensirionI2CSgp40.h>
 #include <VOCGasIndexAlgorithm.h>
+#include <Adafruit_LittleFS.h>
+#include <InternalFileSystem.h>
+using namespace Adafruit_LittleFS_Namespace;
 
 /** Sampling interval for the algorithm in seconds */
 int32_t sampling_interval = 30;
@@ -39,6 +42,33 @@ uint16_t discard_counter = 0;
 /** Number of measurements to discard */
 uint16_t discard_number = 60;
 
+/** Number of measurements to discard after the algorithm state was restored */
+#define VOC_RESTORE_DISCARD 4
+/** Save the algorithm state every VOC_CHECKPOINT_SAMPLES measurements (10 minutes) */
+#define VOC_CHECKPOINT_SAMPLES 20
+/** Max age of a saved algorithm state in seconds, Sensirion recommends max 10 minutes */
+#define VOC_STATE_MAX_AGE 600
+/** Marker for a valid saved algorithm state */
+#define VOC_STATE_MARK 0x564F4331
+
+/** Saved algorithm state */
+struct voc_state_s
+{
+	uint32_t mark;
+	uint32_t time;
+	float state0;
+	float state1;
+};
+
+/** Filename to save the algorithm state */
+static const char voc_state_name[] = "VOC";
+
+/** File to save the algorithm state */
+File voc_state_file(InternalFS);
+
+/** Counter for the algorithm state checkpoints */
+uint16_t checkpoint_counter = 0;
+
 /**
  * @brief Initialize the sensor
  *
@@ -104,8 +134,12 @@ bool init_rak12047(void)
 		index_offset, learning_time_offset_hours, learning_time_gain_hours,
 		gating_max_duration_minutes, std_initial, gain_factor);
 
-	// Reset discard counter
+	// Reset discard counter, shorter discard period if the learned state is restored
 	discard_counter = 0;
+	if (restore_rak12047_state())
+	{
+		discard_number = VOC_RESTORE_DISCARD;
+	}
 
 	// Set VOC reading interval to sampling_interval seconds
 	voc_read_timer.begin(sampling_interval * 1000, voc_read_wakeup, NULL, true);
@@ -243,6 +277,13 @@ void run_rak12047_algo(void)
 			uint32_t new_voc_index = voc_algorithm.process(srawVoc);
 			voc_index = ((voc_index + new_voc_index) / 2);
 			MYLOG("VOC", "VOC: %ld", voc_index);
+
+			checkpoint_counter++;
+			if (checkpoint_counter >= VOC_CHECKPOINT_SAMPLES)
+			{
+				checkpoint_counter = 0;
+				save_rak12047_state();
+			}
 		}
 	}
 
@@ -277,3 +318,78 @@ void shutdown_rak12047(void)
 	}
 	// Keeping RAK12047 always on
 }
+
+/**
+ * @brief Save the learned state of the VOC algorithm
+ *        Only saved after the algorithm delivers valid values
+ *
+ */
+void save_rak12047_state(void)
+{
+	if (!has_rak12047 || !g_voc_valid)
+	{
+		return;
+	}
+
+	voc_state_s voc_state;
+	voc_state.mark = VOC_STATE_MARK;
+	voc_state.time = has_rak12002 ? get_rak12002_epoch() : 0;
+	voc_algorithm.get_states(voc_state.state0, voc_state.state1);
+
+	InternalFS.remove(voc_state_name);
+	voc_state_file.open(voc_state_name, FILE_O_WRITE);
+	voc_state_file.write((uint8_t *)&voc_state, sizeof(voc_state_s));
+	voc_state_file.close();
+	MYLOG("VOC", "Saved algorithm state %.2f %.2f", voc_state.state0, voc_state.state1);
+}
+
+/**
+ * @brief Restore the learned state of the VOC algorithm
+ *        With RTC the state is used if it is not older than VOC_STATE_MAX_AGE.
+ *        Without RTC the age is unknown, then the state is only used after
+ *        a software or watchdog reset, not after a power loss.
+ *        The saved state is used only once, it is removed after reading. A new
+ *        state is saved with the next checkpoint or before a software reset.
+ *
+ * @return true if the state was restored
+ * @return false if no usable state was found
+ */
+bool restore_rak12047_state(void)
+{
+	voc_state_s voc_state;
+
+	if (!voc_state_file.open(voc_state_name, FILE_O_READ))
+	{
+		MYLOG("VOC", "No saved algorithm state");
+		return false;
+	}
+	int read_bytes = voc_state_file.read((void *)&voc_state, sizeof(voc_state_s));
+	voc_state_file.close();
+	// A rejected or restored state must not be used again after a later reset
+	InternalFS.remove(voc_state_name);
+
+	if ((read_bytes != sizeof(voc_state_s)) || (voc_state.mark != VOC_STATE_MARK))
+	{
+		MYLOG("VOC", "Invalid algorithm state");
+		return false;
+	}
+
+	if (has_rak12002 && (voc_state.time != 0))
+	{
+		uint32_t now = get_rak12002_epoch();
+		if ((now < voc_state.time) || ((now - voc_state.time) > VOC_STATE_MAX_AGE))
+		{
+			MYLOG("VOC", "Algorithm state too old");
+			return false;
+		}
+	}
+	else if ((readResetReason() & (POWER_RESETREAS_SREQ_Msk | POWER_RESETREAS_DOG_Msk)) == 0)
+	{
+		MYLOG("VOC", "Power on reset, algorithm state age unknown");
+		return false;
+	}
+
+	voc_algorithm.set_states(voc_state.state0, voc_state.state1);
+	MYLOG("VOC", "Restored algorithm state %.2f %.2f", voc_state.state0, voc_state.state1);
+	return true;
+}
@@ -71,6 +71,10 @@ void read_rak1903()
 		MYLOG("LIGHT", "L: %.2f", g_last_light_lux);
 
 		g_solution_data.addLuminosity(LPP_CHANNEL_LIGHT, (uint32_t)(g_last_light_lux));
+
+#if HAS_EPD > 0
+		set_light_rak14000(g_last_light_lux);
+#endif
 	}
 	else
 	{
@@ -0,0 +1,339 @@
+/**
+ * @file sensor_registry.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Table of all supported sensor modules
+ *        To add a new module, write the driver functions and add
+ *        the module to sensor_drivers[]
+ * @version 0.1
+ * @date 2024-03-14
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "main.h"
+
+/**
+ * @brief Read wrapper, RAK1906 reports success, not needed here
+ *
+ */
+static void read_rak1906_values(void)
+{
+	read_rak1906();
+}
+
+/**
+ * @brief List of all supported modules
+ *        Order is the order of initialization and reading
+ *        Warm-up and conversion times are taken from the datasheets plus some margin
+ *
+ * name, found flag, init, startup, ready, read, shutdown,
+ * LPP channel, values, warm-up, conversion, power pin, I2C address, flags
+ */
+constexpr sensor_driver_s sensor_drivers[] = {
+	// RV3028, initialized before the display, the history needs the time
+	{"RAK12002", &has_rak12002, NULL, NULL, NULL, NULL, NULL,
+	 0, SENSOR_CAP_RTC, 0, 0, SENSOR_NO_POWER, 0x52, 0},
+	// SHTC3, 240 us wake-up, 12 ms conversion time
+	{"RAK1901", &has_rak1901, init_rak1901, startup_rak1901, NULL, read_rak1901, shutdown_rak1901,
+	 LPP_CHANNEL_HUMID, SENSOR_CAP_TEMP | SENSOR_CAP_HUMID, 1, 15, SENSOR_NO_POWER, 0x70, SENSOR_BOOT_READ},
+	// LPS22HB, output rate changed from one shot to 75 Hz, two samples
+	{"RAK1902", &has_rak1902, init_rak1902, startup_rak1902, NULL, read_rak1902, shutdown_rak1902,
+	 LPP_CHANNEL_PRESS, SENSOR_CAP_BARO, 10, 30, SENSOR_NO_POWER, 0x5C, 0},
+	// OPT3001, first 100 ms conversion sets the automatic range, second one is read
+	{"RAK1903", &has_rak1903, init_rak1903, startup_rak1903, NULL, read_rak1903, shutdown_rak1903,
+	 LPP_CHANNEL_LIGHT, SENSOR_CAP_LIGHT, 110, 110, SENSOR_NO_POWER, 0x44, 0},
+	// BME680, 150 ms gas heater, TPH conversion with oversampling
+	{"RAK1906", &has_rak1906, init_rak1906, startup_rak1906, NULL, read_rak1906_values, shutdown_rak1906,
+	 LPP_CHANNEL_HUMID_2, SENSOR_CAP_TEMP | SENSOR_CAP_HUMID | SENSOR_CAP_BARO, 150, 350, SENSOR_NO_POWER, 0x76, 0},
+	// VEML7700, first 400 ms integration after power save is dropped, second one is read
+	{"RAK12010", &has_rak12010, init_rak12010, startup_rak12010, NULL, read_rak12010, shutdown_rak12010,
+	 LPP_CHANNEL_LIGHT2, SENSOR_CAP_LIGHT, 500, 500, SENSOR_NO_POWER, 0x10, 0},
+	// PMSA003I, fan needs 30 seconds to stabilize, one data frame per second
+	{"RAK12039", &has_rak12039, init_rak12039, startup_rak12039, NULL, read_rak12039, shutdown_rak12039,
+	 LPP_CHANNEL_PM_1_0, SENSOR_CAP_PM, 29000, 1000, CO2_PM_POWER, 0x12, SENSOR_SLOW_WAKE},
+	// SCD30, first measurements after the start are dropped, 2 seconds measurement interval
+	{"RAK12037", &has_rak12037, init_rak12037, startup_rak12037, request_rak12037, read_rak12037, shutdown_rak12037,
+	 LPP_CHANNEL_CO2_2, SENSOR_CAP_CO2, 10000, 2000, CO2_PM_POWER, 0x61, SENSOR_SLOW_WAKE},
+	// SGP40, measured every 30 seconds by its own timer
+	{"RAK12047", &has_rak12047, init_rak12047, NULL, NULL, read_rak12047, NULL,
+	 LPP_CHANNEL_VOC, SENSOR_CAP_VOC, 0, 0, VOC_POWER, 0x59, SENSOR_ALWAYS_ON},
+};
+
+/** Number of entries in the sensor table */
+constexpr uint8_t sensor_drivers_num = sizeof(sensor_drivers) / sizeof(sensor_driver_s);
+static_assert(sensor_drivers_num <= SENSOR_DRIVERS_MAX, "Too many sensor drivers");
+
+/** I2C devices found by the bus scan, one bit per address */
+static uint8_t i2c_present[128 / 8];
+/** Time of the bus scan */
+static time_t i2c_scan_time = 0;
+/** Timer to probe slow waking modules after the bus scan */
+static SoftwareTimer probe_timer;
+/** Flag if slow waking modules are probed */
+static bool probe_running = false;
+
+/**
+ * @brief Check if a device answers on the I2C bus
+ *
+ * @param addr I2C address
+ * @return true if the device answered
+ * @return false if no answer
+ */
+static bool i2c_probe(uint8_t addr)
+{
+	Wire.beginTransmission(addr);
+	if (Wire.endTransmission() == 0)
+	{
+		i2c_present[addr / 8] |= (1 << (addr % 8));
+		return true;
+	}
+	return false;
+}
+
+/**
+ * @brief Scan all I2C addresses once and remember the found devices
+ *        Modules are only initialized if they were found by the scan
+ *
+ */
+void scan_i2c_bus(void)
+{
+	memset(i2c_present, 0, sizeof(i2c_present));
+	for (uint8_t addr = 0x08; addr < 0x78; addr++)
+	{
+		if (i2c_probe(addr))
+		{
+			MYLOG("SENS", "I2C device at 0x%02X", addr);
+		}
+	}
+	i2c_scan_time = millis();
+	MYLOG("SENS", "I2C scan done at %ld ms", i2c_scan_time);
+}
+
+/**
+ * @brief Check the result of the bus scan
+ *
+ * @param addr I2C address
+ * @return true if the device was found
+ * @return false if the device was not found
+ */
+bool i2c_found(uint8_t addr)
+{
+	return (i2c_present[addr / 8] & (1 << (addr % 8))) != 0;
+}
+
+/**
+ * @brief Initialize a module and put it into sleep mode if required
+ *        Modules with a separate power supply are shut down
+ *        after initialization if the device runs from battery
+ *
+ * @param driver sensor driver
+ */
+static void init_driver(const sensor_driver_s *driver)
+{
+	*driver->available = driver->init();
+	if (!*driver->available)
+	{
+		return;
+	}
+	MYLOG("SENS", "%s initialized", driver->name);
+
+	if ((driver->flags & SENSOR_BOOT_READ) && (driver->startup != NULL))
+	{
+		driver->startup();
+		delay(driver->warmup_ms + driver->conversion_ms);
+		driver->read();
+	}
+	if (g_is_using_battery && (driver->shutdown != NULL) &&
+		((driver->flags & SENSOR_BOOT_READ) || (driver->power_pin != SENSOR_NO_POWER)))
+	{
+		driver->shutdown();
+	}
+	AT_PRINTF("+EVT:%s OK\n", driver->name);
+}
+
+/**
+ * @brief Initialize all modules found by the bus scan
+ *        Slow waking modules that did not answer yet are probed
+ *        in the background by probe_slow_sensors()
+ *
+ */
+void init_sensors(void)
+{
+	bool missing = false;
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		const sensor_driver_s *driver = &sensor_drivers[idx];
+		if (driver->init == NULL)
+		{
+			continue;
+		}
+		if (!i2c_found(driver->i2c_addr))
+		{
+			*driver->available = false;
+			if (driver->flags & SENSOR_SLOW_WAKE)
+			{
+				missing = true;
+			}
+			continue;
+		}
+		init_driver(driver);
+	}
+
+	if (missing)
+	{
+		// Probe the missing modules from the SENSOR_REQ event, do not block the boot
+		probe_running = true;
+		probe_timer.begin(SENSOR_PROBE_INTERVAL, sensor_wakeup, NULL, true);
+		probe_timer.start();
+	}
+}
+
+/**
+ * @brief Check if slow waking modules are still probed
+ *        Their power supply must stay on until the probing is finished
+ *
+ * @return true if the probing is running
+ */
+bool slow_probe_running(void)
+{
+	return probe_running;
+}
+
+/**
+ * @brief Stop probing the slow waking modules
+ *        Modules that did not answer are treated as not connected
+ *
+ * @param power_off true to switch off the power supply of the modules on battery
+ */
+void stop_slow_probe(bool power_off)
+{
+	if (!probe_running)
+	{
+		return;
+	}
+	probe_timer.stop();
+	probe_running = false;
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		const sensor_driver_s *driver = &sensor_drivers[idx];
+		if (!(driver->flags & SENSOR_SLOW_WAKE))
+		{
+			continue;
+		}
+		if (!*driver->available)
+		{
+			MYLOG("SENS", "%s not found", driver->name);
+		}
+		if (power_off && g_is_using_battery && (driver->power_pin != SENSOR_NO_POWER))
+		{
+			digitalWrite(driver->power_pin, LOW);
+		}
+	}
+}
+
+/**
+ * @brief Probe slow waking modules that did not answer during the bus scan
+ *        Called on the SENSOR_REQ event, one probe per missing module and call.
+ *        Found modules are initialized. Probing ends when all modules are
+ *        found or SENSOR_WAKE_TIME after the bus scan.
+ *
+ */
+void probe_slow_sensors(void)
+{
+	if (!probe_running)
+	{
+		return;
+	}
+
+	bool missing = false;
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		const sensor_driver_s *driver = &sensor_drivers[idx];
+		if (!(driver->flags & SENSOR_SLOW_WAKE) || *driver->available || i2c_found(driver->i2c_addr))
+		{
+			continue;
+		}
+		if (i2c_probe(driver->i2c_addr))
+		{
+			MYLOG("SENS", "%s answered at %ld ms", driver->name, millis());
+			init_driver(driver);
+		}
+		else
+		{
+			missing = true;
+		}
+	}
+
+	if (!missing || ((millis() - i2c_scan_time) >= SENSOR_WAKE_TIME))
+	{
+		stop_slow_probe(true);
+	}
+}
+
+/**
+ * @brief Check if all sensors have finished their reading
+ *        Sensors that need more time continue in the background
+ *        and set SEND_NOW again when they are finished
+ *
+ * @return true if all sensors can be read
+ * @return false if a sensor is still busy
+ */
+bool request_sensors(void)
+{
+	bool all_ready = true;
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		const sensor_driver_s *driver = &sensor_drivers[idx];
+		if (*driver->available && (driver->ready != NULL))
+		{
+			if (!driver->ready())
+			{
+				MYLOG("SENS", "Wait for %s", driver->name);
+				all_ready = false;
+			}
+		}
+	}
+	return all_ready;
+}
+
+/**
+ * @brief Read all found sensors and put them back into sleep mode
+ *
+ */
+void read_sensors(void)
+{
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		const sensor_driver_s *driver = &sensor_drivers[idx];
+		if (!*driver->available)
+		{
+			continue;
+		}
+		if (driver->read != NULL)
+		{
+			driver->read();
+		}
+		if ((driver->shutdown != NULL) && !(driver->flags & SENSOR_ALWAYS_ON))
+		{
+			driver->shutdown();
+		}
+	}
+}
+
+/**
+ * @brief Get the measured values of all found modules
+ *
+ * @return uint16_t SENSOR_CAP_xxx of all found modules
+ */
+uint16_t sensor_caps(void)
+{
+	uint16_t caps = 0;
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		if (*sensor_drivers[idx].available)
+		{
+			caps |= sensor_drivers[idx].caps;
+		}
+	}
+	return caps;
+}
@@ -0,0 +1,155 @@
+/**
+ * @file batch_payload.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Collect sensor readings and send them in one packet
+ *
+ *        Packet layout, bits are packed MSB first:
+ *        - 1 byte header, 2 bits version, 2 bits 0, 4 bits number of readings
+ *        - per reading, oldest first:
+ *          16 bits seconds between the reading and sending the packet
+ *          16 bits bitmap and the values as in an absolute compact packet
+ *        - 0 bits to fill the last byte
+ *
+ * @version 0.1
+ * @date 2024-03-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "main.h"
+
+/** Number of readings per packet, 0 = each reading is sent */
+uint8_t g_batch_samples = 0;
+
+/** Stored readings, oldest first */
+static batch_sample_s batch[BATCH_SAMPLES_MAX];
+/** Number of stored readings */
+static uint8_t batch_num = 0;
+/** Packet buffer */
+static uint8_t batch_packet[BATCH_PACKET_MAX];
+
+/**
+ * @brief Get the number of bits of a reading in the packet
+ *
+ * @param sample stored reading
+ * @return uint16_t number of bits
+ */
+static uint16_t sample_bits(const batch_sample_s *sample)
+{
+	return BATCH_SAMPLE_HDR_BITS + compact_bits(sample->bitmap);
+}
+
+/**
+ * @brief Store a reading
+ *        If the buffer is full, the oldest reading is dropped
+ *
+ * @param lpp Cayenne LPP packet of the reading
+ * @param lpp_len size of the Cayenne LPP packet
+ * @return uint8_t BATCH_SEND if the batch should be sent now, BATCH_STORED if there is
+ *                 space for more readings, BATCH_INVALID if the reading could not be converted
+ */
+uint8_t add_batch_sample(const uint8_t *lpp, uint8_t lpp_len)
+{
+	batch_sample_s sample;
+	if (!compact_values(lpp, lpp_len, sample.values, &sample.bitmap))
+	{
+		MYLOG("BATCH", "Reading cannot be converted");
+		return BATCH_INVALID;
+	}
+	sample.time = millis() / 1000;
+
+	if (batch_num == BATCH_SAMPLES_MAX)
+	{
+		MYLOG("BATCH", "Buffer full, drop oldest reading");
+		memmove(&batch[0], &batch[1], (BATCH_SAMPLES_MAX - 1) * sizeof(batch_sample_s));
+		batch_num--;
+	}
+	batch[batch_num++] = sample;
+
+	if (batch_num >= g_batch_samples)
+	{
+		return BATCH_SEND;
+	}
+
+	// Send now if the next reading, same size as this one, would not fit
+	uint16_t bits = 8;
+	for (uint8_t idx = 0; idx < batch_num; idx++)
+	{
+		bits += sample_bits(&batch[idx]);
+	}
+	bits += sample_bits(&sample);
+	return ((bits + 7) / 8) > lora_max_payload() ? BATCH_SEND : BATCH_STORED;
+}
+
+/**
+ * @brief Put the oldest readings that fit into the packet
+ *
+ * @param max_len max packet size
+ * @param samples number of readings in the packet
+ * @return uint8_t packet size, 0 if not even one reading fits
+ */
+static uint8_t encode_batch(uint8_t max_len, uint8_t *samples)
+{
+	uint32_t now = millis() / 1000;
+	uint16_t pos = 8;
+	uint8_t num = 0;
+
+	memset(batch_packet, 0, BATCH_PACKET_MAX);
+	while (num < batch_num)
+	{
+		if (((pos + sample_bits(&batch[num]) + 7) / 8) > max_len)
+		{
+			break;
+		}
+		uint32_t offset = now - batch[num].time;
+		compact_put_bits(batch_packet, &pos, offset > 0xFFFF ? 0xFFFF : offset, 16);
+		compact_put_bits(batch_packet, &pos, batch[num].bitmap, 16);
+		compact_put_values(batch_packet, &pos, batch[num].bitmap, batch[num].values);
+		num++;
+	}
+	batch_packet[0] = (COMPACT_VERSION << 6) | num;
+
+	*samples = num;
+	return num == 0 ? 0 : (pos + 7) / 8;
+}
+
+/**
+ * @brief Send the stored readings
+ *        As many readings as fit into the max payload size are sent, the others
+ *        stay in the buffer for the next packet. If the packet is too big, it is
+ *        created again with less readings.
+ *
+ * @return lmh_error_status result of send_lora_packet()
+ */
+lmh_error_status send_batch(void)
+{
+	lmh_error_status result = LMH_ERROR;
+	uint8_t max_len = lora_max_payload();
+
+	while (batch_num != 0)
+	{
+		uint8_t samples;
+		uint8_t packet_len = encode_batch(max_len, &samples);
+		if (packet_len == 0)
+		{
+			MYLOG("BATCH", "Reading does not fit into %d bytes", max_len);
+			break;
+		}
+
+		result = send_lora_packet(batch_packet, packet_len, BATCH_FPORT);
+		if (result == LMH_SUCCESS)
+		{
+			MYLOG("BATCH", "Sent %d of %d readings in %d bytes", samples, batch_num, packet_len);
+			batch_num -= samples;
+			memmove(&batch[0], &batch[samples], batch_num * sizeof(batch_sample_s));
+			break;
+		}
+		if (result != LMH_ERROR)
+		{
+			break;
+		}
+		// Too big for the data rate, e.g. pending MAC commands or the data rate was lowered
+		max_len = packet_len - 1;
+	}
+	return result;
+}
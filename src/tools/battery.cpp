@@ -0,0 +1,116 @@
+/**
+ * @file battery.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Battery monitor, filtered battery voltage and runtime estimate
+ * @version 0.1
+ * @date 2024-03-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "main.h"
+
+/** Filtered battery voltage in mV */
+static float batt_filtered = 0.0;
+/** Flag if batt_filtered holds a value */
+static bool batt_valid = false;
+/** Filtered discharge slope in mV per hour, negative while discharging */
+static float batt_slope = 0.0;
+/** Flag if batt_slope holds a value */
+static bool slope_valid = false;
+/** Filtered voltage at the start of the slope interval */
+static float slope_ref_mv = 0.0;
+/** Start time of the slope interval */
+static uint32_t slope_ref_time = 0;
+
+/**
+ * @brief Enable the hardware oversampling and take the first sample
+ *
+ */
+void init_battery(void)
+{
+	analogOversampling(BATT_OVERSAMPLING);
+	batt_valid = false;
+	slope_valid = false;
+	sample_battery();
+}
+
+/**
+ * @brief Measure the battery voltage and update the filtered value
+ *        The slope is calculated when BATT_SLOPE_INTERVAL has passed
+ *        since the last calculation.
+ *
+ */
+void sample_battery(void)
+{
+	float sample = read_batt();
+	uint32_t now = millis();
+
+	if (!batt_valid)
+	{
+		batt_filtered = sample;
+		slope_ref_mv = sample;
+		slope_ref_time = now;
+		batt_valid = true;
+		MYLOG("BATT", "First sample %.0f mV", sample);
+		return;
+	}
+
+	batt_filtered += (sample - batt_filtered) / BATT_FILTER_WEIGHT;
+
+	uint32_t elapsed = now - slope_ref_time;
+	if (elapsed >= BATT_SLOPE_INTERVAL)
+	{
+		float slope = (batt_filtered - slope_ref_mv) * 3600000.0 / elapsed;
+		if (slope_valid)
+		{
+			batt_slope += (slope - batt_slope) / BATT_SLOPE_WEIGHT;
+		}
+		else
+		{
+			batt_slope = slope;
+			slope_valid = true;
+		}
+		slope_ref_mv = batt_filtered;
+		slope_ref_time = now;
+	}
+	MYLOG("BATT", "Sample %.0f mV, filtered %.0f mV, slope %.1f mV/h", sample, batt_filtered, batt_slope);
+}
+
+/**
+ * @brief Get the filtered battery voltage
+ *
+ * @return float battery voltage in mV
+ */
+float battery_mv(void)
+{
+	return batt_filtered;
+}
+
+/**
+ * @brief Get the discharge slope
+ *
+ * @return float slope in mV per hour, 0 if not known yet
+ */
+float battery_slope(void)
+{
+	return slope_valid ? batt_slope : 0.0;
+}
+
+/**
+ * @brief Estimate the remaining runtime from the discharge slope
+ *
+ * @return int32_t remaining runtime in hours, -1 if not known, not discharging or no battery
+ */
+int32_t battery_runtime(void)
+{
+	if (!slope_valid || (batt_slope > -0.1) || (batt_filtered < BATT_MIN_MV))
+	{
+		return -1;
+	}
+	if (batt_filtered <= BATT_EMPTY_MV)
+	{
+		return 0;
+	}
+	return (int32_t)((batt_filtered - BATT_EMPTY_MV) / -batt_slope);
+}
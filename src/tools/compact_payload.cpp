@@ -0,0 +1,372 @@
+/**
+ * @file compact_payload.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Convert the Cayenne LPP packet into the compact payload format
+ *
+ *        Packet layout, bits are packed MSB first:
+ *        - 1 byte header, 2 bits version, 1 bit difference packet, 1 bit 0, 4 bits sequence number
+ *        - 1 byte sequence number of the reference packet, only in difference packets
+ *        - 2 bytes bitmap, MSB first, bit n set if value n of compact_fields[] is included
+ *        - the included values, absolute packet: value with the bits of compact_fields[]
+ *          difference packet: 2 bits COMPACT_DELTA_xxx and 0, 4, 8 bits difference or the absolute value
+ *        - 0 bits to fill the last byte
+ *
+ * @version 0.1
+ * @date 2024-03-19
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "main.h"
+
+/** Selected payload format */
+uint8_t g_payload_format = PAYLOAD_LPP;
+
+/**
+ * @brief Values in the compact packet, the index is the bit in the bitmap
+ *        Values are in the resolution of the Cayenne LPP packet
+ *
+ * channel, bits, signed, offset
+ */
+static const compact_field_s compact_fields[] = {
+	{LPP_CHANNEL_BATT, 9, false, 0},		// 0.01 V, 0 to 5.11 V
+	{LPP_CHANNEL_HUMID, 8, false, 0},		// 0.5 %RH
+	{LPP_CHANNEL_TEMP, 11, true, 0},		// 0.1 °C, -102.4 to 102.3 °C
+	{LPP_CHANNEL_PRESS, 13, false, 3000},	// 0.1 hPa, 300.0 to 1119.1 hPa
+	{LPP_CHANNEL_LIGHT, 16, false, 0},		// 1 lux
+	{LPP_CHANNEL_HUMID_2, 8, false, 0},		// 0.5 %RH
+	{LPP_CHANNEL_TEMP_2, 11, true, 0},		// 0.1 °C, -102.4 to 102.3 °C
+	{LPP_CHANNEL_PRESS_2, 13, false, 3000}, // 0.1 hPa, 300.0 to 1119.1 hPa
+	{LPP_CHANNEL_LIGHT2, 16, false, 0},		// 1 lux
+	{LPP_CHANNEL_VOC, 9, false, 0},			// VOC index 0 to 500
+	{LPP_CHANNEL_CO2_2, 14, false, 0},		// 1 ppm, 0 to 16383 ppm
+	{LPP_CHANNEL_PM_1_0, 10, false, 0},		// 1 ug/m3, 0 to 1023 ug/m3
+	{LPP_CHANNEL_PM_2_5, 10, false, 0},		// 1 ug/m3, 0 to 1023 ug/m3
+	{LPP_CHANNEL_PM_10_0, 10, false, 0},	// 1 ug/m3, 0 to 1023 ug/m3
+	{LPP_CHANNEL_SWITCH, 1, false, 0},		// Room occupied
+};
+
+/** Number of values in compact_fields[] */
+constexpr uint8_t compact_fields_num = sizeof(compact_fields) / sizeof(compact_field_s);
+static_assert(compact_fields_num <= COMPACT_FIELDS_MAX, "Too many compact values");
+
+/** Number of packets created */
+static uint32_t packet_count = 0;
+/** Values of the last created packet, without offset */
+static int32_t new_values[COMPACT_FIELDS_MAX];
+/** Bitmap of the last created packet */
+static uint16_t new_bitmap = 0;
+/** Flag if the last created packet was an absolute packet */
+static bool new_absolute = false;
+/** Values of the packet in the TX cycle, without offset */
+static int32_t sent_values[COMPACT_FIELDS_MAX];
+/** Bitmap of the packet in the TX cycle */
+static uint16_t sent_bitmap = 0;
+/** Number of the packet in the TX cycle */
+static uint32_t sent_count = 0;
+/** Flag if the packet in the TX cycle was sent confirmed */
+static bool sent_confirmed = false;
+/** Flag if a compact packet was enqueued and its TX cycle is not finished */
+static bool sent_pending = false;
+/** Values of the reference packet, without offset */
+static int32_t ref_values[COMPACT_FIELDS_MAX];
+/** Bitmap of the reference packet */
+static uint16_t ref_bitmap = 0;
+/** Number of the reference packet */
+static uint32_t ref_count = 0;
+/** Flag if a reference packet was acknowledged */
+static bool ref_valid = false;
+
+/**
+ * @brief Get the size of a Cayenne LPP value
+ *
+ * @param type Cayenne LPP data type
+ * @return int8_t size in bytes, -1 if the type is not used by this device
+ */
+int8_t lpp_size(uint8_t type)
+{
+	switch (type)
+	{
+	case 0:	  // Digital input
+	case 1:	  // Digital output
+	case 102: // Presence
+	case 104: // Humidity
+	case 120: // Percentage
+		return 1;
+	case 2:	  // Analog input
+	case 101: // Illuminance
+	case 103: // Temperature
+	case 115: // Barometer
+	case 116: // Voltage
+	case 125: // Concentration
+	case 138: // VOC index
+		return 2;
+	default:
+		return -1;
+	}
+}
+
+/**
+ * @brief Remove the offset and limit the value to the bits of the value
+ *
+ * @param field value description
+ * @param value Cayenne LPP value
+ * @return int32_t value as sent in the compact packet
+ */
+static int32_t field_value(const compact_field_s *field, int32_t value)
+{
+	int32_t min_value = field->is_signed ? -(1L << (field->bits - 1)) : 0;
+	int32_t max_value = field->is_signed ? (1L << (field->bits - 1)) - 1 : (1L << field->bits) - 1;
+
+	value -= field->offset;
+	if (value < min_value)
+	{
+		return min_value;
+	}
+	if (value > max_value)
+	{
+		return max_value;
+	}
+	return value;
+}
+
+/**
+ * @brief Add bits to the packet, MSB first
+ *        The packet must be cleared before
+ *
+ * @param packet packet buffer
+ * @param pos bit position, updated
+ * @param value bits to add
+ * @param bits number of bits
+ */
+void compact_put_bits(uint8_t *packet, uint16_t *pos, uint32_t value, uint8_t bits)
+{
+	for (int8_t bit = bits - 1; bit >= 0; bit--)
+	{
+		if (value & (1UL << bit))
+		{
+			packet[*pos / 8] |= 0x80 >> (*pos % 8);
+		}
+		(*pos)++;
+	}
+}
+
+/**
+ * @brief Get the values of the compact packet from the Cayenne LPP packet
+ *
+ * @param lpp Cayenne LPP packet
+ * @param lpp_len size of the Cayenne LPP packet
+ * @param values values without offset, COMPACT_FIELDS_MAX entries
+ * @param bitmap bitmap of the found values
+ * @return true if the Cayenne LPP packet could be converted
+ * @return false if the Cayenne LPP packet has an unknown data type
+ */
+bool compact_values(const uint8_t *lpp, uint8_t lpp_len, int32_t *values, uint16_t *bitmap)
+{
+	*bitmap = 0;
+	uint8_t lpp_pos = 0;
+	while (lpp_pos + 2 <= lpp_len)
+	{
+		uint8_t channel = lpp[lpp_pos];
+		uint8_t type = lpp[lpp_pos + 1];
+		int8_t size = lpp_size(type);
+		if ((size < 0) || (lpp_pos + 2 + size > lpp_len))
+		{
+			MYLOG("PAYL", "Unknown LPP type %d on channel %d", type, channel);
+			return false;
+		}
+		int32_t value = lpp[lpp_pos + 2];
+		if (size == 2)
+		{
+			value = (value << 8) | lpp[lpp_pos + 3];
+			if ((type == 2) || (type == 103))
+			{
+				value = (int16_t)value;
+			}
+		}
+		lpp_pos += 2 + size;
+
+		// Values without an entry in compact_fields[] are not sent
+		for (uint8_t idx = 0; idx < compact_fields_num; idx++)
+		{
+			if (compact_fields[idx].channel == channel)
+			{
+				values[idx] = field_value(&compact_fields[idx], value);
+				*bitmap |= 1 << idx;
+				break;
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Get the number of bits of the values as absolute values
+ *
+ * @param bitmap bitmap of the values
+ * @return uint16_t number of bits
+ */
+uint16_t compact_bits(uint16_t bitmap)
+{
+	uint16_t bits = 0;
+	for (uint8_t idx = 0; idx < compact_fields_num; idx++)
+	{
+		if (bitmap & (1 << idx))
+		{
+			bits += compact_fields[idx].bits;
+		}
+	}
+	return bits;
+}
+
+/**
+ * @brief Add the values as absolute values to the packet
+ *
+ * @param packet packet buffer
+ * @param pos bit position, updated
+ * @param bitmap bitmap of the values
+ * @param values values without offset
+ */
+void compact_put_values(uint8_t *packet, uint16_t *pos, uint16_t bitmap, const int32_t *values)
+{
+	for (uint8_t idx = 0; idx < compact_fields_num; idx++)
+	{
+		if (bitmap & (1 << idx))
+		{
+			uint8_t bits = compact_fields[idx].bits;
+			compact_put_bits(packet, pos, (uint32_t)values[idx] & ((1UL << bits) - 1), bits);
+		}
+	}
+}
+
+/**
+ * @brief Convert the Cayenne LPP packet into a compact packet
+ *        With PAYLOAD_DELTA the values are sent as difference to the last
+ *        acknowledged packet if it is not older than COMPACT_DELTA_MAX packets
+ *
+ * @param lpp Cayenne LPP packet
+ * @param lpp_len size of the Cayenne LPP packet
+ * @param packet buffer for the compact packet, COMPACT_SIZE_MAX bytes
+ * @return uint8_t size of the compact packet, 0 if the Cayenne LPP packet could not be converted
+ */
+uint8_t encode_compact(const uint8_t *lpp, uint8_t lpp_len, uint8_t *packet)
+{
+	int32_t values[COMPACT_FIELDS_MAX];
+	uint16_t bitmap;
+
+	if (!compact_values(lpp, lpp_len, values, &bitmap))
+	{
+		return 0;
+	}
+
+	packet_count++;
+	bool delta = (g_payload_format == PAYLOAD_DELTA) && ref_valid && ((packet_count - ref_count) <= COMPACT_DELTA_MAX);
+
+	memset(packet, 0, COMPACT_SIZE_MAX);
+	packet[0] = (COMPACT_VERSION << 6) | (delta ? COMPACT_HDR_DELTA : 0) | (packet_count & COMPACT_HDR_SEQ);
+	uint16_t pos = 8;
+	if (delta)
+	{
+		packet[1] = ref_count & COMPACT_HDR_SEQ;
+		pos += 8;
+	}
+	compact_put_bits(packet, &pos, bitmap, 16);
+
+	if (!delta)
+	{
+		compact_put_values(packet, &pos, bitmap, values);
+	}
+	for (uint8_t idx = 0; delta && (idx < compact_fields_num); idx++)
+	{
+		if ((bitmap & (1 << idx)) == 0)
+		{
+			continue;
+		}
+		uint8_t bits = compact_fields[idx].bits;
+		uint32_t mask = (1UL << bits) - 1;
+
+		if ((ref_bitmap & (1 << idx)) == 0)
+		{
+			compact_put_bits(packet, &pos, COMPACT_DELTA_FULL, 2);
+			compact_put_bits(packet, &pos, (uint32_t)values[idx] & mask, bits);
+			continue;
+		}
+		int32_t diff = values[idx] - ref_values[idx];
+		uint32_t zigzag = ((uint32_t)diff << 1) ^ (uint32_t)(diff >> 31);
+		if (zigzag == 0)
+		{
+			compact_put_bits(packet, &pos, COMPACT_DELTA_SAME, 2);
+		}
+		else if ((zigzag < 16) && (bits > 4))
+		{
+			compact_put_bits(packet, &pos, COMPACT_DELTA_4, 2);
+			compact_put_bits(packet, &pos, zigzag, 4);
+		}
+		else if ((zigzag < 256) && (bits > 8))
+		{
+			compact_put_bits(packet, &pos, COMPACT_DELTA_8, 2);
+			compact_put_bits(packet, &pos, zigzag, 8);
+		}
+		else
+		{
+			compact_put_bits(packet, &pos, COMPACT_DELTA_FULL, 2);
+			compact_put_bits(packet, &pos, (uint32_t)values[idx] & mask, bits);
+		}
+	}
+
+	memcpy(new_values, values, sizeof(new_values));
+	new_bitmap = bitmap;
+	new_absolute = !delta;
+
+	uint8_t packet_len = (pos + 7) / 8;
+	MYLOG("PAYL", "LPP %d bytes, compact %d bytes%s", lpp_len, packet_len, delta ? ", difference" : "");
+	return packet_len;
+}
+
+/**
+ * @brief Check if the last compact packet should be sent confirmed
+ *        With PAYLOAD_DELTA the absolute packets are the reference for
+ *        the next packets, the server has to acknowledge them
+ *
+ * @return true if the packet should be sent confirmed
+ * @return false if the packet can be sent unconfirmed
+ */
+bool compact_needs_ack(void)
+{
+	return (g_payload_format == PAYLOAD_DELTA) && new_absolute;
+}
+
+/**
+ * @brief Remember the last created packet after it was enqueued
+ *        Packets that were not enqueued, e.g. LMH_BUSY, never become the reference
+ *
+ * @param confirmed true if the packet was sent confirmed
+ */
+void compact_tx_started(bool confirmed)
+{
+	memcpy(sent_values, new_values, sizeof(sent_values));
+	sent_bitmap = new_bitmap;
+	sent_count = packet_count;
+	sent_confirmed = confirmed;
+	sent_pending = true;
+}
+
+/**
+ * @brief Update the reference packet after a LoRaWAN TX cycle
+ *
+ * @param acked true if the TX cycle finished with an ACK
+ */
+void compact_tx_finished(bool acked)
+{
+	bool pending = sent_pending;
+	sent_pending = false;
+	if (!acked || !pending || !sent_confirmed || (sent_count == ref_count))
+	{
+		return;
+	}
+	memcpy(ref_values, sent_values, sizeof(ref_values));
+	ref_bitmap = sent_bitmap;
+	ref_count = sent_count;
+	ref_valid = true;
+	MYLOG("PAYL", "Reference packet %ld", ref_count & COMPACT_HDR_SEQ);
+}
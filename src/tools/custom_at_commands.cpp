@@ -25,6 +25,36 @@ static const char ui_name[] = "UI";
 /** File to save UI status */
 File ui_check(InternalFS);
 
+/** Filename to save graph time base */
+static const char graph_name[] = "GRAPH";
+
+/** File to save graph time base */
+File graph_check(InternalFS);
+
+/** Filename to save RTC alignment setting */
+static const char align_name[] = "ALIGN";
+
+/** File to save RTC alignment setting */
+File align_check(InternalFS);
+
+/** Filename to save payload format */
+static const char payload_name[] = "PAYLOAD";
+
+/** File to save payload format */
+File payload_check(InternalFS);
+
+/** Filename to save number of readings per batch */
+static const char batch_name[] = "BATCH";
+
+/** File to save number of readings per batch */
+File batch_check(InternalFS);
+
+/** Filename to save value priorities */
+static const char prio_name[] = "PRIO";
+
+/** File to save value priorities */
+File prio_check(InternalFS);
+
 /*****************************************
  * Set UI commands
  *****************************************/
@@ -60,6 +90,71 @@ int at_query_ui(void)
 	return AT_SUCCESS;
 }
 
+/**
+ * @brief Set graph time base
+ *
+ * @param str time base as String, 0 = per sample, 1 = per hour, 2 = per day
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_FAIL if invalid value
+ */
+static int at_set_graph(char *str)
+{
+	long new_tier = strtol(str, NULL, 0);
+
+	if ((new_tier < TIER_RAW) || (new_tier >= TIER_NUM))
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+	g_graph_tier = new_tier;
+	save_graph_settings(new_tier);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query graph time base
+ *
+ * @return int AT_SUCCESS
+ */
+int at_query_graph(void)
+{
+	snprintf(g_at_query_buf, ATQUERY_SIZE, "%d", g_graph_tier);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query display refresh counters
+ *
+ * @return int AT_SUCCESS
+ */
+int at_query_epd(void)
+{
+	snprintf(g_at_query_buf, ATQUERY_SIZE, "Full %ld, partial %ld, skipped %ld, last %ld bytes %ld ms busy %ld ms, total %ld bytes blocked %ld ms",
+			 display.full_count, display.partial_count, display.skip_count,
+			 display.last_bytes, display.last_time, display.last_busy,
+			 display.total_bytes, display.total_blocked);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Render a screen and send it as image
+ *
+ * @param str screen as String, 0 = scientific, 1 = iconized, 2 = status, 3 = start screen
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_NUM if invalid value, AT_ERRNO_EXEC_FAIL if no display
+ */
+static int at_set_frame(char *str)
+{
+	long screen = strtol(str, NULL, 0);
+
+	if ((screen < 0) || (screen > 3))
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+	if (!dump_frame_rak14000(screen))
+	{
+		return AT_ERRNO_EXEC_FAIL;
+	}
+	return AT_SUCCESS;
+}
+
 /**
  * @brief List of all available commands with short help and pointer to functions
  *
@@ -68,6 +163,9 @@ atcmd_t g_user_at_cmd_list_ui[] = {
 	/*|    CMD    |     AT+CMD?      |    AT+CMD=?    |  AT+CMD=value |  AT+CMD  | Permissions |*/
 	// Module commands
 	{"+UI", "Switch display UI, 0 = scientific, 1 = iconized", at_query_ui, at_set_ui, NULL, "RW"},
+	{"+GRAPH", "Graph time base, 0 = per sample, 1 = per hour, 2 = per day", at_query_graph, at_set_graph, NULL, "RW"},
+	{"+EPD", "Get display refresh counters", at_query_epd, NULL, at_query_epd, "R"},
+	{"+FRAME", "Send screen as PBM, 0 = scientific, 1 = iconized, 2 = status, 3 = start", NULL, at_set_frame, NULL, "W"},
 };
 
 /**
@@ -110,6 +208,49 @@ void save_ui_settings(uint8_t ui_selected)
 	}
 }
 
+/**
+ * @brief Read saved graph time base
+ *
+ */
+void read_graph_settings(void)
+{
+	g_graph_tier = TIER_RAW;
+	if (InternalFS.exists(graph_name))
+	{
+		char tier = '0';
+		graph_check.open(graph_name, FILE_O_READ);
+		graph_check.read(&tier, 1);
+		graph_check.close();
+		if ((tier > '0') && (tier < '0' + TIER_NUM))
+		{
+			g_graph_tier = tier - '0';
+		}
+	}
+	MYLOG("USR_AT", "Graph time base %d", g_graph_tier);
+}
+
+/**
+ * @brief Save the graph time base
+ *
+ */
+void save_graph_settings(uint8_t graph_tier)
+{
+	if (graph_tier == TIER_RAW)
+	{
+		InternalFS.remove(graph_name);
+		MYLOG("USR_AT", "Remove File for graph time base 0");
+	}
+	else
+	{
+		char tier = '0' + graph_tier;
+		InternalFS.remove(graph_name);
+		graph_check.open(graph_name, FILE_O_WRITE);
+		graph_check.write((uint8_t *)&tier, 1);
+		graph_check.close();
+		MYLOG("USR_AT", "Created File for graph time base %d", graph_tier);
+	}
+}
+
 /*****************************************
  * Query modules AT commands
  *****************************************/
@@ -122,16 +263,293 @@ void save_ui_settings(uint8_t ui_selected)
 int at_query_modules(void)
 {
 	// announce_modules();
-	snprintf(g_at_query_buf, ATQUERY_SIZE, "%s%s%s%s%s%s%s%s%s%s",
-			 has_rak1901 ? "RAK1901 " : "",
-			 has_rak1902 ? "RAK1902 " : "",
-			 has_rak1903 ? "RAK1903 " : "",
-			 has_rak1906 ? "RAK1906 " : "",
-			 has_rak12002 ? "RAK12002 " : "",
-			 has_rak12010 ? "RAK12010 " : "",
-			 has_rak12019 ? "RAK12019 " : "",
-			 has_rak12037 ? "RAK12037 " : "",
-			 has_rak12047 ? "RAK12047 " : "");
+	g_at_query_buf[0] = 0;
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		if (*sensor_drivers[idx].available)
+		{
+			strncat(g_at_query_buf, sensor_drivers[idx].name, ATQUERY_SIZE - strlen(g_at_query_buf) - 2);
+			strcat(g_at_query_buf, " ");
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Query boot times
+ *
+ * @return int 0
+ */
+int at_query_boot(void)
+{
+	snprintf(g_at_query_buf, ATQUERY_SIZE, "Init %ld ms, first uplink %ld ms", g_boot_init_time, g_boot_uplink_time);
+	return 0;
+}
+
+/**
+ * @brief Set payload format
+ *
+ * @param str format as String, 0 = Cayenne LPP, 1 = compact, 2 = compact with differences
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_NUM if invalid value
+ */
+static int at_set_payload(char *str)
+{
+	long new_format = strtol(str, NULL, 0);
+
+	if ((new_format < PAYLOAD_LPP) || (new_format >= PAYLOAD_NUM))
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+	g_payload_format = new_format;
+	save_payload_settings(new_format);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query payload format
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_payload(void)
+{
+	snprintf(g_at_query_buf, ATQUERY_SIZE, "%d", g_payload_format);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Read saved payload format
+ *
+ */
+void read_payload_settings(void)
+{
+	g_payload_format = PAYLOAD_LPP;
+	if (InternalFS.exists(payload_name))
+	{
+		char format = '0';
+		payload_check.open(payload_name, FILE_O_READ);
+		payload_check.read(&format, 1);
+		payload_check.close();
+		if ((format > '0') && (format < '0' + PAYLOAD_NUM))
+		{
+			g_payload_format = format - '0';
+		}
+	}
+	MYLOG("USR_AT", "Payload format %d", g_payload_format);
+}
+
+/**
+ * @brief Save the payload format
+ *
+ */
+void save_payload_settings(uint8_t format)
+{
+	if (format == PAYLOAD_LPP)
+	{
+		InternalFS.remove(payload_name);
+		MYLOG("USR_AT", "Remove File for payload format 0");
+	}
+	else
+	{
+		char format_char = '0' + format;
+		InternalFS.remove(payload_name);
+		payload_check.open(payload_name, FILE_O_WRITE);
+		payload_check.write((uint8_t *)&format_char, 1);
+		payload_check.close();
+		MYLOG("USR_AT", "Created File for payload format %d", format);
+	}
+}
+
+/**
+ * @brief Set number of readings per batch
+ *
+ * @param str number of readings as String, 0 = off, 2 to BATCH_SAMPLES_MAX
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_NUM if invalid value
+ */
+static int at_set_batch(char *str)
+{
+	long new_samples = strtol(str, NULL, 0);
+
+	if ((new_samples < 0) || (new_samples == 1) || (new_samples > BATCH_SAMPLES_MAX))
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+	g_batch_samples = new_samples;
+	save_batch_settings(new_samples);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query number of readings per batch
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_batch(void)
+{
+	snprintf(g_at_query_buf, ATQUERY_SIZE, "%d", g_batch_samples);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Read saved number of readings per batch
+ *
+ */
+void read_batch_settings(void)
+{
+	g_batch_samples = 0;
+	if (InternalFS.exists(batch_name))
+	{
+		uint8_t samples = 0;
+		batch_check.open(batch_name, FILE_O_READ);
+		batch_check.read(&samples, 1);
+		batch_check.close();
+		if ((samples > 1) && (samples <= BATCH_SAMPLES_MAX))
+		{
+			g_batch_samples = samples;
+		}
+	}
+	MYLOG("USR_AT", "Readings per batch %d", g_batch_samples);
+}
+
+/**
+ * @brief Save the number of readings per batch
+ *
+ */
+void save_batch_settings(uint8_t samples)
+{
+	InternalFS.remove(batch_name);
+	if (samples == 0)
+	{
+		MYLOG("USR_AT", "Remove File for batch");
+	}
+	else
+	{
+		batch_check.open(batch_name, FILE_O_WRITE);
+		batch_check.write(&samples, 1);
+		batch_check.close();
+		MYLOG("USR_AT", "Created File for batch with %d readings", samples);
+	}
+}
+
+/**
+ * @brief Set the channels sent first if a packet is too big for the data rate
+ *
+ * @param str Cayenne LPP channels as String, highest priority first, separated by ':', 0 = default
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_VAL if invalid value, AT_ERRNO_PARA_NUM if too many channels
+ */
+static int at_set_prio(char *str)
+{
+	uint8_t channels[PACKER_PRIO_MAX];
+	uint8_t num = 0;
+
+	char *param = strtok(str, ":");
+	while (param != NULL)
+	{
+		char *end;
+		long channel = strtol(param, &end, 0);
+		if ((end == param) || (*end != 0) || (channel < 0) || (channel > 255))
+		{
+			return AT_ERRNO_PARA_VAL;
+		}
+		if (channel == 0)
+		{
+			// Back to the default priorities, only allowed as the single parameter
+			if ((num != 0) || (strtok(NULL, ":") != NULL))
+			{
+				return AT_ERRNO_PARA_VAL;
+			}
+			InternalFS.remove(prio_name);
+			read_prio_settings();
+			return AT_SUCCESS;
+		}
+		if (num == PACKER_PRIO_MAX)
+		{
+			return AT_ERRNO_PARA_NUM;
+		}
+		channels[num++] = channel;
+		param = strtok(NULL, ":");
+	}
+	if (num == 0)
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+
+	memcpy(g_lpp_priority, channels, num);
+	g_lpp_priority_num = num;
+	save_prio_settings();
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query the channels sent first if a packet is too big for the data rate
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_prio(void)
+{
+	int len = 0;
+	g_at_query_buf[0] = 0;
+	for (uint8_t idx = 0; (idx < g_lpp_priority_num) && (len < ATQUERY_SIZE); idx++)
+	{
+		len += snprintf(&g_at_query_buf[len], ATQUERY_SIZE - len, idx == 0 ? "%d" : ":%d", g_lpp_priority[idx]);
+	}
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Read saved value priorities
+ *        Without saved priorities CO2, PM2.5 and VOC are sent first
+ *
+ */
+void read_prio_settings(void)
+{
+	g_lpp_priority[0] = LPP_CHANNEL_CO2_2;
+	g_lpp_priority[1] = LPP_CHANNEL_PM_2_5;
+	g_lpp_priority[2] = LPP_CHANNEL_VOC;
+	g_lpp_priority_num = 3;
+	if (InternalFS.exists(prio_name))
+	{
+		uint8_t channels[PACKER_PRIO_MAX];
+		prio_check.open(prio_name, FILE_O_READ);
+		int num = prio_check.read(channels, PACKER_PRIO_MAX);
+		prio_check.close();
+		if ((num > 0) && (num <= PACKER_PRIO_MAX))
+		{
+			memcpy(g_lpp_priority, channels, num);
+			g_lpp_priority_num = num;
+		}
+	}
+	MYLOG("USR_AT", "Priority list with %d channels", g_lpp_priority_num);
+}
+
+/**
+ * @brief Save the value priorities
+ *
+ */
+void save_prio_settings(void)
+{
+	InternalFS.remove(prio_name);
+	prio_check.open(prio_name, FILE_O_WRITE);
+	prio_check.write(g_lpp_priority, g_lpp_priority_num);
+	prio_check.close();
+	MYLOG("USR_AT", "Created File for priority list with %d channels", g_lpp_priority_num);
+}
+
+/**
+ * @brief Query battery monitor
+ *
+ * @return int 0
+ */
+int at_query_battery(void)
+{
+	int32_t runtime = battery_runtime();
+	if (runtime < 0)
+	{
+		snprintf(g_at_query_buf, ATQUERY_SIZE, "%.0f mV, slope %.1f mV/h, runtime unknown", battery_mv(), battery_slope());
+	}
+	else
+	{
+		snprintf(g_at_query_buf, ATQUERY_SIZE, "%.0f mV, slope %.1f mV/h, runtime %ld h", battery_mv(), battery_slope(), runtime);
+	}
 	return 0;
 }
 
@@ -143,6 +561,11 @@ atcmd_t g_user_at_cmd_list_modules[] = {
 	/*|    CMD    |     AT+CMD?      |    AT+CMD=?    |  AT+CMD=value |  AT+CMD  | Permissions |*/
 	// Module commands
 	{"+MOD", "List all connected I2C devices", at_query_modules, NULL, at_query_modules, "R"},
+	{"+BOOT", "Get time from boot to end of init and to first uplink in ms", at_query_boot, NULL, at_query_boot, "R"},
+	{"+VBAT", "Get filtered battery voltage, discharge slope and remaining runtime", at_query_battery, NULL, at_query_battery, "R"},
+	{"+PAYLOAD", "Payload format, 0 = Cayenne LPP, 1 = compact, 2 = compact with differences", at_query_payload, at_set_payload, NULL, "RW"},
+	{"+BATCH", "Readings per packet, 0 = off, 2 to 15", at_query_batch, at_set_batch, NULL, "RW"},
+	{"+PRIO", "Channels sent first if the packet is too big, separated by ':', 0 = default", at_query_prio, at_set_prio, NULL, "RW"},
 };
 
 /*****************************************
@@ -248,12 +671,72 @@ static int at_query_rtc(void)
 	return 0;
 }
 
+/**
+ * @brief Enable or disable the alignment of the readings to the RTC time
+ *
+ * @param str 0 = readings started by the send interval timer, 1 = readings aligned to the RTC time
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_NUM if invalid value
+ */
+static int at_set_align(char *str)
+{
+	long new_align = strtol(str, NULL, 0);
+
+	if ((new_align < 0) || (new_align > 1))
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+	set_align_rak12002(new_align == 1);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query alignment of the readings to the RTC time
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_align(void)
+{
+	snprintf(g_at_query_buf, ATQUERY_SIZE, "%d", g_rtc_align ? 1 : 0);
+	return AT_SUCCESS;
+}
+
 atcmd_t g_user_at_cmd_list_rtc[] = {
 	/*|    CMD    |     AT+CMD?      |    AT+CMD=?    |  AT+CMD=value |  AT+CMD  | Permissions |*/
 	// RTC commands
 	{"+RTC", "Get/Set RTC time and date", at_query_rtc, at_set_rtc, NULL, "RW"},
+	{"+ALIGN", "Align readings to RTC time, 0 = off, 1 = on", at_query_align, at_set_align, NULL, "RW"},
 };
 
+/**
+ * @brief Read saved RTC alignment setting
+ *
+ */
+void read_align_settings(void)
+{
+	g_rtc_align = InternalFS.exists(align_name);
+	MYLOG("USR_AT", "RTC alignment %s", g_rtc_align ? "on" : "off");
+}
+
+/**
+ * @brief Save the RTC alignment setting
+ *
+ */
+void save_align_settings(bool align)
+{
+	if (align)
+	{
+		align_check.open(align_name, FILE_O_WRITE);
+		align_check.write("1");
+		align_check.close();
+		MYLOG("USR_AT", "Created File for RTC alignment");
+	}
+	else
+	{
+		InternalFS.remove(align_name);
+		MYLOG("USR_AT", "Remove File for RTC alignment");
+	}
+}
+
 /*****************************************
  * Set CO2 commands
  *****************************************/
@@ -0,0 +1,482 @@
+/**
+ * @file history_log.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Persistent log of the sensor value history
+ *        Records are collected in RAM and appended in page sized batches
+ *        to the current segment file. When a segment is full, the oldest
+ *        segment is deleted and reused. Each segment starts with a header
+ *        record that holds an increasing sequence number.
+ *        On boot the segments are replayed oldest to newest. Replay of a
+ *        segment stops at the first record with a wrong CRC, so the time
+ *        to recover is limited by the size of the log.
+ *        The log holds only a few days of samples, too short for the
+ *        hourly and daily aggregates of VOC and CO2. These are saved in
+ *        a separate file whenever a time slot was closed and restored
+ *        before the log is replayed.
+ * @version 0.1
+ * @date 2024-03-11
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "main.h"
+#include <Adafruit_LittleFS.h>
+#include <InternalFileSystem.h>
+using namespace Adafruit_LittleFS_Namespace;
+
+/** File for log access */
+File log_file(InternalFS);
+
+/** Number of records in a write batch */
+#define HIST_BATCH_NUM (HIST_BATCH_SIZE / sizeof(history_record_s))
+
+/** Write buffer, used as read buffer during replay */
+static history_record_s log_batch[HIST_BATCH_NUM];
+/** Number of records in the write buffer */
+static uint8_t log_batch_num = 0;
+/** Segment file that is currently written */
+static uint8_t log_segment = HIST_SEG_NUM - 1;
+/** Sequence number of the current segment */
+static uint32_t log_sequence = 0;
+/** Bytes in the current segment */
+static uint32_t log_segment_size = 0;
+/** Flag to start a new segment with the next write */
+static bool log_new_segment = true;
+/** Flag if the aggregates have to be saved with the next write */
+static bool log_tiers_changed = false;
+
+/** Filename of the saved hourly and daily aggregates */
+static const char tier_name[] = "HTIER";
+
+/**
+ * @brief Get the filename of a segment
+ *
+ * @param segment segment number
+ * @param name buffer for the filename, at least 8 bytes
+ */
+static void segment_name(uint8_t segment, char *name)
+{
+	snprintf(name, 8, "HIST%d", segment);
+}
+
+/**
+ * @brief CRC8 over a buffer, same polynomial as the Sensirion sensors
+ *
+ * @param crc CRC of the previous data, 0xFF for the first buffer
+ * @param data data to add
+ * @param len number of bytes
+ * @return uint8_t updated CRC
+ */
+static uint8_t crc8_update(uint8_t crc, const uint8_t *data, uint16_t len)
+{
+	for (uint16_t idx = 0; idx < len; idx++)
+	{
+		crc ^= data[idx];
+		for (uint8_t bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+		}
+	}
+	return crc;
+}
+
+/**
+ * @brief CRC8 over a record
+ *
+ * @param record record to check
+ * @return uint8_t CRC of all bytes except the CRC field
+ */
+static uint8_t record_crc(history_record_s *record)
+{
+	return crc8_update(0xFF, (uint8_t *)record, sizeof(history_record_s) - 1);
+}
+
+/**
+ * @brief Write the hourly or daily aggregates of a series to the tier file
+ *
+ * @param history value history of the series
+ * @param series series ID, HIST_VOC or HIST_CO2
+ * @param tier TIER_HOUR or TIER_DAY
+ * @param crc running CRC of the file, updated
+ */
+template <class H>
+static void save_tier(H &history, uint8_t series, uint8_t tier, uint8_t *crc)
+{
+	tier_header_s header;
+	tier_entry_s entry;
+	const typename H::Tier &aggregates = history.tier(tier);
+
+	header.last_slot = aggregates.last_slot();
+	header.num = aggregates.mean.size();
+	header.series = series;
+	header.tier = tier;
+	log_file.write((uint8_t *)&header, sizeof(tier_header_s));
+	*crc = crc8_update(*crc, (uint8_t *)&header, sizeof(tier_header_s));
+
+	for (uint16_t idx = 0; idx < header.num; idx++)
+	{
+		entry.mean = aggregates.mean.code(idx);
+		entry.low = aggregates.low.code(idx);
+		entry.high = aggregates.high.code(idx);
+		log_file.write((uint8_t *)&entry, sizeof(tier_entry_s));
+		*crc = crc8_update(*crc, (uint8_t *)&entry, sizeof(tier_entry_s));
+	}
+}
+
+/**
+ * @brief Save the hourly and daily aggregates of VOC and CO2
+ *        The file ends with a CRC8 over all bytes
+ *
+ */
+static void save_tiers(void)
+{
+	uint8_t crc = 0xFF;
+
+	InternalFS.remove(tier_name);
+	if (!log_file.open(tier_name, FILE_O_WRITE))
+	{
+		return;
+	}
+	save_tier(voc_values, HIST_VOC, TIER_HOUR, &crc);
+	save_tier(voc_values, HIST_VOC, TIER_DAY, &crc);
+	save_tier(co2_values, HIST_CO2, TIER_HOUR, &crc);
+	save_tier(co2_values, HIST_CO2, TIER_DAY, &crc);
+	log_file.write(&crc, 1);
+	log_file.close();
+
+	log_tiers_changed = false;
+	MYLOG("HIST", "Saved aggregates");
+}
+
+/**
+ * @brief Read the aggregates of one series and tier from the tier file
+ *
+ * @param restore true to add the aggregates to the value history, false to only calculate the CRC
+ * @param crc running CRC of the file, updated
+ * @return true if a complete block was read
+ */
+static bool restore_tier(bool restore, uint8_t *crc)
+{
+	tier_header_s header;
+	tier_entry_s entry;
+
+	if (log_file.read((void *)&header, sizeof(tier_header_s)) != sizeof(tier_header_s))
+	{
+		return false;
+	}
+	*crc = crc8_update(*crc, (uint8_t *)&header, sizeof(tier_header_s));
+	if ((header.num > num_values) || ((header.tier != TIER_HOUR) && (header.tier != TIER_DAY)))
+	{
+		return false;
+	}
+
+	for (uint16_t idx = 0; idx < header.num; idx++)
+	{
+		if (log_file.read((void *)&entry, sizeof(tier_entry_s)) != sizeof(tier_entry_s))
+		{
+			return false;
+		}
+		*crc = crc8_update(*crc, (uint8_t *)&entry, sizeof(tier_entry_s));
+		if (!restore)
+		{
+			continue;
+		}
+		if (header.series == HIST_VOC)
+		{
+			voc_values.tier(header.tier).restore(header.last_slot, entry.mean, entry.low, entry.high);
+		}
+		else if (header.series == HIST_CO2)
+		{
+			co2_values.tier(header.tier).restore(header.last_slot, entry.mean, entry.low, entry.high);
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Restore the hourly and daily aggregates of VOC and CO2
+ *        The file is read twice, the aggregates are only restored if the CRC matches
+ *
+ */
+static void restore_tiers(void)
+{
+	for (uint8_t pass = 0; pass < 2; pass++)
+	{
+		uint8_t crc = 0xFF;
+		uint8_t file_crc = 0;
+
+		if (!log_file.open(tier_name, FILE_O_READ))
+		{
+			return;
+		}
+		bool valid = true;
+		for (uint8_t block = 0; block < 4; block++)
+		{
+			valid = valid && restore_tier(pass == 1, &crc);
+		}
+		valid = valid && (log_file.read((void *)&file_crc, 1) == 1) && (file_crc == crc);
+		log_file.close();
+
+		if (!valid)
+		{
+			MYLOG("HIST", "Saved aggregates are invalid");
+			return;
+		}
+	}
+	MYLOG("HIST", "Restored aggregates");
+}
+
+/**
+ * @brief Delete the oldest segment and start it with a new header
+ *
+ */
+static void start_segment(void)
+{
+	char name[8];
+	history_record_s header;
+
+	log_segment = (log_segment + 1) % HIST_SEG_NUM;
+	log_sequence++;
+
+	header.time = log_sequence;
+	header.code = 0;
+	header.series = HIST_SEGMENT;
+	header.crc = record_crc(&header);
+
+	segment_name(log_segment, name);
+	InternalFS.remove(name);
+	log_file.open(name, FILE_O_WRITE);
+	log_file.write((uint8_t *)&header, sizeof(history_record_s));
+	log_file.close();
+
+	log_segment_size = sizeof(history_record_s);
+	log_new_segment = false;
+	MYLOG("HIST", "Started segment %d, sequence %ld", log_segment, log_sequence);
+}
+
+/**
+ * @brief Put a replayed record back into the value history
+ *
+ * @param record valid record from the log
+ */
+static void replay_record(history_record_s *record)
+{
+	switch (record->series)
+	{
+	case HIST_VOC:
+		voc_values.replay_code(record->code, record->time);
+		break;
+	case HIST_TEMP:
+		temp_values.push_code(record->code);
+		break;
+	case HIST_HUMID:
+		humid_values.push_code(record->code);
+		break;
+	case HIST_BARO:
+		baro_values.push_code(record->code);
+		break;
+	case HIST_CO2:
+		co2_values.replay_code(record->code, record->time);
+		break;
+	case HIST_PM10:
+		pm10_values.push_code(record->code);
+		break;
+	case HIST_PM25:
+		pm25_values.push_code(record->code);
+		break;
+	case HIST_PM100:
+		pm100_values.push_code(record->code);
+		break;
+	case HIST_LIGHT:
+		light_values.push_code(record->code);
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+ * @brief Replay all records of a segment
+ *
+ * @param segment segment number
+ * @param last_time time of the last replayed record, updated
+ * @return true if the segment ended with a complete and valid record
+ * @return false if a torn or corrupted record was found
+ */
+static bool replay_segment(uint8_t segment, uint32_t *last_time)
+{
+	char name[8];
+	bool clean = true;
+	uint16_t replayed = 0;
+
+	segment_name(segment, name);
+	if (!log_file.open(name, FILE_O_READ))
+	{
+		return false;
+	}
+	log_segment_size = log_file.size();
+
+	// Skip the header
+	log_file.seek(sizeof(history_record_s));
+
+	while (clean)
+	{
+		int read_bytes = log_file.read((void *)log_batch, HIST_BATCH_SIZE);
+		if (read_bytes <= 0)
+		{
+			break;
+		}
+		if ((read_bytes % sizeof(history_record_s)) != 0)
+		{
+			// Torn record at the end of the segment
+			clean = false;
+		}
+		for (uint16_t idx = 0; idx < read_bytes / sizeof(history_record_s); idx++)
+		{
+			if (record_crc(&log_batch[idx]) != log_batch[idx].crc)
+			{
+				clean = false;
+				break;
+			}
+			replay_record(&log_batch[idx]);
+			*last_time = log_batch[idx].time;
+			replayed++;
+		}
+	}
+	log_file.close();
+	MYLOG("HIST", "Segment %d replayed %d records%s", segment, replayed, clean ? "" : ", stopped at bad record");
+	return clean;
+}
+
+/**
+ * @brief Replay the saved history and prepare the log for new records
+ *        Has to be called before the first sensor values are added
+ *
+ */
+void init_history_log(void)
+{
+	char name[8];
+	uint32_t sequences[HIST_SEG_NUM];
+	uint32_t last_time = 0;
+	time_t replay_start = millis();
+
+	// The log is replayed on top of the saved aggregates
+	restore_tiers();
+
+	// Read the segment headers
+	for (uint8_t segment = 0; segment < HIST_SEG_NUM; segment++)
+	{
+		sequences[segment] = 0;
+		segment_name(segment, name);
+		if (log_file.open(name, FILE_O_READ))
+		{
+			history_record_s header;
+			if ((log_file.read((void *)&header, sizeof(history_record_s)) == sizeof(history_record_s)) &&
+				(header.series == HIST_SEGMENT) && (record_crc(&header) == header.crc))
+			{
+				sequences[segment] = header.time;
+			}
+			log_file.close();
+		}
+	}
+
+	// Replay the segments oldest to newest, the last one is continued
+	uint32_t last_sequence = 0;
+	for (uint8_t count = 0; count < HIST_SEG_NUM; count++)
+	{
+		int8_t next = -1;
+		for (uint8_t segment = 0; segment < HIST_SEG_NUM; segment++)
+		{
+			if ((sequences[segment] > last_sequence) &&
+				((next == -1) || (sequences[segment] < sequences[next])))
+			{
+				next = segment;
+			}
+		}
+		if (next == -1)
+		{
+			break;
+		}
+		last_sequence = sequences[next];
+		log_segment = next;
+		log_sequence = last_sequence;
+		// Records written after a bad record could never be replayed
+		log_new_segment = !replay_segment(next, &last_time);
+	}
+
+	// Without RTC continue the time stamps after the replayed records
+	if (!has_rak12002 && (last_time != 0))
+	{
+		g_history_time_offset = last_time + 1;
+	}
+
+	MYLOG("HIST", "Replay took %ld ms, continue segment %d", millis() - replay_start, log_segment);
+}
+
+/**
+ * @brief Add a sample to the log
+ *        The record is written to the file system when the batch is full
+ *
+ * @param series series ID, HIST_VOC ... HIST_LIGHT
+ * @param code quantized value
+ * @param time time stamp of the value
+ */
+void add_history_log(uint8_t series, int16_t code, uint32_t time)
+{
+	history_record_s *record = &log_batch[log_batch_num];
+	record->time = time;
+	record->code = code;
+	record->series = series;
+	record->crc = record_crc(record);
+	log_batch_num++;
+
+	if (log_batch_num == HIST_BATCH_NUM)
+	{
+		flush_history_log();
+	}
+}
+
+/**
+ * @brief Request to save the aggregates with the next write
+ *        Called when an hourly or daily time slot was closed
+ *
+ */
+void history_tiers_changed(void)
+{
+	log_tiers_changed = true;
+}
+
+/**
+ * @brief Write the collected records to the file system
+ *        Called when the batch is full and before a reset
+ *
+ */
+void flush_history_log(void)
+{
+	char name[8];
+
+	if (log_tiers_changed)
+	{
+		save_tiers();
+	}
+
+	if (log_batch_num == 0)
+	{
+		return;
+	}
+
+	uint16_t batch_size = log_batch_num * sizeof(history_record_s);
+	if (log_new_segment || ((log_segment_size + batch_size) > HIST_SEG_SIZE))
+	{
+		start_segment();
+	}
+
+	segment_name(log_segment, name);
+	log_file.open(name, FILE_O_WRITE);
+	log_file.write((uint8_t *)log_batch, batch_size);
+	log_file.close();
+
+	log_segment_size += batch_size;
+	log_batch_num = 0;
+	MYLOG("HIST", "Wrote %d bytes to segment %d", batch_size, log_segment);
+}
@@ -0,0 +1,337 @@
+/**
+ * @file payload_packer.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Fit Cayenne LPP packets into the max payload size of the data rate
+ *        Values are sorted by the priority list, values without priority
+ *        follow in the order of the packet. Values that do not fit are kept
+ *        and sent after the TX cycle or together with the next reading.
+ *        A value in the next reading replaces the kept value of the same channel.
+ * @version 0.1
+ * @date 2024-03-20
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "main.h"
+
+/** Channels sent first if the packet is too big, highest priority first */
+uint8_t g_lpp_priority[PACKER_PRIO_MAX] = {LPP_CHANNEL_CO2_2, LPP_CHANNEL_PM_2_5, LPP_CHANNEL_VOC};
+/** Number of channels in the priority list */
+uint8_t g_lpp_priority_num = 3;
+
+/** Values that did not fit into the last packet */
+static uint8_t deferred[PACKER_LPP_MAX];
+/** Size of the deferred values */
+static uint8_t deferred_len = 0;
+
+/** Reading merged with the deferred values */
+static uint8_t merged[PACKER_LPP_MAX];
+/** Size of the merged reading */
+static uint8_t merged_len = 0;
+/** Start of each value in the merged reading, sorted by priority */
+static uint8_t value_start[PACKER_VALUES_MAX];
+/** Number of values in the merged reading */
+static uint8_t value_num = 0;
+/** Packet buffer */
+static uint8_t lpp_packet[PACKER_LPP_MAX];
+
+/**
+ * @brief Max application payload per data rate from the LoRaWAN Regional Parameters
+ *        Without MAC commands in FOpts, if MAC commands are pending the packet
+ *        is too big and the senders try again with a smaller packet
+ */
+static const uint8_t payload_eu868[] = {51, 51, 51, 115, 222, 222, 222, 222};
+static const uint8_t payload_us915[] = {11, 53, 125, 242, 242};
+static const uint8_t payload_au915[] = {51, 51, 51, 115, 222, 222, 222};
+static const uint8_t payload_cn470[] = {51, 51, 51, 115, 222, 222};
+// Uplink dwell time, DR0 and DR1 are not used, the smallest size is taken for them
+static const uint8_t payload_as923[] = {11, 11, 11, 53, 125, 242, 242, 242};
+
+/**
+ * @brief Get the max payload size for the current region and data rate
+ *
+ * @return uint8_t max payload size in bytes
+ */
+uint8_t lora_max_payload(void)
+{
+	const uint8_t *payload_max;
+	uint8_t datarates;
+
+	switch (g_lorawan_settings.lora_region)
+	{
+	case LORAMAC_REGION_US915:
+		payload_max = payload_us915;
+		datarates = sizeof(payload_us915);
+		break;
+	case LORAMAC_REGION_AU915:
+		payload_max = payload_au915;
+		datarates = sizeof(payload_au915);
+		break;
+	case LORAMAC_REGION_CN470:
+		payload_max = payload_cn470;
+		datarates = sizeof(payload_cn470);
+		break;
+	case LORAMAC_REGION_AS923:
+	case LORAMAC_REGION_AS923_2:
+	case LORAMAC_REGION_AS923_3:
+	case LORAMAC_REGION_AS923_4:
+		payload_max = payload_as923;
+		datarates = sizeof(payload_as923);
+		break;
+	default:
+		payload_max = payload_eu868;
+		datarates = sizeof(payload_eu868);
+		break;
+	}
+
+	MibRequestConfirm_t mib_req;
+	mib_req.Type = MIB_CHANNELS_DATARATE;
+	LoRaMacMibGetRequestConfirm(&mib_req);
+	int8_t datarate = mib_req.Param.ChannelsDatarate;
+
+	if ((datarate < 0) || (datarate >= datarates))
+	{
+		return payload_max[0];
+	}
+	return payload_max[datarate];
+}
+
+/**
+ * @brief Get the size of a value in a Cayenne LPP packet
+ *
+ * @param lpp start of the value
+ * @return uint8_t size including channel and type, 0 if the type is not used by this device
+ */
+static uint8_t value_size(const uint8_t *lpp)
+{
+	int8_t size = lpp_size(lpp[1]);
+	return size < 0 ? 0 : size + 2;
+}
+
+/**
+ * @brief Check if a channel is in a Cayenne LPP packet
+ *
+ * @param lpp Cayenne LPP packet
+ * @param lpp_len size of the packet
+ * @param channel channel to look for
+ * @return true if the channel is found
+ */
+static bool has_channel(const uint8_t *lpp, uint8_t lpp_len, uint8_t channel)
+{
+	uint8_t pos = 0;
+	while (pos < lpp_len)
+	{
+		if (lpp[pos] == channel)
+		{
+			return true;
+		}
+		pos += value_size(&lpp[pos]);
+	}
+	return false;
+}
+
+/**
+ * @brief Get the priority of a channel
+ *
+ * @param channel Cayenne LPP channel
+ * @return uint8_t 0 is the highest priority, g_lpp_priority_num if not in the list
+ */
+static uint8_t channel_priority(uint8_t channel)
+{
+	for (uint8_t idx = 0; idx < g_lpp_priority_num; idx++)
+	{
+		if (g_lpp_priority[idx] == channel)
+		{
+			return idx;
+		}
+	}
+	return g_lpp_priority_num;
+}
+
+/**
+ * @brief Merge the reading with the deferred values and sort the values by priority
+ *        Deferred values of channels that are in the reading are dropped.
+ *
+ * @param lpp Cayenne LPP packet of the reading
+ * @param lpp_len size of the Cayenne LPP packet
+ * @return true if the values are sorted
+ * @return false if the packet has values unknown to the packer
+ */
+static bool merge_values(const uint8_t *lpp, uint8_t lpp_len)
+{
+	// Check the reading
+	if (lpp_len > PACKER_LPP_MAX)
+	{
+		return false;
+	}
+	uint8_t pos = 0;
+	while (pos < lpp_len)
+	{
+		uint8_t size = value_size(&lpp[pos]);
+		if ((size == 0) || (pos + size > lpp_len))
+		{
+			return false;
+		}
+		pos += size;
+	}
+	memcpy(merged, lpp, lpp_len);
+	merged_len = lpp_len;
+
+	// Add the deferred values that have no new value
+	pos = 0;
+	while (pos < deferred_len)
+	{
+		uint8_t size = value_size(&deferred[pos]);
+		if (!has_channel(lpp, lpp_len, deferred[pos]))
+		{
+			if (merged_len + size > PACKER_LPP_MAX)
+			{
+				MYLOG("PACK", "No space for deferred channel %d", deferred[pos]);
+			}
+			else
+			{
+				memcpy(&merged[merged_len], &deferred[pos], size);
+				merged_len += size;
+			}
+		}
+		pos += size;
+	}
+	deferred_len = 0;
+
+	// Sort the values by priority, same priority keeps the order of the packet
+	value_num = 0;
+	for (uint8_t prio = 0; prio <= g_lpp_priority_num; prio++)
+	{
+		pos = 0;
+		while (pos < merged_len)
+		{
+			if ((channel_priority(merged[pos]) == prio) && (value_num < PACKER_VALUES_MAX))
+			{
+				value_start[value_num++] = pos;
+			}
+			pos += value_size(&merged[pos]);
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Put the values with the highest priority that fit into the packet
+ *
+ * @param max_len max packet size
+ * @return uint8_t packet size
+ */
+static uint8_t pack_values(uint8_t max_len)
+{
+	uint8_t packet_len = 0;
+	for (uint8_t idx = 0; idx < value_num; idx++)
+	{
+		uint8_t size = value_size(&merged[value_start[idx]]);
+		// Smaller values with lower priority can still fit
+		if (packet_len + size <= max_len)
+		{
+			memcpy(&lpp_packet[packet_len], &merged[value_start[idx]], size);
+			packet_len += size;
+		}
+	}
+	return packet_len;
+}
+
+/**
+ * @brief Keep the values that are not in the packet
+ *
+ * @param packet_len size of the sent packet, 0 if nothing was sent
+ */
+static void defer_values(uint8_t packet_len)
+{
+	deferred_len = 0;
+	for (uint8_t idx = 0; idx < value_num; idx++)
+	{
+		const uint8_t *value = &merged[value_start[idx]];
+		uint8_t size = value_size(value);
+		if (!has_channel(lpp_packet, packet_len, value[0]))
+		{
+			memcpy(&deferred[deferred_len], value, size);
+			deferred_len += size;
+		}
+	}
+}
+
+/**
+ * @brief Send a Cayenne LPP packet
+ *        If the packet is too big for the data rate, the values with the
+ *        highest priority are sent and the others are deferred. If the
+ *        packet is not sent at all, all values are deferred.
+ *
+ * @param lpp Cayenne LPP packet
+ * @param lpp_len size of the Cayenne LPP packet
+ * @return lmh_error_status result of send_lora_packet()
+ */
+lmh_error_status send_lpp_packet(const uint8_t *lpp, uint8_t lpp_len)
+{
+	if (!merge_values(lpp, lpp_len))
+	{
+		// Unknown values, send the packet as it is
+		return send_lora_packet((uint8_t *)lpp, lpp_len, LPP_FPORT);
+	}
+
+	lmh_error_status result = LMH_ERROR;
+	uint8_t max_len = lora_max_payload();
+	uint8_t packet_len = 0;
+
+	while (max_len != 0)
+	{
+		if (merged_len <= max_len)
+		{
+			// Everything fits, keep the order of the values
+			memcpy(lpp_packet, merged, merged_len);
+			packet_len = merged_len;
+		}
+		else
+		{
+			packet_len = pack_values(max_len);
+		}
+		if (packet_len == 0)
+		{
+			break;
+		}
+
+		result = send_lora_packet(lpp_packet, packet_len, LPP_FPORT);
+		if (result != LMH_ERROR)
+		{
+			break;
+		}
+		// Too big for the data rate, e.g. pending MAC commands or the data rate was lowered
+		max_len = packet_len - 1;
+	}
+
+	defer_values(result == LMH_SUCCESS ? packet_len : 0);
+	if (deferred_len != 0)
+	{
+		MYLOG("PACK", "Sent %d of %d bytes, %d bytes deferred", result == LMH_SUCCESS ? packet_len : 0, merged_len, deferred_len);
+	}
+	return result;
+}
+
+/**
+ * @brief Send the deferred values in a follow up packet
+ *        Called after a TX cycle. The follow up packet is sent unconfirmed.
+ *
+ * @return true if a packet was enqueued
+ * @return false if there are no deferred values or sending failed
+ */
+bool send_lpp_deferred(void)
+{
+	if (deferred_len == 0)
+	{
+		return false;
+	}
+
+	uint8_t lpp[PACKER_LPP_MAX];
+	uint8_t lpp_len = deferred_len;
+	memcpy(lpp, deferred, lpp_len);
+	deferred_len = 0;
+
+	g_lorawan_settings.confirmed_msg_enabled = LMH_UNCONFIRMED_MSG;
+	return send_lpp_packet(lpp, lpp_len) == LMH_SUCCESS;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file sensor_scheduler.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Start the sensors just in time for the sensor reading
+ *        Each sensor has a warm-up time it needs from startup until it can
+ *        measure and a conversion time for the measurement. A sensor is
+ *        started at cycle end - (warm-up + conversion), the sensor with the
+ *        longest time first, so that all sensors finish at the same time.
+ *        SEND_NOW is set when the last sensor is finished.
+ *        Sensors, warm-up and conversion times are taken from sensor_drivers[].
+ * @version 0.1
+ * @date 2024-03-13
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "main.h"
+
+/** Flags if the sensors in sensor_drivers[] were started in this cycle */
+static bool sensor_started[SENSOR_DRIVERS_MAX];
+
+/** Length of the current cycle = longest warm-up + conversion time of the available sensors */
+static uint32_t cycle_length = 0;
+/** Start time of the current cycle */
+static time_t cycle_start = 0;
+/** Flag if a cycle is running */
+static bool cycle_running = false;
+
+/**
+ * @brief Time a sensor needs from startup until its measurement is finished
+ *
+ * @param driver sensor driver
+ * @return uint32_t warm-up + conversion time in ms
+ */
+static uint32_t sensor_time(const sensor_driver_s *driver)
+{
+	return driver->warmup_ms + driver->conversion_ms;
+}
+
+/**
+ * @brief Start a new sensor reading cycle
+ *        Called on the STATUS event
+ *
+ * @param min_length min cycle length in ms, the sensors are read at the end of the cycle
+ */
+void start_sensor_schedule(uint32_t min_length)
+{
+	// Slow waking modules that did not answer yet are not connected, the cycle controls their power now
+	probe_slow_sensors();
+	stop_slow_probe(false);
+
+	cycle_length = min_length;
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		sensor_started[idx] = false;
+		if (*sensor_drivers[idx].available && (sensor_drivers[idx].startup != NULL) &&
+			(sensor_time(&sensor_drivers[idx]) > cycle_length))
+		{
+			cycle_length = sensor_time(&sensor_drivers[idx]);
+		}
+	}
+	cycle_start = millis();
+	cycle_running = true;
+	MYLOG("SCHED", "Cycle length %ld ms", cycle_length);
+
+	run_sensor_schedule();
+}
+
+/**
+ * @brief Start the sensors that are due and restart the
+ *        timer for the next sensor or the end of the cycle
+ *        Called on the STATUS and SENSOR_REQ events
+ *
+ */
+void run_sensor_schedule(void)
+{
+	if (!cycle_running)
+	{
+		return;
+	}
+
+	uint32_t now = millis() - cycle_start;
+	uint32_t next = cycle_length;
+	bool waiting = false;
+
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		const sensor_driver_s *driver = &sensor_drivers[idx];
+		if (!*driver->available || (driver->startup == NULL) || sensor_started[idx])
+		{
+			continue;
+		}
+		uint32_t start_at = cycle_length - sensor_time(driver);
+		if (start_at <= now)
+		{
+			MYLOG("SCHED", "Start %s at %ld ms", driver->name, now);
+			if (g_is_using_battery && (driver->power_pin != SENSOR_NO_POWER))
+			{
+				digitalWrite(driver->power_pin, HIGH);
+			}
+			driver->startup();
+			sensor_started[idx] = true;
+		}
+		else
+		{
+			waiting = true;
+			if (start_at < next)
+			{
+				next = start_at;
+			}
+		}
+	}
+
+	// Starting a sensor can take some time
+	now = millis() - cycle_start;
+	if (!waiting && (now >= cycle_length))
+	{
+		MYLOG("SCHED", "All sensors finished after %ld ms", now);
+		cycle_running = false;
+		api_wake_loop(SEND_NOW);
+		return;
+	}
+
+	if (next <= now)
+	{
+		next = now + 1;
+	}
+	g_sensor_timer.setPeriod(next - now);
+	g_sensor_timer.start();
+}
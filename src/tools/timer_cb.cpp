@@ -11,16 +11,14 @@
 #include "main.h"
 
 /**
- * @brief Timer function used to power up the sensors for a given time.
- * 		  This allows the sensors to do multiple measurements before a 
- *        final reading is done.
+ * @brief Timer callback to wakeup the loop with the SENSOR_REQ event
+ *        Used by the sensor startup schedule and the CO2 sensor poll
  *
  * @param unused Timer handle, not used
  */
-void send_delayed(TimerHandle_t unused)
+void sensor_wakeup(TimerHandle_t unused)
 {
-	api_wake_loop(SEND_NOW);
-	g_sensor_timer.stop();
+	api_wake_loop(SENSOR_REQ);
 }
 
 /**
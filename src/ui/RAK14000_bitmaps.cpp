@@ -0,0 +1,986 @@
+/**
+ * @file RAK14000_bitmaps.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief PackBits compressed images for the EPD display
+ *        Created by compress_bitmaps.py from assets/bitmaps, do not edit
+ * @version 0.1
+ * @date 2024-03-18
+ *
+ * @copyright Copyright (c) 2024
+ * Some images cortesy of <a href="https://www.flaticon.com/free-icons" title="Freepik - Flaticon">Icons created by Freepik - Flaticon</a>
+ */
+#include <stdint.h>
+
+// 248x248, 7688 bytes uncompressed
+const uint8_t good_air[] = {
+	0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xa6, 0x00, 0x02, 0x3f,
+	0xff, 0xfe, 0xe6, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x00, 0xfc, 0xe8, 0x00,
+	0x01, 0x03, 0xff, 0xfe, 0x00, 0x01, 0x7f, 0xe0, 0xe9, 0x00, 0x01, 0x7f,
+	0xc0, 0xfe, 0x00, 0x01, 0x01, 0xfe, 0xea, 0x00, 0x01, 0x03, 0xf8, 0xfc,
+	0x00, 0x01, 0x0f, 0xe0, 0xeb, 0x00, 0x00, 0x7f, 0xfa, 0x00, 0x00, 0x7e,
+	0xec, 0x00, 0x01, 0x01, 0xf0, 0xfa, 0x00, 0x01, 0x0f, 0xc0, 0xed, 0x00,
+	0x01, 0x0f, 0x80, 0xf9, 0x00, 0x00, 0xf8, 0xed, 0x00, 0x00, 0x3c, 0xf8,
+	0x00, 0x00, 0x3e, 0xed, 0x00, 0x00, 0xf0, 0xf8, 0x00, 0x02, 0x07, 0xff,
+	0xfc, 0xf0, 0x00, 0x01, 0x03, 0xc0, 0xf8, 0x00, 0x03, 0x03, 0xff, 0xff,
+	0xc0, 0xf1, 0x00, 0x00, 0x1e, 0xf7, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xf8,
+	0xf1, 0x00, 0x00, 0x78, 0xf7, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xf1, 0x00,
+	0x00, 0xe0, 0xf8, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x00, 0x80, 0xf3, 0x00,
+	0x01, 0x03, 0x80, 0xf8, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x00, 0xc0, 0xf3,
+	0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x00, 0xf0, 0xf3,
+	0x00, 0x00, 0x1c, 0xf7, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x00, 0xf8, 0xf3,
+	0x00, 0x00, 0x78, 0xf7, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0x00, 0xfc, 0xf3,
+	0x00, 0x00, 0xe0, 0xf7, 0x00, 0xfc, 0xff, 0x00, 0xfe, 0xf4, 0x00, 0x01,
+	0x01, 0xc0, 0xf8, 0x00, 0x00, 0x01, 0xfb, 0xff, 0xf4, 0x00, 0x00, 0x07,
+	0xf7, 0x00, 0x00, 0x03, 0xfb, 0xff, 0x00, 0x80, 0xf5, 0x00, 0x00, 0x07,
+	0xf7, 0x00, 0x07, 0x03, 0xff, 0xff, 0xa0, 0x1f, 0xff, 0xff, 0x80, 0xf5,
+	0x00, 0x00, 0x1c, 0xf7, 0x00, 0x07, 0x07, 0xff, 0xf8, 0x00, 0x00, 0x7f,
+	0xff, 0xc0, 0xf5, 0x00, 0x00, 0x38, 0xf7, 0x00, 0x07, 0x07, 0xff, 0xc0,
+	0x00, 0x00, 0x1f, 0xff, 0xe0, 0xf5, 0x00, 0x00, 0x70, 0xf7, 0x00, 0x01,
+	0x0f, 0xfe, 0xfe, 0x00, 0x02, 0x07, 0xff, 0xe0, 0xf5, 0x00, 0x00, 0xe0,
+	0xf7, 0x00, 0x01, 0x0f, 0xf8, 0xfe, 0x00, 0x02, 0x03, 0xff, 0xf0, 0xf6,
+	0x00, 0x01, 0x01, 0x80, 0xf7, 0x00, 0x01, 0x0f, 0xc0, 0xfd, 0x00, 0x01,
+	0xff, 0xf0, 0xf6, 0x00, 0x00, 0x03, 0xf6, 0x00, 0x00, 0x0f, 0xfc, 0x00,
+	0x01, 0x7f, 0xf8, 0xf6, 0x00, 0x00, 0x06, 0xf0, 0x00, 0x01, 0x3f, 0xf8,
+	0xf6, 0x00, 0x04, 0x1c, 0x00, 0x07, 0xff, 0xc0, 0xf4, 0x00, 0x01, 0x19,
+	0xf8, 0xf6, 0x00, 0x04, 0x18, 0x00, 0x7f, 0xff, 0xf8, 0xf4, 0x00, 0x01,
+	0x0c, 0xf8, 0xf6, 0x00, 0x01, 0x30, 0x01, 0xfe, 0xff, 0xf4, 0x00, 0x01,
+	0x06, 0x38, 0xf6, 0x00, 0x01, 0x60, 0x07, 0xfe, 0xff, 0x00, 0xc0, 0xf5,
+	0x00, 0x00, 0x03, 0xf5, 0x00, 0x01, 0xc0, 0x1f, 0xfe, 0xff, 0x00, 0xf0,
+	0xf5, 0x00, 0x01, 0x01, 0x80, 0xf7, 0x00, 0x02, 0x01, 0x80, 0x7f, 0xfe,
+	0xff, 0x00, 0xf8, 0xf4, 0x00, 0x00, 0xc0, 0xf7, 0x00, 0x01, 0x03, 0x00,
+	0xfd, 0xff, 0x00, 0xfe, 0xf4, 0x00, 0x00, 0xe0, 0xf7, 0x00, 0x01, 0x07,
+	0x01, 0xfc, 0xff, 0xf4, 0x00, 0x00, 0x70, 0xf7, 0x00, 0x01, 0x0c, 0x07,
+	0xfc, 0xff, 0x00, 0xc0, 0xf5, 0x00, 0x00, 0x18, 0xf7, 0x00, 0x01, 0x18,
+	0x0f, 0xfc, 0xff, 0x00, 0xe0, 0xf5, 0x00, 0x00, 0x1c, 0xf7, 0x00, 0x01,
+	0x38, 0x1f, 0xfc, 0xff, 0x00, 0xf0, 0xf5, 0x00, 0x00, 0x0e, 0xf7, 0x00,
+	0x07, 0x30, 0x3f, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xf8, 0xf5, 0x00, 0x00,
+	0x06, 0xf7, 0x00, 0x07, 0x60, 0x3f, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xfc,
+	0xf5, 0x00, 0x00, 0x03, 0xf7, 0x00, 0x07, 0xc0, 0x7f, 0xfe, 0x00, 0x00,
+	0x03, 0xff, 0xfc, 0xf5, 0x00, 0x01, 0x03, 0x80, 0xf9, 0x00, 0x03, 0x01,
+	0xc0, 0xff, 0xf0, 0xfe, 0x00, 0x01, 0xff, 0xfe, 0xf5, 0x00, 0x01, 0x01,
+	0x80, 0xf9, 0x00, 0x03, 0x01, 0x80, 0xff, 0x80, 0xfe, 0x00, 0x01, 0x3f,
+	0xff, 0xf4, 0x00, 0x00, 0xc0, 0xf9, 0x00, 0x02, 0x03, 0x00, 0xfe, 0xfd,
+	0x00, 0x01, 0x0f, 0xff, 0xf4, 0x00, 0x00, 0x60, 0xf9, 0x00, 0x02, 0x07,
+	0x00, 0xf8, 0xfd, 0x00, 0x02, 0x03, 0xff, 0x80, 0xf5, 0x00, 0x00, 0x60,
+	0xf9, 0x00, 0x02, 0x06, 0x00, 0x40, 0xfc, 0x00, 0x01, 0xff, 0x80, 0xf5,
+	0x00, 0x00, 0x30, 0xf9, 0x00, 0x00, 0x0c, 0xfa, 0x00, 0x01, 0x3f, 0x80,
+	0xf5, 0x00, 0x00, 0x18, 0xf9, 0x00, 0x00, 0x0c, 0xfa, 0x00, 0x01, 0x1f,
+	0x80, 0xf5, 0x00, 0x00, 0x18, 0xf9, 0x00, 0x00, 0x18, 0xfa, 0x00, 0x01,
+	0x07, 0x80, 0xf5, 0x00, 0x00, 0x0c, 0xf9, 0x00, 0x04, 0x30, 0x00, 0x00,
+	0x03, 0xfc, 0xf4, 0x00, 0x04, 0x3f, 0xc0, 0x00, 0x00, 0x06, 0xf9, 0x00,
+	0x02, 0x30, 0x00, 0x3f, 0xfd, 0xff, 0x00, 0xe0, 0xfa, 0x00, 0x00, 0x07,
+	0xfd, 0xff, 0x02, 0xf8, 0x00, 0x06, 0xf9, 0x00, 0x01, 0x70, 0x00, 0xfc,
+	0xff, 0x00, 0xfa, 0xfa, 0x00, 0x00, 0x5f, 0xfd, 0xff, 0x02, 0xfe, 0x00,
+	0x06, 0xf9, 0x00, 0x01, 0x60, 0x07, 0xfb, 0xff, 0x00, 0xe0, 0xfc, 0x00,
+	0x00, 0x0f, 0xfb, 0xff, 0x01, 0xc0, 0x03, 0xf9, 0x00, 0x01, 0xc0, 0x1f,
+	0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xfb, 0xff, 0x02, 0xf0,
+	0x03, 0x80, 0xfa, 0x00, 0x01, 0xc0, 0x3f, 0xfa, 0xff, 0x00, 0x80, 0xfe,
+	0x00, 0x00, 0x01, 0xfa, 0xff, 0x02, 0xfc, 0x01, 0x80, 0xfb, 0x00, 0x02,
+	0x01, 0x80, 0x7f, 0xfa, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x07, 0xfa,
+	0xff, 0x02, 0xfe, 0x00, 0xc0, 0xfb, 0x00, 0x01, 0x07, 0x80, 0xf9, 0xff,
+	0x00, 0xf0, 0xfe, 0x00, 0x00, 0x1f, 0xf9, 0xff, 0x01, 0x00, 0xc0, 0xfb,
+	0x00, 0x01, 0x1f, 0xf1, 0xf9, 0xff, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0x3f,
+	0xf9, 0xff, 0x01, 0x80, 0x60, 0xfb, 0x00, 0x00, 0x7f, 0xf8, 0xff, 0x00,
+	0xfe, 0xfe, 0x00, 0x00, 0x7f, 0xf9, 0xff, 0x01, 0x80, 0x60, 0xfb, 0x00,
+	0x00, 0x7f, 0xf7, 0xff, 0x02, 0x00, 0x00, 0x01, 0xf8, 0xff, 0x01, 0xc0,
+	0x70, 0xfc, 0x00, 0x00, 0x01, 0xf6, 0xff, 0x02, 0x80, 0x00, 0x01, 0xf8,
+	0xff, 0x01, 0xcf, 0xfc, 0xfc, 0x00, 0x00, 0x01, 0xf6, 0xff, 0x02, 0xc0,
+	0x00, 0x03, 0xf6, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xf6, 0xff, 0x02, 0xe0,
+	0x00, 0x07, 0xf6, 0xff, 0x00, 0x80, 0xfd, 0x00, 0x00, 0x03, 0xf6, 0xff,
+	0x02, 0xe0, 0x00, 0x0f, 0xf6, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0x00, 0x07,
+	0xf6, 0xff, 0x02, 0xf0, 0x00, 0x0f, 0xf6, 0xff, 0x00, 0xc0, 0xfd, 0x00,
+	0x00, 0x07, 0xf6, 0xff, 0x02, 0xf0, 0x00, 0x0f, 0xf6, 0xff, 0x00, 0xe0,
+	0xfd, 0x00, 0x00, 0x07, 0xf6, 0xff, 0x02, 0xf0, 0x00, 0x1f, 0xf6, 0xff,
+	0x00, 0xe0, 0xfd, 0x00, 0x00, 0x07, 0xf6, 0xff, 0x02, 0xf8, 0x00, 0x1f,
+	0xf6, 0xff, 0x00, 0xe0, 0xfd, 0x00, 0x00, 0x07, 0xf6, 0xff, 0x02, 0xf8,
+	0x00, 0x1f, 0xf6, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0x07, 0xf6, 0xff,
+	0x02, 0xf8, 0x00, 0x3f, 0xf6, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0x03,
+	0xf6, 0xff, 0x02, 0xf8, 0x00, 0x3f, 0xf6, 0xff, 0x00, 0xf0, 0xfc, 0x00,
+	0xf6, 0xff, 0x02, 0xf8, 0x00, 0x3f, 0xf6, 0xff, 0x00, 0xf0, 0xfc, 0x00,
+	0xe8, 0xff, 0x00, 0xe0, 0xfc, 0x00, 0x00, 0xdf, 0xe9, 0xff, 0x00, 0xe0,
+	0xfc, 0x00, 0x00, 0xc7, 0xe9, 0xff, 0x00, 0x80, 0xfc, 0x00, 0x00, 0x81,
+	0xe9, 0xff, 0x00, 0x80, 0xfd, 0x00, 0x02, 0x01, 0x80, 0x3f, 0xeb, 0xff,
+	0x01, 0xfc, 0xc0, 0xfd, 0x00, 0x02, 0x01, 0x80, 0x0f, 0xeb, 0xff, 0x01,
+	0xf0, 0xc0, 0xfd, 0x00, 0x02, 0x01, 0x80, 0x0f, 0xf8, 0xff, 0x02, 0xf8,
+	0x00, 0x3f, 0xf7, 0xff, 0x01, 0xc0, 0xc0, 0xfd, 0x00, 0x02, 0x01, 0x00,
+	0x0f, 0xf8, 0xff, 0x02, 0xf8, 0x00, 0x1f, 0xf8, 0xff, 0x02, 0xfe, 0x00,
+	0xc0, 0xfd, 0x00, 0x02, 0x03, 0x00, 0x0f, 0xec, 0xff, 0x02, 0xf0, 0x00,
+	0x60, 0xfd, 0x00, 0x02, 0x03, 0x00, 0x0f, 0xec, 0xff, 0x02, 0xe0, 0x00,
+	0x60, 0xfd, 0x00, 0x02, 0x03, 0x00, 0x0f, 0xec, 0xff, 0x02, 0xe0, 0x00,
+	0x60, 0xfd, 0x00, 0x02, 0x03, 0x00, 0x0f, 0xec, 0xff, 0x02, 0xe0, 0x00,
+	0x60, 0xfd, 0x00, 0x02, 0x03, 0x00, 0x0f, 0xec, 0xff, 0x02, 0xe0, 0x00,
+	0x60, 0xfd, 0x00, 0x02, 0x06, 0x00, 0x07, 0xec, 0xff, 0x02, 0xe0, 0x00,
+	0x20, 0xfd, 0x00, 0x02, 0x06, 0x00, 0x07, 0xf7, 0xff, 0x00, 0xc1, 0xf7,
+	0xff, 0x02, 0xe0, 0x00, 0x30, 0xfd, 0x00, 0x02, 0x06, 0x00, 0x07, 0xf8,
+	0xff, 0x02, 0xf8, 0x00, 0x1f, 0xf8, 0xff, 0x02, 0xe0, 0x00, 0x30, 0xfd,
+	0x00, 0x02, 0x06, 0x00, 0x07, 0xf8, 0xff, 0x02, 0xf0, 0x00, 0x1f, 0xf8,
+	0xff, 0x02, 0xc0, 0x00, 0x30, 0xfd, 0x00, 0x02, 0x06, 0x00, 0x07, 0xf8,
+	0xff, 0x02, 0xf0, 0x00, 0x1f, 0xf8, 0xff, 0x02, 0xc0, 0x00, 0x30, 0xfd,
+	0x00, 0x02, 0x06, 0x00, 0x03, 0xf8, 0xff, 0x02, 0xf0, 0x00, 0x0f, 0xf8,
+	0xff, 0x02, 0xc0, 0x00, 0x30, 0xfd, 0x00, 0x02, 0x06, 0x00, 0x03, 0xf8,
+	0xff, 0x02, 0xf0, 0x00, 0x0f, 0xf8, 0xff, 0x02, 0xc0, 0x00, 0x30, 0xfd,
+	0x00, 0x02, 0x04, 0x00, 0x03, 0xf8, 0xff, 0x02, 0xf0, 0x00, 0x0f, 0xf8,
+	0xff, 0x02, 0x80, 0x00, 0x30, 0xfd, 0x00, 0x02, 0x04, 0x00, 0x01, 0xf8,
+	0xff, 0x02, 0xe0, 0x00, 0x0f, 0xf8, 0xff, 0x02, 0x80, 0x00, 0x10, 0xfd,
+	0x00, 0x02, 0x0c, 0x00, 0x01, 0xf8, 0xff, 0x02, 0xe0, 0x00, 0x0f, 0xf8,
+	0xff, 0x02, 0x80, 0x00, 0x10, 0xfd, 0x00, 0x02, 0x0c, 0x00, 0x01, 0xf8,
+	0xff, 0x02, 0xe0, 0x00, 0x07, 0xf8, 0xff, 0x02, 0x00, 0x00, 0x10, 0xfd,
+	0x00, 0x02, 0x0c, 0x00, 0x00, 0xf8, 0xff, 0x02, 0xe0, 0x00, 0x07, 0xf8,
+	0xff, 0x02, 0x00, 0x00, 0x18, 0xfd, 0x00, 0x02, 0x0c, 0x00, 0x00, 0xf8,
+	0xff, 0x02, 0xc0, 0x00, 0x07, 0xf9, 0xff, 0x03, 0xfe, 0x00, 0x00, 0x18,
+	0xfd, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x7f, 0xf9, 0xff, 0x02, 0xc0, 0x00,
+	0x03, 0xf9, 0xff, 0x03, 0xfe, 0x00, 0x00, 0x18, 0xfd, 0x00, 0x03, 0x0c,
+	0x00, 0x00, 0x3f, 0xf9, 0xff, 0x02, 0x80, 0x00, 0x01, 0xf9, 0xff, 0x03,
+	0xfc, 0x00, 0x00, 0x18, 0xfd, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x3f, 0xf9,
+	0xff, 0x02, 0x80, 0x00, 0x01, 0xf9, 0xff, 0x03, 0xf8, 0x00, 0x00, 0x18,
+	0xfd, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x1f, 0xf9, 0xff, 0xfe, 0x00, 0xf9,
+	0xff, 0x03, 0xf0, 0x00, 0x00, 0x18, 0xfd, 0x00, 0x03, 0x0c, 0x00, 0x00,
+	0x0f, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0x03, 0xf0, 0x00, 0x00, 0x18,
+	0xfd, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x07, 0xfa, 0xff, 0x00, 0xfe, 0xfe,
+	0x00, 0x00, 0x7f, 0xfa, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x18, 0xfd, 0x00,
+	0x03, 0x0c, 0x00, 0x00, 0x03, 0xfa, 0xff, 0x00, 0xfc, 0xfe, 0x00, 0x00,
+	0x7f, 0xfa, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x18, 0xfd, 0x00, 0x03, 0x0c,
+	0x00, 0x00, 0x01, 0xfa, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x00, 0x3f, 0xfa,
+	0xff, 0x03, 0x80, 0x00, 0x00, 0x18, 0xfd, 0x00, 0x00, 0x0c, 0xfe, 0x00,
+	0xfa, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0x1f, 0xfb, 0xff, 0x00, 0xfe,
+	0xfe, 0x00, 0x00, 0x18, 0xfd, 0x00, 0x00, 0x0c, 0xfe, 0x00, 0x00, 0x3f,
+	0xfb, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x0f, 0xfb, 0xff, 0x00, 0xfc,
+	0xfe, 0x00, 0x00, 0x18, 0xfd, 0x00, 0x00, 0x0c, 0xfe, 0x00, 0x00, 0x1f,
+	0xfb, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0x03, 0xfb, 0xff, 0x00, 0xf0,
+	0xfe, 0x00, 0x00, 0x10, 0xfd, 0x00, 0x00, 0x0c, 0xfe, 0x00, 0x00, 0x07,
+	0xfb, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x01, 0xfb, 0xff, 0x00, 0xc0,
+	0xfe, 0x00, 0x00, 0x10, 0xfd, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x01,
+	0xfc, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0xfd, 0x00,
+	0x00, 0x10, 0xfd, 0x00, 0x00, 0x04, 0xfd, 0x00, 0x00, 0x3f, 0xfd, 0xff,
+	0x00, 0xf8, 0xfc, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x00, 0xfc, 0xfd, 0x00,
+	0x00, 0x30, 0xfd, 0x00, 0x00, 0x06, 0xfd, 0x00, 0x00, 0x07, 0xfd, 0xff,
+	0x00, 0xe0, 0xfc, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x00, 0xe0, 0xfd, 0x00,
+	0x00, 0x30, 0xfd, 0x00, 0x00, 0x06, 0xfc, 0x00, 0x00, 0x7f, 0xfe, 0xff,
+	0xfa, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x30, 0xfd, 0x00,
+	0x00, 0x06, 0xfc, 0x00, 0x03, 0x03, 0xff, 0xff, 0xf0, 0xfa, 0x00, 0x03,
+	0x0f, 0xff, 0xff, 0x80, 0xfc, 0x00, 0x00, 0x30, 0xfd, 0x00, 0x00, 0x06,
+	0xfb, 0x00, 0x02, 0x7f, 0xff, 0xc0, 0xfa, 0x00, 0x02, 0x03, 0xff, 0xfe,
+	0xfb, 0x00, 0x00, 0x30, 0xfd, 0x00, 0x00, 0x06, 0xe8, 0x00, 0x00, 0x30,
+	0xfd, 0x00, 0x00, 0x06, 0xe8, 0x00, 0x00, 0x30, 0xfd, 0x00, 0x00, 0x06,
+	0xe8, 0x00, 0x00, 0x20, 0xfd, 0x00, 0x00, 0x02, 0xe8, 0x00, 0x00, 0x60,
+	0xfd, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x60, 0xfd, 0x00, 0x00, 0x03,
+	0xe8, 0x00, 0x00, 0x60, 0xfd, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x60,
+	0xfd, 0x00, 0x00, 0x03, 0xe8, 0x00, 0x00, 0x60, 0xfd, 0x00, 0x00, 0x01,
+	0xe8, 0x00, 0x00, 0xc0, 0xfd, 0x00, 0x01, 0x01, 0x80, 0xe9, 0x00, 0x00,
+	0xc0, 0xfd, 0x00, 0x01, 0x01, 0x80, 0xe9, 0x00, 0x00, 0xc0, 0xfd, 0x00,
+	0x01, 0x01, 0x80, 0xe9, 0x00, 0x00, 0xc0, 0xfc, 0x00, 0x00, 0x80, 0xe9,
+	0x00, 0x00, 0x80, 0xfc, 0x00, 0x00, 0xc0, 0xea, 0x00, 0x01, 0x01, 0x80,
+	0xfc, 0x00, 0x00, 0xc0, 0xea, 0x00, 0x01, 0x01, 0x80, 0xfc, 0x00, 0x00,
+	0x40, 0xea, 0x00, 0x00, 0x03, 0xfb, 0x00, 0x00, 0x60, 0xea, 0x00, 0x00,
+	0x03, 0xfb, 0x00, 0x00, 0x60, 0xea, 0x00, 0x00, 0x03, 0xfb, 0x00, 0x00,
+	0x60, 0xea, 0x00, 0x00, 0x02, 0xfb, 0x00, 0x00, 0x30, 0xea, 0x00, 0x00,
+	0x06, 0xfb, 0x00, 0x00, 0x30, 0xfc, 0x00, 0x00, 0x1c, 0xf6, 0x00, 0x00,
+	0x1c, 0xfc, 0x00, 0x00, 0x06, 0xfb, 0x00, 0x00, 0x30, 0xfc, 0x00, 0x00,
+	0x7f, 0xf6, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x0c, 0xfb, 0x00, 0x00,
+	0x18, 0xfc, 0x00, 0x01, 0x7f, 0x80, 0xf7, 0x00, 0x00, 0xff, 0xfc, 0x00,
+	0x00, 0x0c, 0xfb, 0x00, 0x00, 0x18, 0xfc, 0x00, 0x01, 0xff, 0xe0, 0xf8,
+	0x00, 0x02, 0x03, 0xff, 0x80, 0xfd, 0x00, 0x00, 0x0c, 0xfb, 0x00, 0x00,
+	0x0c, 0xfc, 0x00, 0x01, 0xff, 0xf8, 0xf8, 0x00, 0x02, 0x0f, 0xff, 0x80,
+	0xfd, 0x00, 0x00, 0x18, 0xfb, 0x00, 0x00, 0x0c, 0xfc, 0x00, 0x01, 0xff,
+	0xfc, 0xf8, 0x00, 0x01, 0x3f, 0xff, 0xfc, 0x00, 0x00, 0x18, 0xfb, 0x00,
+	0x00, 0x04, 0xfc, 0x00, 0x01, 0x7f, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff,
+	0xfc, 0x00, 0x00, 0x30, 0xfb, 0x00, 0x00, 0x06, 0xfc, 0x00, 0x02, 0x7f,
+	0xff, 0xe0, 0xfa, 0x00, 0x02, 0x03, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x30,
+	0xfb, 0x00, 0x00, 0x06, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0xf8, 0xfa, 0x00,
+	0x02, 0x0f, 0xff, 0xfe, 0xfc, 0x00, 0x00, 0x70, 0xfb, 0x00, 0x00, 0x03,
+	0xfc, 0x00, 0x02, 0x0f, 0xff, 0xfe, 0xfa, 0x00, 0x02, 0x3f, 0xff, 0xf8,
+	0xfc, 0x00, 0x00, 0x60, 0xfb, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x03, 0x07,
+	0xff, 0xff, 0xc0, 0xfc, 0x00, 0x03, 0x01, 0xff, 0xff, 0xf0, 0xfc, 0x00,
+	0x00, 0x60, 0xfb, 0x00, 0x01, 0x01, 0x80, 0xfd, 0x00, 0x03, 0x03, 0xff,
+	0xff, 0xe0, 0xfc, 0x00, 0x03, 0x03, 0xff, 0xff, 0xe0, 0xfc, 0x00, 0x00,
+	0xc0, 0xfb, 0x00, 0x01, 0x01, 0x80, 0xfd, 0x00, 0x03, 0x01, 0xff, 0xff,
+	0xfe, 0xfc, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xc0, 0xfc, 0x00, 0x00, 0xc0,
+	0xfa, 0x00, 0x00, 0xc0, 0xfc, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xf8, 0xfe,
+	0x00, 0x00, 0x1f, 0xfe, 0xff, 0xfc, 0x00, 0x01, 0x01, 0x80, 0xfa, 0x00,
+	0x00, 0xc0, 0xfc, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x02, 0xf0, 0x00, 0x07,
+	0xfe, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x01, 0x01, 0x80, 0xfa, 0x00, 0x00,
+	0x60, 0xfc, 0x00, 0x00, 0x0f, 0xf8, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0x00,
+	0x03, 0xf9, 0x00, 0x00, 0x60, 0xfc, 0x00, 0x00, 0x03, 0xf8, 0xff, 0x00,
+	0xe0, 0xfc, 0x00, 0x00, 0x07, 0xf9, 0x00, 0x00, 0x30, 0xfc, 0x00, 0x00,
+	0x01, 0xf8, 0xff, 0x00, 0xc0, 0xfc, 0x00, 0x00, 0x06, 0xf9, 0x00, 0x00,
+	0x18, 0xfb, 0x00, 0x00, 0x7f, 0xf9, 0xff, 0xfb, 0x00, 0x00, 0x0c, 0xf9,
+	0x00, 0x00, 0x18, 0xfb, 0x00, 0x00, 0x1f, 0xfa, 0xff, 0x00, 0xfc, 0xfb,
+	0x00, 0x00, 0x0c, 0xf9, 0x00, 0x00, 0x0c, 0xfb, 0x00, 0x00, 0x0f, 0xfa,
+	0xff, 0x00, 0xf8, 0xfb, 0x00, 0x00, 0x18, 0xf9, 0x00, 0x00, 0x0e, 0xfb,
+	0x00, 0x00, 0x03, 0xfa, 0xff, 0x00, 0xe0, 0xfb, 0x00, 0x00, 0x38, 0xf9,
+	0x00, 0x00, 0x06, 0xfa, 0x00, 0xfa, 0xff, 0x00, 0x80, 0xfb, 0x00, 0x00,
+	0x30, 0xf9, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00, 0x7f, 0xfb, 0xff, 0xfa,
+	0x00, 0x00, 0x60, 0xf9, 0x00, 0x01, 0x03, 0x80, 0xfb, 0x00, 0x00, 0x1f,
+	0xfc, 0xff, 0x00, 0xfc, 0xfa, 0x00, 0x00, 0xe0, 0xf9, 0x00, 0x01, 0x01,
+	0x80, 0xfb, 0x00, 0x00, 0x07, 0xfc, 0xff, 0x00, 0xf0, 0xfa, 0x00, 0x00,
+	0xc0, 0xf8, 0x00, 0x00, 0xc0, 0xfb, 0x00, 0x00, 0x01, 0xfc, 0xff, 0x00,
+	0xc0, 0xfb, 0x00, 0x01, 0x01, 0x80, 0xf8, 0x00, 0x00, 0x60, 0xfa, 0x00,
+	0x00, 0x3f, 0xfe, 0xff, 0x00, 0xfe, 0xfa, 0x00, 0x00, 0x03, 0xf7, 0x00,
+	0x00, 0x70, 0xfa, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x00, 0xf0, 0xfa, 0x00,
+	0x00, 0x06, 0xf7, 0x00, 0x00, 0x30, 0xf9, 0x00, 0xfe, 0xff, 0x00, 0x80,
+	0xfa, 0x00, 0x00, 0x0e, 0xf7, 0x00, 0x00, 0x18, 0xf9, 0x00, 0x02, 0x0f,
+	0xff, 0xf8, 0xf9, 0x00, 0x00, 0x0c, 0xf7, 0x00, 0x00, 0x0c, 0xee, 0x00,
+	0x00, 0x18, 0xf7, 0x00, 0x00, 0x0e, 0xee, 0x00, 0x00, 0x30, 0xf7, 0x00,
+	0x00, 0x07, 0xee, 0x00, 0x00, 0x70, 0xf7, 0x00, 0x01, 0x03, 0x80, 0xef,
+	0x00, 0x00, 0xe0, 0xf7, 0x00, 0x01, 0x01, 0xc0, 0xf0, 0x00, 0x01, 0x01,
+	0xc0, 0xf6, 0x00, 0x00, 0xe0, 0xf0, 0x00, 0x01, 0x03, 0x80, 0xf6, 0x00,
+	0x00, 0x60, 0xf0, 0x00, 0x00, 0x07, 0xf5, 0x00, 0x00, 0x30, 0xf0, 0x00,
+	0x00, 0x0e, 0xf5, 0x00, 0x00, 0x18, 0xf0, 0x00, 0x00, 0x1c, 0xf5, 0x00,
+	0x00, 0x0e, 0xf0, 0x00, 0x00, 0x38, 0xf5, 0x00, 0x00, 0x07, 0xf0, 0x00,
+	0x00, 0x70, 0xf5, 0x00, 0x01, 0x03, 0x80, 0xf1, 0x00, 0x00, 0xe0, 0xf5,
+	0x00, 0x01, 0x01, 0x80, 0xf2, 0x00, 0x01, 0x01, 0xc0, 0xf4, 0x00, 0x00,
+	0xe0, 0xf2, 0x00, 0x01, 0x03, 0x80, 0xf4, 0x00, 0x00, 0x70, 0xf2, 0x00,
+	0x00, 0x07, 0xf3, 0x00, 0x00, 0x38, 0xf2, 0x00, 0x00, 0x0e, 0xf3, 0x00,
+	0x00, 0x1c, 0xf2, 0x00, 0x00, 0x1c, 0xf3, 0x00, 0x00, 0x07, 0xf2, 0x00,
+	0x00, 0x70, 0xf3, 0x00, 0x01, 0x03, 0x80, 0xf3, 0x00, 0x00, 0xe0, 0xf3,
+	0x00, 0x01, 0x01, 0xc0, 0xf4, 0x00, 0x01, 0x03, 0xc0, 0xf2, 0x00, 0x00,
+	0x70, 0xf4, 0x00, 0x00, 0x07, 0xf1, 0x00, 0x00, 0x38, 0xf4, 0x00, 0x00,
+	0x1e, 0xf1, 0x00, 0x00, 0x0e, 0xf4, 0x00, 0x00, 0x38, 0xf1, 0x00, 0x01,
+	0x07, 0x80, 0xf5, 0x00, 0x00, 0xf0, 0xf1, 0x00, 0x01, 0x01, 0xc0, 0xf6,
+	0x00, 0x01, 0x01, 0xc0, 0xf0, 0x00, 0x00, 0xf0, 0xf6, 0x00, 0x00, 0x07,
+	0xef, 0x00, 0x00, 0x3c, 0xf6, 0x00, 0x00, 0x1e, 0xef, 0x00, 0x00, 0x0f,
+	0xf6, 0x00, 0x00, 0x78, 0xef, 0x00, 0x01, 0x01, 0xe0, 0xf8, 0x00, 0x01,
+	0x03, 0xc0, 0xee, 0x00, 0x00, 0x7c, 0xf8, 0x00, 0x00, 0x1f, 0xed, 0x00,
+	0x00, 0x1f, 0xf8, 0x00, 0x00, 0x7c, 0xed, 0x00, 0x01, 0x03, 0xe0, 0xfa,
+	0x00, 0x01, 0x03, 0xe0, 0xec, 0x00, 0x00, 0xfc, 0xfa, 0x00, 0x01, 0x1f,
+	0x80, 0xec, 0x00, 0x01, 0x1f, 0x80, 0xfc, 0x00, 0x01, 0x01, 0xfc, 0xeb,
+	0x00, 0x01, 0x03, 0xf8, 0xfc, 0x00, 0x01, 0x0f, 0xe0, 0xea, 0x00, 0x01,
+	0x3f, 0xc0, 0xfe, 0x00, 0x01, 0x01, 0xfe, 0xe9, 0x00, 0x06, 0x03, 0xff,
+	0x80, 0x00, 0x00, 0xff, 0xe0, 0xe8, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x00,
+	0xfc, 0xe6, 0x00, 0x02, 0x1f, 0xff, 0xfc, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0x81, 0x00, 0xe8, 0x00};
+uint16_t good_air_width = 248;
+uint16_t good_air_height = 248;
+uint16_t good_air_len = 2827;
+
+// 248x248, 7688 bytes uncompressed
+const uint8_t bad_air[] = {
+	0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00,
+	0x81, 0x00, 0xd4, 0x00, 0x02, 0x01, 0xff, 0xfc, 0xe6, 0x00, 0x00, 0x01,
+	0xfe, 0xff, 0x00, 0xf0, 0xe7, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0x00, 0xf0,
+	0xe9, 0x00, 0x00, 0x07, 0xfb, 0xff, 0xe9, 0x00, 0x00, 0x7f, 0xfb, 0xff,
+	0x00, 0xf0, 0xeb, 0x00, 0x00, 0x03, 0xfa, 0xff, 0x00, 0xfe, 0xeb, 0x00,
+	0x00, 0x1f, 0xf9, 0xff, 0x00, 0xc0, 0xec, 0x00, 0xf8, 0xff, 0x00, 0xf8,
+	0xed, 0x00, 0x00, 0x03, 0xf8, 0xff, 0x00, 0xfe, 0xed, 0x00, 0x00, 0x1f,
+	0xfe, 0xff, 0x03, 0xf0, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0x80, 0xee,
+	0x00, 0x00, 0x1f, 0xfe, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x0f, 0xfe, 0xff,
+	0x00, 0xc0, 0xee, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0x03, 0x1f,
+	0xff, 0xff, 0xf8, 0xef, 0x00, 0x03, 0x03, 0xff, 0xff, 0xfc, 0xfc, 0x00,
+	0x03, 0x01, 0xff, 0xff, 0xfc, 0xef, 0x00, 0x03, 0x0f, 0xff, 0xff, 0xc0,
+	0xfb, 0x00, 0x03, 0x1f, 0xff, 0xff, 0x80, 0xf0, 0x00, 0x02, 0x3f, 0xff,
+	0xfe, 0xfa, 0x00, 0x03, 0x03, 0xff, 0xff, 0xc0, 0xf0, 0x00, 0x02, 0x7f,
+	0xff, 0xf0, 0xf9, 0x00, 0x02, 0x7f, 0xff, 0xf0, 0xf0, 0x00, 0x02, 0xff,
+	0xff, 0xc0, 0xf9, 0x00, 0x02, 0x1f, 0xff, 0xf8, 0xf1, 0x00, 0x02, 0x03,
+	0xff, 0xff, 0xf8, 0x00, 0x02, 0x07, 0xff, 0xfc, 0xf1, 0x00, 0x02, 0x0f,
+	0xff, 0xf8, 0xf8, 0x00, 0x02, 0x01, 0xff, 0xff, 0xf1, 0x00, 0x02, 0x1f,
+	0xff, 0xe0, 0xf7, 0x00, 0x02, 0x7f, 0xff, 0x80, 0xf2, 0x00, 0x02, 0x7f,
+	0xff, 0x80, 0xf7, 0x00, 0x02, 0x1f, 0xff, 0xc0, 0xf2, 0x00, 0x01, 0xff,
+	0xff, 0xf6, 0x00, 0x02, 0x07, 0xff, 0xf0, 0xf3, 0x00, 0x02, 0x01, 0xff,
+	0xfc, 0xf6, 0x00, 0x02, 0x03, 0xff, 0xf8, 0xf3, 0x00, 0x02, 0x07, 0xff,
+	0xf0, 0xf5, 0x00, 0x01, 0xff, 0xfc, 0xf3, 0x00, 0x02, 0x0f, 0xff, 0xe0,
+	0xf5, 0x00, 0x01, 0x7f, 0xfe, 0xf3, 0x00, 0x02, 0x1f, 0xff, 0x80, 0xf5,
+	0x00, 0x01, 0x1f, 0xff, 0xf3, 0x00, 0x01, 0x7f, 0xfe, 0xf4, 0x00, 0x02,
+	0x07, 0xff, 0xc0, 0xf4, 0x00, 0x01, 0xff, 0xfc, 0xf4, 0x00, 0x02, 0x03,
+	0xff, 0xe0, 0xf5, 0x00, 0x02, 0x01, 0xff, 0xf0, 0xf4, 0x00, 0x02, 0x01,
+	0xff, 0xf0, 0xf5, 0x00, 0x02, 0x03, 0xff, 0xe0, 0xf3, 0x00, 0x01, 0x7f,
+	0xf8, 0xf5, 0x00, 0x02, 0x07, 0xff, 0xc0, 0xf3, 0x00, 0x01, 0x3f, 0xf8,
+	0xf5, 0x00, 0x01, 0x0f, 0xff, 0xf2, 0x00, 0x01, 0x1f, 0xfe, 0xf5, 0x00,
+	0x01, 0x1f, 0xfe, 0xf2, 0x00, 0x01, 0x0f, 0xfe, 0xf5, 0x00, 0x01, 0x3f,
+	0xfc, 0xf2, 0x00, 0x01, 0x07, 0xff, 0xf5, 0x00, 0x01, 0x7f, 0xf8, 0xf2,
+	0x00, 0x02, 0x03, 0xff, 0x80, 0xf6, 0x00, 0x01, 0xff, 0xf0, 0xf2, 0x00,
+	0x02, 0x01, 0xff, 0xc0, 0xf7, 0x00, 0x02, 0x01, 0xff, 0xe0, 0xf1, 0x00,
+	0x01, 0xff, 0xc0, 0xf7, 0x00, 0x02, 0x03, 0xff, 0xc0, 0xf1, 0x00, 0x01,
+	0x7f, 0xe0, 0xf7, 0x00, 0x02, 0x07, 0xff, 0x80, 0xf1, 0x00, 0x01, 0x7f,
+	0xf0, 0xf7, 0x00, 0x01, 0x07, 0xff, 0xf0, 0x00, 0x01, 0x3f, 0xf8, 0xf7,
+	0x00, 0x01, 0x0f, 0xfe, 0xf0, 0x00, 0x01, 0x1f, 0xf8, 0xf7, 0x00, 0x01,
+	0x1f, 0xfc, 0xf0, 0x00, 0x01, 0x0f, 0xfc, 0xf7, 0x00, 0x01, 0x1f, 0xfc,
+	0xf0, 0x00, 0x01, 0x0f, 0xfc, 0xf7, 0x00, 0x01, 0x3f, 0xf8, 0xf0, 0x00,
+	0x01, 0x07, 0xfe, 0xf7, 0x00, 0x01, 0x7f, 0xf0, 0xf0, 0x00, 0x01, 0x07,
+	0xfe, 0xf7, 0x00, 0x01, 0x7f, 0xe0, 0xfd, 0x00, 0x00, 0x0f, 0xf8, 0x00,
+	0x04, 0x01, 0xc0, 0x00, 0x03, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xc0, 0xfd,
+	0x00, 0x01, 0xff, 0xf8, 0xf9, 0x00, 0x04, 0x3f, 0xfe, 0x00, 0x01, 0xff,
+	0xf8, 0x00, 0x02, 0x01, 0xff, 0xc0, 0xfe, 0x00, 0x02, 0x03, 0xff, 0xfc,
+	0xf9, 0x00, 0x05, 0x7f, 0xff, 0x80, 0x01, 0xff, 0x80, 0xf9, 0x00, 0x02,
+	0x01, 0xff, 0x80, 0xfe, 0x00, 0x02, 0x0f, 0xff, 0xff, 0xfa, 0x00, 0x06,
+	0x01, 0xff, 0xff, 0xc0, 0x00, 0xff, 0x80, 0xf9, 0x00, 0x01, 0x03, 0xff,
+	0xfd, 0x00, 0x03, 0x1f, 0xe0, 0x3f, 0xc0, 0xfb, 0x00, 0x06, 0x07, 0xf8,
+	0x0f, 0xf0, 0x00, 0xff, 0xc0, 0xf9, 0x00, 0x01, 0x03, 0xff, 0xfd, 0x00,
+	0x03, 0x3f, 0x80, 0x07, 0xe0, 0xfb, 0x00, 0x06, 0x1f, 0xc0, 0x01, 0xf8,
+	0x00, 0x7f, 0xc0, 0xf9, 0x00, 0x01, 0x07, 0xfe, 0xfd, 0x00, 0x03, 0x7e,
+	0x00, 0x01, 0xf8, 0xfb, 0x00, 0x06, 0x3f, 0x00, 0x00, 0xf8, 0x00, 0x7f,
+	0xe0, 0xf9, 0x00, 0x01, 0x07, 0xfc, 0xfd, 0x00, 0x03, 0x7c, 0x00, 0x00,
+	0xfc, 0xfb, 0x00, 0x06, 0x7e, 0x00, 0x00, 0x7c, 0x00, 0x3f, 0xe0, 0xf9,
+	0x00, 0x01, 0x0f, 0xfc, 0xfd, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x7e, 0xfb,
+	0x00, 0x06, 0xf8, 0x00, 0x00, 0x3e, 0x00, 0x3f, 0xf0, 0xf9, 0x00, 0x01,
+	0x0f, 0xf8, 0xfd, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x07,
+	0x01, 0xf0, 0x00, 0x00, 0x1e, 0x00, 0x1f, 0xf0, 0xf9, 0x00, 0x01, 0x1f,
+	0xf0, 0xfe, 0x00, 0x05, 0x01, 0xe0, 0x00, 0x00, 0x0f, 0x80, 0xfd, 0x00,
+	0x07, 0x03, 0xe0, 0x00, 0x00, 0x0f, 0x00, 0x1f, 0xf8, 0xf9, 0x00, 0x01,
+	0x3f, 0xf0, 0xfd, 0x00, 0x04, 0x80, 0x00, 0x00, 0x07, 0x80, 0xfd, 0x00,
+	0x07, 0x03, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x0f, 0xf8, 0xf9, 0x00, 0x01,
+	0x3f, 0xe0, 0xfa, 0x00, 0x01, 0x03, 0xc0, 0xfd, 0x00, 0x01, 0x07, 0x80,
+	0xfd, 0x00, 0x01, 0x0f, 0xfc, 0xf9, 0x00, 0x01, 0x7f, 0xe0, 0xfa, 0x00,
+	0x01, 0x01, 0xe0, 0xfd, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x01, 0x07, 0xfc,
+	0xf9, 0x00, 0x01, 0x7f, 0xc0, 0xfa, 0x00, 0x01, 0x01, 0xe0, 0xfd, 0x00,
+	0x00, 0x0e, 0xfc, 0x00, 0x01, 0x07, 0xfc, 0xf9, 0x00, 0x01, 0xff, 0xc0,
+	0xf9, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0x1e, 0xfc, 0x00, 0x01, 0x03,
+	0xfe, 0xf9, 0x00, 0x01, 0xff, 0x80, 0xf9, 0x00, 0x00, 0x70, 0xfd, 0x00,
+	0x00, 0x1c, 0xfc, 0x00, 0x01, 0x03, 0xfe, 0xfa, 0x00, 0x02, 0x01, 0xff,
+	0x80, 0xf9, 0x00, 0x00, 0x38, 0xfd, 0x00, 0x00, 0x18, 0xfc, 0x00, 0x01,
+	0x03, 0xfe, 0xfa, 0x00, 0x01, 0x01, 0xff, 0xf8, 0x00, 0x00, 0x38, 0xfd,
+	0x00, 0x00, 0x38, 0xfc, 0x00, 0x01, 0x01, 0xff, 0xfa, 0x00, 0x01, 0x01,
+	0xff, 0xfa, 0x00, 0x02, 0x03, 0xff, 0xf8, 0xfd, 0x00, 0x02, 0x3f, 0xff,
+	0x80, 0xfe, 0x00, 0x01, 0x01, 0xff, 0xfa, 0x00, 0x01, 0x03, 0xfe, 0xfb,
+	0x00, 0x03, 0x01, 0xff, 0xff, 0xf8, 0xfd, 0x00, 0x02, 0x3f, 0xff, 0xfe,
+	0xfe, 0x00, 0x01, 0x01, 0xff, 0xfa, 0x00, 0x01, 0x03, 0xfe, 0xfb, 0x00,
+	0x03, 0x3f, 0xff, 0xff, 0xf8, 0xfd, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xf0,
+	0xfe, 0x00, 0x01, 0xff, 0x80, 0xfb, 0x00, 0x01, 0x03, 0xfe, 0xfc, 0x00,
+	0x00, 0x01, 0xfe, 0xff, 0x00, 0x80, 0xfd, 0x00, 0x00, 0x03, 0xfe, 0xff,
+	0xfe, 0x00, 0x01, 0xff, 0x80, 0xfb, 0x00, 0x01, 0x03, 0xfc, 0xfc, 0x00,
+	0x02, 0x07, 0xff, 0xe0, 0xf9, 0x00, 0x06, 0x0f, 0xff, 0xc0, 0x00, 0x00,
+	0xff, 0x80, 0xfb, 0x00, 0x01, 0x03, 0xfc, 0xfc, 0x00, 0x01, 0x1f, 0xfc,
+	0xf7, 0x00, 0x05, 0x7f, 0xf0, 0x00, 0x00, 0xff, 0x80, 0xfb, 0x00, 0x01,
+	0x03, 0xfc, 0xfc, 0x00, 0x01, 0x1f, 0xc0, 0xf7, 0x00, 0x05, 0x07, 0xf0,
+	0x00, 0x00, 0x7f, 0xc0, 0xfb, 0x00, 0x01, 0x03, 0xf8, 0xfc, 0x00, 0x00,
+	0x0c, 0xf5, 0x00, 0x04, 0x60, 0x00, 0x00, 0x7f, 0xc0, 0xfb, 0x00, 0x01,
+	0x03, 0xf8, 0xec, 0x00, 0x01, 0x7f, 0xc0, 0xfb, 0x00, 0x01, 0x03, 0xf8,
+	0xec, 0x00, 0x01, 0x7f, 0xc0, 0xfb, 0x00, 0x01, 0x03, 0xf8, 0xec, 0x00,
+	0x01, 0x7f, 0xc0, 0xfb, 0x00, 0x01, 0x07, 0xf0, 0xec, 0x00, 0x01, 0x3f,
+	0xc0, 0xfb, 0x00, 0x01, 0x07, 0xf0, 0xec, 0x00, 0x01, 0x3f, 0xe0, 0xfb,
+	0x00, 0x01, 0x07, 0xf0, 0xec, 0x00, 0x01, 0x3f, 0xe0, 0xfb, 0x00, 0x01,
+	0x07, 0xe0, 0xec, 0x00, 0x01, 0x3f, 0xe0, 0xfb, 0x00, 0x01, 0x07, 0xe0,
+	0xec, 0x00, 0x01, 0x3f, 0xe0, 0xfb, 0x00, 0x01, 0x0f, 0xe0, 0xec, 0x00,
+	0x01, 0x1f, 0xe0, 0xfb, 0x00, 0x01, 0x0f, 0xe0, 0xec, 0x00, 0x01, 0x1f,
+	0xe0, 0xfb, 0x00, 0x01, 0x0f, 0xe0, 0xec, 0x00, 0x01, 0x1f, 0xe0, 0xfb,
+	0x00, 0x01, 0x1f, 0xc0, 0xec, 0x00, 0x01, 0x1f, 0xe0, 0xfb, 0x00, 0x01,
+	0x3f, 0xc0, 0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfb, 0x00, 0x01, 0x3f, 0xc0,
+	0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfb, 0x00, 0x01, 0x3f, 0xc0, 0xec, 0x00,
+	0x01, 0x1f, 0xf0, 0xfb, 0x00, 0x01, 0x3f, 0xc0, 0xec, 0x00, 0x01, 0x1f,
+	0xf0, 0xfb, 0x00, 0x01, 0x7f, 0xc0, 0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfb,
+	0x00, 0x01, 0xff, 0xc0, 0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfb, 0x00, 0x01,
+	0xff, 0x80, 0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0x80,
+	0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfd, 0x00, 0x03, 0x03, 0x00, 0xff, 0x80,
+	0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfd, 0x00, 0x03, 0x1f, 0x00, 0xff, 0x80,
+	0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfd, 0x00, 0x03, 0x7f, 0x00, 0xff, 0x80,
+	0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfe, 0x00, 0x04, 0x01, 0xfe, 0x00, 0xff,
+	0x80, 0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfe, 0x00, 0x04, 0x07, 0xf8, 0x00,
+	0xff, 0x80, 0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfe, 0x00, 0x04, 0x1f, 0xe0,
+	0x00, 0xff, 0x80, 0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfe, 0x00, 0x04, 0x7f,
+	0x80, 0x00, 0xff, 0x80, 0xec, 0x00, 0x01, 0x1f, 0xf0, 0xfe, 0x00, 0x04,
+	0xfe, 0x00, 0x00, 0xff, 0x80, 0xec, 0x00, 0x09, 0x1f, 0xf0, 0x00, 0x00,
+	0x03, 0xf8, 0x00, 0x00, 0xff, 0x80, 0xf4, 0x00, 0x04, 0x8f, 0x00, 0x00,
+	0x02, 0x78, 0xfe, 0x00, 0x09, 0x1f, 0xf0, 0x00, 0x00, 0x0f, 0xe0, 0x00,
+	0x00, 0xff, 0x80, 0xf6, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x02, 0x80, 0x7e,
+	0x7e, 0xfe, 0x00, 0x09, 0x1f, 0xf0, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00,
+	0xff, 0x80, 0xf7, 0x00, 0x01, 0x0e, 0x3f, 0xfe, 0xff, 0x0a, 0xf9, 0xff,
+	0x3f, 0x80, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x01,
+	0xff, 0x80, 0xf8, 0x00, 0x01, 0x01, 0xe0, 0xfa, 0xff, 0x07, 0xc0, 0x00,
+	0x00, 0x1f, 0xe0, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x01, 0xff, 0x80, 0xf8,
+	0x00, 0x00, 0x0f, 0xf9, 0xff, 0x07, 0xf0, 0x00, 0x00, 0x1f, 0xe0, 0x00,
+	0x03, 0xf8, 0xfe, 0x00, 0x01, 0xff, 0x80, 0xf8, 0x00, 0x00, 0x3f, 0xf9,
+	0xff, 0x07, 0xf0, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x07, 0xe0, 0xfe, 0x00,
+	0x01, 0xff, 0xc0, 0xf8, 0x00, 0x00, 0x7f, 0xf9, 0xff, 0x07, 0xf8, 0x00,
+	0x00, 0x1f, 0xe0, 0x00, 0x0f, 0xe0, 0xfe, 0x00, 0x01, 0xff, 0xc0, 0xf9,
+	0x00, 0x00, 0x01, 0xf8, 0xff, 0x07, 0xfc, 0x00, 0x00, 0x3f, 0xe0, 0x00,
+	0x1f, 0x80, 0xfe, 0x00, 0x01, 0x7f, 0xc0, 0xf9, 0x00, 0x00, 0x03, 0xf8,
+	0xff, 0x06, 0xfc, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x7f, 0xfd, 0x00, 0x01,
+	0x7f, 0xc0, 0xf9, 0x00, 0x00, 0x07, 0xfa, 0xff, 0x08, 0xf0, 0x0f, 0xfe,
+	0x00, 0x00, 0x3f, 0xe0, 0x00, 0xfc, 0xfd, 0x00, 0x01, 0x3f, 0xc0, 0xf9,
+	0x00, 0x00, 0x0f, 0xfa, 0xff, 0x08, 0xe0, 0x0f, 0xff, 0xc0, 0x00, 0x3f,
+	0xe0, 0x03, 0xf0, 0xfd, 0x00, 0x01, 0x3f, 0xc0, 0xf9, 0x00, 0x00, 0x0f,
+	0xfa, 0xff, 0x08, 0xc0, 0x3f, 0xff, 0xf0, 0x00, 0x3f, 0xe0, 0x07, 0xe0,
+	0xfd, 0x00, 0x01, 0x3f, 0xc0, 0xf9, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x08,
+	0x80, 0xff, 0xff, 0xf8, 0x00, 0x3f, 0xc0, 0x07, 0xc0, 0xfd, 0x00, 0x01,
+	0x3f, 0xe0, 0xf9, 0x00, 0x00, 0x1f, 0xfa, 0xff, 0x07, 0x01, 0xff, 0xff,
+	0xfc, 0x00, 0x7f, 0xc0, 0x0f, 0xfc, 0x00, 0x01, 0x3f, 0xe0, 0xf9, 0x00,
+	0x00, 0x1f, 0xfb, 0xff, 0x07, 0xfe, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x7f,
+	0xc0, 0xfb, 0x00, 0x01, 0x3f, 0xe0, 0xf9, 0x00, 0x00, 0x0f, 0xfb, 0xff,
+	0x01, 0xfc, 0x07, 0xfe, 0xff, 0x02, 0x00, 0x7f, 0xc0, 0xfb, 0x00, 0x01,
+	0x3f, 0xe0, 0xf9, 0x00, 0x00, 0x0f, 0xfb, 0xff, 0x01, 0xf8, 0x0f, 0xfe,
+	0xff, 0x02, 0x00, 0x7f, 0x80, 0xfb, 0x00, 0x01, 0x1f, 0xe0, 0xf9, 0x00,
+	0x00, 0x0f, 0xfb, 0xff, 0x07, 0xf8, 0x1f, 0xff, 0xcf, 0xff, 0x80, 0xff,
+	0x80, 0xfb, 0x00, 0x01, 0x1f, 0xf0, 0xf9, 0x00, 0x00, 0x07, 0xfb, 0xff,
+	0x07, 0xf0, 0x3f, 0xfe, 0x01, 0xff, 0x80, 0xff, 0x80, 0xfb, 0x00, 0x01,
+	0x1f, 0xf0, 0xf9, 0x00, 0x00, 0x03, 0xfb, 0xff, 0x07, 0xf0, 0x3f, 0xf8,
+	0x00, 0xff, 0xc0, 0xff, 0x80, 0xfb, 0x00, 0x01, 0x1f, 0xf0, 0xf9, 0x00,
+	0x00, 0x01, 0xfb, 0xff, 0x06, 0xe0, 0x7f, 0xf0, 0x00, 0xff, 0xc0, 0xff,
+	0xfa, 0x00, 0x01, 0x0f, 0xf8, 0xf8, 0x00, 0xfb, 0xff, 0x06, 0xe0, 0xff,
+	0xe0, 0x07, 0xff, 0xc1, 0xff, 0xfe, 0x00, 0x05, 0x01, 0xf0, 0x00, 0x00,
+	0x0f, 0xf8, 0xf8, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0x06, 0xc1, 0xff, 0xc0,
+	0x3f, 0xff, 0xf9, 0xff, 0xfe, 0x00, 0x05, 0xff, 0xf8, 0x00, 0x00, 0x0f,
+	0xf8, 0xf8, 0x00, 0x00, 0x1f, 0xfc, 0xff, 0x03, 0xdf, 0xff, 0x80, 0x7f,
+	0xfe, 0xff, 0x08, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xfc,
+	0xf8, 0x00, 0x00, 0x07, 0xfa, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x09, 0xfe,
+	0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x07, 0xfc, 0xf8, 0x00, 0x00,
+	0x01, 0xfa, 0xff, 0x00, 0xf1, 0xfe, 0xff, 0x04, 0xfe, 0x00, 0x03, 0xff,
+	0xf0, 0xfe, 0x00, 0x01, 0x07, 0xfc, 0xf7, 0x00, 0x00, 0x7f, 0xfb, 0xff,
+	0x00, 0xf3, 0xfe, 0xff, 0x03, 0xfe, 0x00, 0x0f, 0xfc, 0xfd, 0x00, 0x01,
+	0x03, 0xfe, 0xf7, 0x00, 0x00, 0x0f, 0xf7, 0xff, 0x03, 0xfc, 0x00, 0x3f,
+	0xc0, 0xfd, 0x00, 0x01, 0x03, 0xfe, 0xf6, 0x00, 0x03, 0xff, 0xff, 0xf8,
+	0x7f, 0xfd, 0xff, 0x04, 0x83, 0xff, 0xfc, 0x00, 0x3e, 0xfc, 0x00, 0x01,
+	0x03, 0xff, 0xf5, 0x00, 0x01, 0x70, 0x00, 0xfd, 0xff, 0x05, 0xfe, 0x00,
+	0xff, 0xfc, 0x00, 0x38, 0xfc, 0x00, 0x01, 0x01, 0xff, 0xf4, 0x00, 0x00,
+	0x03, 0xfd, 0xff, 0x03, 0xfc, 0x00, 0x7f, 0xf8, 0xfa, 0x00, 0x01, 0x01,
+	0xff, 0xf4, 0x00, 0x08, 0x07, 0xff, 0xfc, 0x07, 0xff, 0xf8, 0x00, 0x3f,
+	0xf8, 0xf9, 0x00, 0x01, 0xff, 0x80, 0xf5, 0x00, 0x08, 0x0f, 0xff, 0xe0,
+	0x03, 0xff, 0xf0, 0x00, 0x3f, 0xf0, 0xf9, 0x00, 0x01, 0xff, 0x80, 0xf5,
+	0x00, 0x08, 0x0f, 0xff, 0x80, 0x07, 0xff, 0xe0, 0x00, 0x3f, 0xf0, 0xf9,
+	0x00, 0x01, 0x7f, 0xc0, 0xf5, 0x00, 0x08, 0x1f, 0xfe, 0x00, 0x07, 0xff,
+	0xc0, 0x00, 0x1f, 0xf0, 0xf9, 0x00, 0x01, 0x7f, 0xc0, 0xf5, 0x00, 0x08,
+	0x3f, 0xfc, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x1f, 0xf0, 0xf9, 0x00, 0x01,
+	0x3f, 0xe0, 0xf5, 0x00, 0x08, 0x3f, 0xf8, 0x00, 0x1f, 0xff, 0x80, 0x00,
+	0x1f, 0xf0, 0xf9, 0x00, 0x01, 0x3f, 0xf0, 0xf5, 0x00, 0x08, 0x7f, 0xe0,
+	0x00, 0x7f, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0xf9, 0x00, 0x01, 0x3f, 0xf0,
+	0xf5, 0x00, 0x08, 0x7f, 0xe0, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x1f, 0xf0,
+	0xf9, 0x00, 0x01, 0x1f, 0xf8, 0xf5, 0x00, 0x08, 0x7f, 0xc0, 0x01, 0xff,
+	0xfe, 0x00, 0x00, 0x1f, 0xf0, 0xf9, 0x00, 0x01, 0x0f, 0xfc, 0xf5, 0x00,
+	0x0a, 0xff, 0x80, 0x03, 0xff, 0xfc, 0x00, 0xe0, 0x1f, 0xf0, 0x00, 0xfe,
+	0xfb, 0x00, 0x01, 0x0f, 0xfc, 0xf5, 0x00, 0x0b, 0xff, 0x80, 0x0f, 0xff,
+	0xfc, 0x03, 0xf8, 0x1f, 0xf0, 0x00, 0xff, 0xe0, 0xfc, 0x00, 0x01, 0x07,
+	0xfe, 0xf5, 0x00, 0x0b, 0xff, 0x80, 0x3f, 0xff, 0xf8, 0x0f, 0xf8, 0x1f,
+	0xe0, 0x00, 0xff, 0xfc, 0xfc, 0x00, 0x01, 0x07, 0xff, 0xf5, 0x00, 0x0c,
+	0x7f, 0x80, 0xff, 0xff, 0xf8, 0x1f, 0xfc, 0x3f, 0xe0, 0x00, 0x1f, 0xff,
+	0x80, 0xfd, 0x00, 0x02, 0x03, 0xff, 0x80, 0xf6, 0x00, 0x0c, 0x7f, 0xc1,
+	0xff, 0xff, 0xf8, 0x7f, 0xfc, 0x3f, 0xe0, 0x00, 0x00, 0xff, 0xe0, 0xfd,
+	0x00, 0x02, 0x01, 0xff, 0x80, 0xf6, 0x00, 0x0c, 0x7f, 0xc3, 0xff, 0xff,
+	0xf3, 0xff, 0xfc, 0x3f, 0xe0, 0x00, 0x00, 0x0f, 0xfc, 0xfd, 0x00, 0x02,
+	0x01, 0xff, 0xc0, 0xf6, 0x00, 0x01, 0x7f, 0xe3, 0xfd, 0xff, 0x06, 0xf8,
+	0x3f, 0xe0, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xe0, 0xf6,
+	0x00, 0x08, 0x3f, 0xf3, 0xff, 0xcf, 0xff, 0xff, 0xf0, 0x7f, 0xc0, 0xfe,
+	0x00, 0x01, 0x7f, 0xc0, 0xfd, 0x00, 0x01, 0x7f, 0xf0, 0xf6, 0x00, 0x08,
+	0x3f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xe0, 0x7f, 0xc0, 0xfe, 0x00, 0x01,
+	0x1f, 0xf0, 0xfd, 0x00, 0x01, 0x3f, 0xf8, 0xf6, 0x00, 0x08, 0x1f, 0xff,
+	0xfe, 0x0f, 0xff, 0xff, 0x80, 0x7f, 0xc0, 0xfe, 0x00, 0x01, 0x03, 0xfc,
+	0xfd, 0x00, 0x01, 0x3f, 0xfc, 0xf6, 0x00, 0x08, 0x0f, 0xff, 0xf8, 0x07,
+	0xff, 0xff, 0x00, 0xff, 0xc0, 0xfd, 0x00, 0x00, 0xfe, 0xfd, 0x00, 0x01,
+	0x1f, 0xfe, 0xf6, 0x00, 0x08, 0x0f, 0xff, 0xe0, 0x07, 0xff, 0xfc, 0x00,
+	0xff, 0x80, 0xfd, 0x00, 0x01, 0x3f, 0x80, 0xfe, 0x00, 0x01, 0x0f, 0xff,
+	0xf6, 0x00, 0x09, 0x07, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x00, 0xff, 0x80,
+	0x10, 0xfe, 0x00, 0x01, 0x0f, 0xe0, 0xfe, 0x00, 0x02, 0x07, 0xff, 0x80,
+	0xf7, 0x00, 0x09, 0x03, 0xff, 0xf0, 0x00, 0xff, 0x80, 0x01, 0xff, 0x80,
+	0x3c, 0xfe, 0x00, 0x01, 0x03, 0xf8, 0xfe, 0x00, 0x02, 0x03, 0xff, 0xe0,
+	0xf6, 0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0x01, 0xff, 0x00, 0x3f,
+	0xfd, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x02, 0x01, 0xff, 0xf0, 0xf6, 0x00,
+	0x01, 0x7f, 0xf0, 0xfe, 0x00, 0x04, 0x03, 0xff, 0x00, 0x1f, 0x80, 0xfe,
+	0x00, 0x01, 0x3f, 0x80, 0xfe, 0x00, 0x01, 0xff, 0xf8, 0xf6, 0x00, 0x01,
+	0x3f, 0xf8, 0xfe, 0x00, 0x04, 0x03, 0xfe, 0x00, 0x0f, 0xc0, 0xfe, 0x00,
+	0x01, 0x1f, 0xc0, 0xfe, 0x00, 0x01, 0x7f, 0xfc, 0xf6, 0x00, 0x01, 0x1f,
+	0xfc, 0xfe, 0x00, 0x04, 0x07, 0xfe, 0x00, 0x07, 0xe0, 0xfe, 0x00, 0x01,
+	0x03, 0xf0, 0xfe, 0x00, 0x01, 0x3f, 0xff, 0xf6, 0x00, 0x01, 0x0f, 0xfe,
+	0xfe, 0x00, 0x04, 0x0f, 0xfc, 0x00, 0x03, 0xe0, 0xfe, 0x00, 0x01, 0x01,
+	0xfc, 0xfe, 0x00, 0x02, 0x1f, 0xff, 0x80, 0xf7, 0x00, 0x01, 0x0f, 0xff,
+	0xfe, 0x00, 0x04, 0x1f, 0xfc, 0x00, 0x01, 0xf0, 0xfd, 0x00, 0x00, 0x7e,
+	0xfe, 0x00, 0x02, 0x0f, 0xff, 0xc0, 0xf7, 0x00, 0x09, 0x07, 0xff, 0xc0,
+	0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0x3e, 0xfe,
+	0x00, 0x02, 0x03, 0xff, 0xf0, 0xf7, 0x00, 0x09, 0x03, 0xff, 0xf0, 0x00,
+	0x00, 0x7f, 0xf0, 0x00, 0x00, 0x78, 0xfd, 0x00, 0x00, 0x0c, 0xfe, 0x00,
+	0x02, 0x01, 0xff, 0xf8, 0xf7, 0x00, 0x09, 0x01, 0xff, 0xfc, 0x00, 0x01,
+	0xff, 0xf0, 0x00, 0x00, 0x10, 0xf8, 0x00, 0x01, 0xff, 0xfe, 0xf6, 0x00,
+	0x05, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xe0, 0xf5, 0x00, 0x02, 0x7f, 0xff,
+	0x80, 0xf7, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0x00, 0xc0, 0xf5, 0x00, 0x02,
+	0x1f, 0xff, 0xe0, 0xf7, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x00, 0x80, 0xf5,
+	0x00, 0x02, 0x0f, 0xff, 0xf8, 0xf7, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0xf4,
+	0x00, 0x02, 0x03, 0xff, 0xfe, 0xf7, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x00,
+	0xfe, 0xf4, 0x00, 0x03, 0x01, 0xff, 0xff, 0x80, 0xf8, 0x00, 0x00, 0x01,
+	0xfe, 0xff, 0x00, 0xfc, 0xf3, 0x00, 0x02, 0x7f, 0xff, 0xf0, 0xf8, 0x00,
+	0x00, 0x07, 0xfe, 0xff, 0x00, 0xf0, 0xf3, 0x00, 0x02, 0x7f, 0xff, 0xf0,
+	0xf8, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xe0, 0xf3, 0x00, 0x03, 0x1f,
+	0xff, 0xff, 0x80, 0xf9, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0xf2, 0x00, 0x03,
+	0x03, 0xff, 0xff, 0xf0, 0xfa, 0x00, 0x04, 0x03, 0xff, 0xff, 0xdf, 0xf0,
+	0xf2, 0x00, 0x00, 0x01, 0xfe, 0xff, 0xfa, 0x00, 0x02, 0x3f, 0xff, 0xff,
+	0xef, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xf0, 0xfc, 0x00, 0x03, 0x01, 0xff,
+	0xff, 0xfc, 0xef, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0x80, 0xfd, 0x00,
+	0x03, 0x3f, 0xff, 0xff, 0xf0, 0xef, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x00,
+	0xfe, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xc0, 0xee, 0x00, 0xf6,
+	0xff, 0xed, 0x00, 0x00, 0x1f, 0xf8, 0xff, 0x00, 0xfc, 0xed, 0x00, 0x00,
+	0x03, 0xf8, 0xff, 0x00, 0xe0, 0xec, 0x00, 0x00, 0x7f, 0xf9, 0xff, 0xeb,
+	0x00, 0x00, 0x0f, 0xfa, 0xff, 0x00, 0xf8, 0xea, 0x00, 0xfa, 0xff, 0x00,
+	0xc0, 0xea, 0x00, 0x00, 0x0f, 0xfc, 0xff, 0x00, 0xfc, 0xe8, 0x00, 0x00,
+	0x3f, 0xfe, 0xff, 0x01, 0x7f, 0x80, 0xe7, 0x00, 0x02, 0x03, 0xff, 0xf8,
+	0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00,
+	0x81, 0x00, 0x90, 0x00};
+uint16_t bad_air_width = 248;
+uint16_t bad_air_height = 248;
+uint16_t bad_air_len = 2920;
+
+// 248x248, 7688 bytes uncompressed
+const uint8_t worried_air[] = {
+	0x81, 0x00, 0xd9, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0xfc, 0xe8, 0x00,
+	0x00, 0x0f, 0xfc, 0xff, 0x00, 0xf0, 0xea, 0x00, 0x00, 0x02, 0xfa, 0xff,
+	0x00, 0x40, 0xeb, 0x00, 0x00, 0x1f, 0xfa, 0xff, 0x00, 0xf8, 0xeb, 0x00,
+	0xf8, 0xff, 0xec, 0x00, 0x00, 0x07, 0xf8, 0xff, 0x00, 0xe0, 0xed, 0x00,
+	0x00, 0x3f, 0xf8, 0xff, 0x00, 0xfc, 0xed, 0x00, 0x00, 0x3f, 0xf8, 0xff,
+	0x00, 0xfe, 0xee, 0x00, 0x00, 0x01, 0xfd, 0xff, 0x02, 0xc0, 0x00, 0x03,
+	0xfd, 0xff, 0x00, 0x80, 0xef, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xc0,
+	0xfe, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x00, 0xf0, 0xef, 0x00, 0x03, 0x3f,
+	0xff, 0xff, 0xf0, 0xfc, 0x00, 0x03, 0x0f, 0xff, 0xff, 0xfc, 0xef, 0x00,
+	0x02, 0xff, 0xff, 0xfe, 0xfa, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xf0, 0x00,
+	0x03, 0x03, 0xff, 0xff, 0xf0, 0xfa, 0x00, 0x03, 0x0f, 0xff, 0xff, 0xc0,
+	0xf1, 0x00, 0x03, 0x0f, 0xff, 0xff, 0x80, 0xfa, 0x00, 0x03, 0x01, 0xff,
+	0xff, 0xf0, 0xf1, 0x00, 0x02, 0x3f, 0xff, 0xfc, 0xf8, 0x00, 0x02, 0x3f,
+	0xff, 0xfc, 0xf2, 0x00, 0x03, 0x01, 0xff, 0xff, 0xe0, 0xf8, 0x00, 0x03,
+	0x07, 0xff, 0xff, 0x80, 0xf3, 0x00, 0x03, 0x01, 0xff, 0xff, 0x80, 0xf8,
+	0x00, 0x03, 0x01, 0xff, 0xff, 0x80, 0xf3, 0x00, 0x02, 0x07, 0xff, 0xfe,
+	0xf6, 0x00, 0x02, 0x7f, 0xff, 0xe0, 0xf3, 0x00, 0x02, 0x0f, 0xff, 0xf0,
+	0xf6, 0x00, 0x02, 0x0f, 0xff, 0xf0, 0xf3, 0x00, 0x02, 0x3f, 0xff, 0xc0,
+	0xf6, 0x00, 0x02, 0x03, 0xff, 0xfc, 0xf3, 0x00, 0x01, 0xff, 0xff, 0xf4,
+	0x00, 0x01, 0xff, 0xfe, 0xf4, 0x00, 0x02, 0x01, 0xff, 0xfe, 0xf4, 0x00,
+	0x02, 0x7f, 0xff, 0x80, 0xf5, 0x00, 0x02, 0x07, 0xff, 0xf8, 0xf4, 0x00,
+	0x02, 0x0f, 0xff, 0xe0, 0xf5, 0x00, 0x02, 0x0f, 0xff, 0xe0, 0xf4, 0x00,
+	0x02, 0x07, 0xff, 0xf0, 0xf5, 0x00, 0x02, 0x1f, 0xff, 0x80, 0xf4, 0x00,
+	0x02, 0x01, 0xff, 0xf8, 0xf5, 0x00, 0x01, 0x7f, 0xff, 0xf2, 0x00, 0x01,
+	0xff, 0xfe, 0xf5, 0x00, 0x01, 0xff, 0xfc, 0xf2, 0x00, 0x01, 0x3f, 0xff,
+	0xf6, 0x00, 0x02, 0x01, 0xff, 0xf8, 0xf2, 0x00, 0x02, 0x1f, 0xff, 0x80,
+	0xf7, 0x00, 0x02, 0x03, 0xff, 0xe0, 0xf2, 0x00, 0x02, 0x07, 0xff, 0xc0,
+	0xf7, 0x00, 0x02, 0x07, 0xff, 0xc0, 0xf2, 0x00, 0x02, 0x03, 0xff, 0xe0,
+	0xf7, 0x00, 0x02, 0x0f, 0xff, 0x80, 0xf2, 0x00, 0x02, 0x01, 0xff, 0xf0,
+	0xf7, 0x00, 0x01, 0x0f, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xf0, 0xf7, 0x00,
+	0x01, 0x3f, 0xfe, 0xf0, 0x00, 0x01, 0x7f, 0xfc, 0xf7, 0x00, 0x01, 0x7f,
+	0xfc, 0xf0, 0x00, 0x01, 0x3f, 0xfe, 0xf7, 0x00, 0x01, 0xff, 0xf8, 0xf0,
+	0x00, 0x01, 0x1f, 0xff, 0xf8, 0x00, 0x02, 0x01, 0xff, 0xf0, 0xf0, 0x00,
+	0x02, 0x0f, 0xff, 0x80, 0xf9, 0x00, 0x02, 0x01, 0xff, 0xc0, 0xf0, 0x00,
+	0x02, 0x07, 0xff, 0x80, 0xf9, 0x00, 0x02, 0x07, 0xff, 0x80, 0xf0, 0x00,
+	0x02, 0x01, 0xff, 0xe0, 0xf9, 0x00, 0x02, 0x07, 0xff, 0x80, 0xf0, 0x00,
+	0x02, 0x01, 0xff, 0xe0, 0xf9, 0x00, 0x01, 0x0f, 0xff, 0xee, 0x00, 0x01,
+	0xff, 0xf0, 0xf9, 0x00, 0x01, 0x1f, 0xfe, 0xee, 0x00, 0x01, 0x7f, 0xf8,
+	0xf9, 0x00, 0x01, 0x3f, 0xfc, 0xee, 0x00, 0x01, 0x3f, 0xfc, 0xf9, 0x00,
+	0x01, 0x7f, 0xf8, 0xee, 0x00, 0x01, 0x1f, 0xfe, 0xf9, 0x00, 0x01, 0x7f,
+	0xf0, 0xee, 0x00, 0x01, 0x0f, 0xfe, 0xf9, 0x00, 0x01, 0xff, 0xe0, 0xee,
+	0x00, 0x01, 0x07, 0xff, 0xfa, 0x00, 0x02, 0x03, 0xff, 0xc0, 0xee, 0x00,
+	0x02, 0x03, 0xff, 0xc0, 0xfb, 0x00, 0x01, 0x07, 0xff, 0xec, 0x00, 0x01,
+	0xff, 0xe0, 0xfb, 0x00, 0x01, 0x07, 0xfe, 0xec, 0x00, 0x01, 0x7f, 0xe0,
+	0xfb, 0x00, 0x01, 0x0f, 0xfc, 0xec, 0x00, 0x01, 0x3f, 0xf0, 0xfb, 0x00,
+	0x01, 0x1f, 0xfc, 0xec, 0x00, 0x01, 0x3f, 0xf8, 0xfb, 0x00, 0x01, 0x1f,
+	0xf8, 0xec, 0x00, 0x01, 0x1f, 0xf8, 0xfb, 0x00, 0x01, 0x3f, 0xf0, 0xec,
+	0x00, 0x01, 0x0f, 0xfc, 0xfb, 0x00, 0x01, 0x7f, 0xe0, 0xec, 0x00, 0x01,
+	0x07, 0xfe, 0xfb, 0x00, 0x01, 0xff, 0xc0, 0xec, 0x00, 0x01, 0x03, 0xff,
+	0xfb, 0x00, 0x01, 0xff, 0xc0, 0xec, 0x00, 0x01, 0x03, 0xff, 0xfc, 0x00,
+	0x02, 0x01, 0xff, 0x80, 0xec, 0x00, 0x02, 0x01, 0xff, 0x80, 0xfd, 0x00,
+	0x01, 0x03, 0xff, 0xea, 0x00, 0x01, 0xff, 0xc0, 0xfd, 0x00, 0x01, 0x03,
+	0xff, 0xea, 0x00, 0x01, 0xff, 0xc0, 0xfd, 0x00, 0x01, 0x07, 0xfe, 0xea,
+	0x00, 0x01, 0x7f, 0xe0, 0xfd, 0x00, 0x01, 0x07, 0xfe, 0xea, 0x00, 0x01,
+	0x7f, 0xe0, 0xfd, 0x00, 0x01, 0x0f, 0xfc, 0xea, 0x00, 0x01, 0x3f, 0xf0,
+	0xfd, 0x00, 0x01, 0x0f, 0xfc, 0xea, 0x00, 0x01, 0x1f, 0xf0, 0xfd, 0x00,
+	0x01, 0x1f, 0xf8, 0xea, 0x00, 0x01, 0x1f, 0xf8, 0xfd, 0x00, 0x01, 0x1f,
+	0xf0, 0xea, 0x00, 0x01, 0x0f, 0xf8, 0xfd, 0x00, 0x01, 0x3f, 0xf0, 0xea,
+	0x00, 0x01, 0x0f, 0xfc, 0xfd, 0x00, 0x01, 0x3f, 0xe0, 0xea, 0x00, 0x01,
+	0x07, 0xfc, 0xfd, 0x00, 0x01, 0x7f, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xfe,
+	0xfd, 0x00, 0x01, 0x7f, 0xc0, 0xea, 0x00, 0x01, 0x03, 0xfe, 0xfd, 0x00,
+	0x01, 0x7f, 0xc0, 0xea, 0x00, 0x01, 0x03, 0xfe, 0xfd, 0x00, 0x01, 0xff,
+	0x80, 0xea, 0x00, 0x01, 0x01, 0xff, 0xfd, 0x00, 0x01, 0xff, 0x80, 0xea,
+	0x00, 0x01, 0x01, 0xff, 0xfe, 0x00, 0x01, 0x01, 0xff, 0xe8, 0x00, 0x05,
+	0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0xe8, 0x00, 0x05, 0xff, 0x80, 0x00,
+	0x00, 0x01, 0xff, 0xe8, 0x00, 0x05, 0xff, 0x80, 0x00, 0x00, 0x03, 0xfe,
+	0xe8, 0x00, 0x05, 0x7f, 0xc0, 0x00, 0x00, 0x03, 0xfe, 0xe8, 0x00, 0x05,
+	0x7f, 0xc0, 0x00, 0x00, 0x03, 0xfc, 0xe8, 0x00, 0x05, 0x3f, 0xc0, 0x00,
+	0x00, 0x07, 0xfc, 0xe8, 0x00, 0x05, 0x3f, 0xe0, 0x00, 0x00, 0x07, 0xfc,
+	0xfc, 0x00, 0x01, 0x03, 0xf8, 0xf6, 0x00, 0x01, 0x1f, 0xc0, 0xfc, 0x00,
+	0x05, 0x3f, 0xe0, 0x00, 0x00, 0x07, 0xf8, 0xfc, 0x00, 0x01, 0x1f, 0xff,
+	0xf6, 0x00, 0x01, 0xff, 0xf8, 0xfc, 0x00, 0x05, 0x1f, 0xe0, 0x00, 0x00,
+	0x0f, 0xf8, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xc0, 0xf8, 0x00, 0x02, 0x03,
+	0xff, 0xfe, 0xfc, 0x00, 0x05, 0x1f, 0xf0, 0x00, 0x00, 0x0f, 0xf8, 0xfc,
+	0x00, 0x02, 0xff, 0xff, 0xe0, 0xf8, 0x00, 0x02, 0x07, 0xff, 0xff, 0xfc,
+	0x00, 0x05, 0x1f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0xfd, 0x00, 0x03, 0x01,
+	0xff, 0xff, 0xf0, 0xf8, 0x00, 0x03, 0x0f, 0xff, 0xff, 0x80, 0xfd, 0x00,
+	0x05, 0x0f, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0xfd, 0x00, 0x03, 0x03, 0xff,
+	0xff, 0xfc, 0xf8, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xc0, 0xfd, 0x00, 0x05,
+	0x0f, 0xf8, 0x00, 0x00, 0x1f, 0xe0, 0xfd, 0x00, 0x03, 0x07, 0xff, 0xff,
+	0xfc, 0xf8, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xe0, 0xfd, 0x00, 0x05, 0x07,
+	0xf8, 0x00, 0x00, 0x1f, 0xe0, 0xfd, 0x00, 0x03, 0x0f, 0xff, 0xff, 0xfe,
+	0xf8, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xf0, 0xfd, 0x00, 0x05, 0x07, 0xf8,
+	0x00, 0x00, 0x3f, 0xe0, 0xfd, 0x00, 0x03, 0x0f, 0xff, 0xff, 0xfe, 0xf8,
+	0x00, 0xfe, 0xff, 0x00, 0xf8, 0xfd, 0x00, 0x05, 0x07, 0xfc, 0x00, 0x00,
+	0x3f, 0xe0, 0xfd, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+	0x00, 0xf8, 0xfd, 0x00, 0x05, 0x07, 0xfc, 0x00, 0x00, 0x3f, 0xc0, 0xfd,
+	0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0x00, 0xf8, 0xfd,
+	0x00, 0x05, 0x03, 0xfc, 0x00, 0x00, 0x3f, 0xc0, 0xfd, 0x00, 0x00, 0x3f,
+	0xfe, 0xff, 0x00, 0x80, 0xfa, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x00, 0xfc,
+	0xfd, 0x00, 0x05, 0x03, 0xfc, 0x00, 0x00, 0x7f, 0xc0, 0xfd, 0x00, 0x00,
+	0x3f, 0xfe, 0xff, 0x00, 0x80, 0xfa, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x00,
+	0xfc, 0xfd, 0x00, 0x05, 0x03, 0xfe, 0x00, 0x00, 0x7f, 0xc0, 0xfd, 0x00,
+	0x00, 0x3f, 0xfe, 0xff, 0x00, 0x80, 0xfa, 0x00, 0x00, 0x01, 0xfe, 0xff,
+	0x00, 0xfc, 0xfd, 0x00, 0x05, 0x03, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0xfd,
+	0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0x80, 0xfa, 0x00, 0x00, 0x01, 0xfe,
+	0xff, 0x00, 0xfc, 0xfd, 0x00, 0x05, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80,
+	0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0x80, 0xfa, 0x00, 0x00, 0x01,
+	0xfe, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x05, 0x01, 0xfe, 0x00, 0x00, 0xff,
+	0x80, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0x80, 0xfa, 0x00, 0x00,
+	0x01, 0xfe, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x05, 0x01, 0xff, 0x00, 0x00,
+	0xff, 0x80, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0x80, 0xfa, 0x00,
+	0x00, 0x01, 0xfe, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x05, 0x01, 0xff, 0x00,
+	0x00, 0xff, 0x80, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0x80, 0xfa,
+	0x00, 0x00, 0x01, 0xfe, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x03, 0xff, 0x00,
+	0x00, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0x80, 0xfa, 0x00,
+	0x00, 0x01, 0xfe, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x03, 0xff, 0x00, 0x00,
+	0xff, 0xfc, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0x80, 0xfa, 0x00, 0x00,
+	0x01, 0xfe, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff,
+	0xfc, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0x00, 0xfc,
+	0xfc, 0x00, 0x03, 0xff, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xfe,
+	0xff, 0xf8, 0x00, 0xfe, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0x03, 0xff, 0x80,
+	0x01, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+	0x00, 0xf8, 0xfc, 0x00, 0x03, 0xff, 0x80, 0x01, 0xff, 0xfc, 0x00, 0x03,
+	0x0f, 0xff, 0xff, 0xfe, 0xf8, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xf0, 0xfc,
+	0x00, 0x03, 0xff, 0x80, 0x01, 0xfe, 0xfc, 0x00, 0x03, 0x07, 0xff, 0xff,
+	0xfe, 0xf8, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xe0, 0xfc, 0x00, 0x03, 0x7f,
+	0x80, 0x01, 0xfe, 0xfc, 0x00, 0x03, 0x03, 0xff, 0xff, 0xf8, 0xf8, 0x00,
+	0x03, 0x1f, 0xff, 0xff, 0xc0, 0xfc, 0x00, 0x03, 0x7f, 0x80, 0x01, 0xfe,
+	0xfc, 0x00, 0x03, 0x01, 0xff, 0xff, 0xf0, 0xf8, 0x00, 0x03, 0x0f, 0xff,
+	0xff, 0x80, 0xfc, 0x00, 0x03, 0x7f, 0x80, 0x03, 0xfe, 0xfb, 0x00, 0x02,
+	0x7f, 0xff, 0xc0, 0xf8, 0x00, 0x02, 0x03, 0xff, 0xfe, 0xfb, 0x00, 0x03,
+	0x7f, 0xc0, 0x03, 0xfe, 0xfb, 0x00, 0x01, 0x0f, 0xff, 0xf6, 0x00, 0x01,
+	0xff, 0xf8, 0xfb, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xfa, 0x00, 0x00,
+	0xf0, 0xf6, 0x00, 0x00, 0x07, 0xfa, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe,
+	0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0,
+	0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03,
+	0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6,
+	0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03,
+	0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f,
+	0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00,
+	0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe,
+	0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0,
+	0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03,
+	0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6,
+	0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03,
+	0xfe, 0xe6, 0x00, 0x03, 0x7f, 0xc0, 0x03, 0xfe, 0xe6, 0x00, 0x03, 0x7f,
+	0x80, 0x01, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0x80, 0x01, 0xfe, 0xe6, 0x00,
+	0x03, 0x7f, 0x80, 0x01, 0xfe, 0xe6, 0x00, 0x03, 0x7f, 0x80, 0x01, 0xff,
+	0xe6, 0x00, 0x03, 0xff, 0x80, 0x01, 0xff, 0xe6, 0x00, 0x03, 0xff, 0x80,
+	0x01, 0xff, 0xe6, 0x00, 0x03, 0xff, 0x80, 0x00, 0xff, 0xe6, 0x00, 0x03,
+	0xff, 0x00, 0x00, 0xff, 0xe6, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xe6,
+	0x00, 0x04, 0xff, 0x00, 0x00, 0xff, 0x80, 0xe8, 0x00, 0x05, 0x01, 0xff,
+	0x00, 0x00, 0xff, 0x80, 0xe8, 0x00, 0x05, 0x01, 0xff, 0x00, 0x00, 0x7f,
+	0x80, 0xe8, 0x00, 0x05, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0xe8, 0x00,
+	0x05, 0x01, 0xfe, 0x00, 0x00, 0x7f, 0x80, 0xe8, 0x00, 0x05, 0x01, 0xfe,
+	0x00, 0x00, 0x7f, 0xc0, 0xfb, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x01,
+	0x3f, 0xf8, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfc, 0x00, 0x05, 0x03, 0xfe,
+	0x00, 0x00, 0x3f, 0xc0, 0xfb, 0x00, 0x02, 0x3f, 0xff, 0xc0, 0xfe, 0x00,
+	0x01, 0xff, 0xff, 0xfe, 0x00, 0x02, 0x07, 0xff, 0xfc, 0xfc, 0x00, 0x05,
+	0x03, 0xfc, 0x00, 0x00, 0x3f, 0xe0, 0xfb, 0x00, 0x0d, 0x7f, 0xff, 0xf0,
+	0x00, 0x00, 0x03, 0xff, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0xfc,
+	0x00, 0x05, 0x07, 0xfc, 0x00, 0x00, 0x3f, 0xe0, 0xfc, 0x00, 0x0f, 0x01,
+	0xff, 0xff, 0xf8, 0x00, 0x00, 0x07, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f,
+	0xff, 0xff, 0x80, 0xfd, 0x00, 0x05, 0x07, 0xfc, 0x00, 0x00, 0x3f, 0xe0,
+	0xfc, 0x00, 0x0f, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff,
+	0xe0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x80, 0xfd, 0x00, 0x05, 0x07, 0xfc,
+	0x00, 0x00, 0x1f, 0xe0, 0xfc, 0x00, 0x0f, 0x07, 0xff, 0xff, 0xfe, 0x00,
+	0x00, 0x1f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xc0, 0xfd,
+	0x00, 0x05, 0x07, 0xf8, 0x00, 0x00, 0x1f, 0xf0, 0xfc, 0x00, 0x00, 0x0f,
+	0xfe, 0xff, 0x07, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xfe,
+	0xff, 0x00, 0xe0, 0xfd, 0x00, 0x05, 0x0f, 0xf8, 0x00, 0x00, 0x1f, 0xf0,
+	0xfc, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x07, 0x80, 0x00, 0x7f, 0xff, 0xff,
+	0xfe, 0x00, 0x01, 0xfe, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x05, 0x0f, 0xf8,
+	0x00, 0x00, 0x1f, 0xf0, 0xfc, 0x00, 0x0f, 0x3f, 0xff, 0x9f, 0xff, 0xc0,
+	0x00, 0xff, 0xfc, 0x7f, 0xfe, 0x00, 0x03, 0xff, 0xf3, 0xff, 0xf8, 0xfd,
+	0x00, 0x05, 0x0f, 0xf8, 0x00, 0x00, 0x0f, 0xf8, 0xfc, 0x00, 0x0f, 0x3f,
+	0xfc, 0x03, 0xff, 0xe0, 0x01, 0xff, 0xe0, 0x0f, 0xff, 0x80, 0x0f, 0xff,
+	0x80, 0x3f, 0xfc, 0xfd, 0x00, 0x05, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf8,
+	0xfd, 0x00, 0x10, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x07, 0xff, 0xc0,
+	0x07, 0xff, 0xe0, 0x3f, 0xff, 0x00, 0x1f, 0xff, 0xfd, 0x00, 0x05, 0x1f,
+	0xf0, 0x00, 0x00, 0x07, 0xf8, 0xfd, 0x00, 0x04, 0x3f, 0xff, 0xf0, 0x00,
+	0x7f, 0xfe, 0xff, 0x01, 0x80, 0x01, 0xfe, 0xff, 0x04, 0xfe, 0x00, 0x0f,
+	0xff, 0xf8, 0xfe, 0x00, 0x05, 0x1f, 0xe0, 0x00, 0x00, 0x07, 0xf8, 0xfd,
+	0x00, 0x04, 0x7f, 0xff, 0xe0, 0x00, 0x3f, 0xfe, 0xff, 0x01, 0x00, 0x00,
+	0xfe, 0xff, 0x04, 0xfc, 0x00, 0x07, 0xff, 0xfc, 0xfe, 0x00, 0x05, 0x1f,
+	0xe0, 0x00, 0x00, 0x07, 0xfc, 0xfd, 0x00, 0x11, 0xff, 0xff, 0xc0, 0x00,
+	0x1f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0x03,
+	0xff, 0xfe, 0xfe, 0x00, 0x05, 0x3f, 0xe0, 0x00, 0x00, 0x03, 0xfe, 0xfe,
+	0x00, 0x12, 0x01, 0xff, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0x00,
+	0x00, 0x3f, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x05,
+	0x7f, 0xc0, 0x00, 0x00, 0x03, 0xfc, 0xfe, 0x00, 0x12, 0x01, 0xff, 0xfe,
+	0x00, 0x00, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xc0,
+	0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x05, 0x3f, 0xc0, 0x00, 0x00, 0x03,
+	0xfe, 0xfe, 0x00, 0x12, 0x01, 0xff, 0xfe, 0x00, 0x00, 0x03, 0xff, 0xff,
+	0xf0, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xfe,
+	0x00, 0x05, 0x7f, 0xc0, 0x00, 0x00, 0x01, 0xfe, 0xfe, 0x00, 0x0d, 0x01,
+	0xff, 0xf8, 0x00, 0x00, 0x01, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff,
+	0xff, 0xfe, 0x00, 0x01, 0x3f, 0xff, 0xfe, 0x00, 0x05, 0x7f, 0x80, 0x00,
+	0x00, 0x01, 0xff, 0xfe, 0x00, 0x02, 0x01, 0xff, 0xe0, 0xfe, 0x00, 0x07,
+	0x7f, 0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0xfe, 0xfe, 0x00, 0x01, 0x1f,
+	0xff, 0xfe, 0x00, 0x05, 0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0xfd, 0x00,
+	0x00, 0x7f, 0xfd, 0x00, 0x01, 0x0f, 0xf8, 0xfd, 0x00, 0x01, 0x3f, 0xe0,
+	0xfe, 0x00, 0x01, 0x01, 0xfc, 0xfe, 0x00, 0x01, 0xff, 0x80, 0xfe, 0x00,
+	0x01, 0xff, 0x80, 0xea, 0x00, 0x01, 0x01, 0xff, 0xfd, 0x00, 0x01, 0xff,
+	0x80, 0xea, 0x00, 0x01, 0x01, 0xff, 0xfd, 0x00, 0x01, 0x7f, 0xc0, 0xea,
+	0x00, 0x01, 0x03, 0xfe, 0xfd, 0x00, 0x01, 0x7f, 0xe0, 0xea, 0x00, 0x01,
+	0x07, 0xfe, 0xfd, 0x00, 0x01, 0x3f, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xfc,
+	0xfd, 0x00, 0x01, 0x1f, 0xf0, 0xea, 0x00, 0x01, 0x0f, 0xfc, 0xfd, 0x00,
+	0x01, 0x1f, 0xf0, 0xea, 0x00, 0x01, 0x0f, 0xf8, 0xfd, 0x00, 0x01, 0x0f,
+	0xf8, 0xea, 0x00, 0x01, 0x1f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xfc, 0xea,
+	0x00, 0x01, 0x3f, 0xf0, 0xfd, 0x00, 0x01, 0x07, 0xfc, 0xea, 0x00, 0x01,
+	0x3f, 0xe0, 0xfd, 0x00, 0x01, 0x07, 0xfe, 0xea, 0x00, 0x01, 0x7f, 0xe0,
+	0xfd, 0x00, 0x01, 0x03, 0xfe, 0xea, 0x00, 0x01, 0x7f, 0xc0, 0xfd, 0x00,
+	0x01, 0x03, 0xff, 0xea, 0x00, 0x01, 0xff, 0xc0, 0xfd, 0x00, 0x02, 0x01,
+	0xff, 0x80, 0xec, 0x00, 0x02, 0x01, 0xff, 0x80, 0xfd, 0x00, 0x02, 0x01,
+	0xff, 0x80, 0xec, 0x00, 0x02, 0x01, 0xff, 0x80, 0xfc, 0x00, 0x01, 0xff,
+	0xc0, 0xec, 0x00, 0x01, 0x03, 0xff, 0xfb, 0x00, 0x01, 0x7f, 0xe0, 0xec,
+	0x00, 0x01, 0x07, 0xfe, 0xfb, 0x00, 0x01, 0x7f, 0xe0, 0xec, 0x00, 0x01,
+	0x07, 0xfe, 0xfb, 0x00, 0x01, 0x3f, 0xf0, 0xec, 0x00, 0x01, 0x0f, 0xfc,
+	0xfb, 0x00, 0x01, 0x3f, 0xf8, 0xec, 0x00, 0x01, 0x1f, 0xfc, 0xfb, 0x00,
+	0x01, 0x1f, 0xfc, 0xec, 0x00, 0x01, 0x3f, 0xf8, 0xfb, 0x00, 0x01, 0x0f,
+	0xfc, 0xec, 0x00, 0x01, 0x3f, 0xf0, 0xfb, 0x00, 0x01, 0x07, 0xfe, 0xec,
+	0x00, 0x01, 0x7f, 0xe0, 0xfb, 0x00, 0x01, 0x07, 0xff, 0xec, 0x00, 0x01,
+	0xff, 0xe0, 0xfb, 0x00, 0x02, 0x03, 0xff, 0x80, 0xee, 0x00, 0x02, 0x01,
+	0xff, 0xc0, 0xfb, 0x00, 0x02, 0x01, 0xff, 0xc0, 0xee, 0x00, 0x02, 0x03,
+	0xff, 0x80, 0xfb, 0x00, 0x02, 0x01, 0xff, 0xc0, 0xee, 0x00, 0x02, 0x03,
+	0xff, 0x80, 0xfa, 0x00, 0x01, 0xff, 0xe0, 0xee, 0x00, 0x01, 0x07, 0xff,
+	0xf9, 0x00, 0x01, 0x7f, 0xf8, 0xee, 0x00, 0x01, 0x1f, 0xfe, 0xf9, 0x00,
+	0x01, 0x3f, 0xf8, 0xee, 0x00, 0x01, 0x1f, 0xfc, 0xf9, 0x00, 0x01, 0x1f,
+	0xfc, 0xee, 0x00, 0x01, 0x3f, 0xf8, 0xf9, 0x00, 0x01, 0x0f, 0xfe, 0xee,
+	0x00, 0x01, 0x7f, 0xf0, 0xf9, 0x00, 0x01, 0x07, 0xff, 0xee, 0x00, 0x01,
+	0xff, 0xf0, 0xf9, 0x00, 0x02, 0x03, 0xff, 0x80, 0xf0, 0x00, 0x02, 0x01,
+	0xff, 0xc0, 0xf9, 0x00, 0x02, 0x01, 0xff, 0xc0, 0xf0, 0x00, 0x02, 0x03,
+	0xff, 0x80, 0xf9, 0x00, 0x02, 0x01, 0xff, 0xe0, 0xf0, 0x00, 0x02, 0x07,
+	0xff, 0x80, 0xf8, 0x00, 0x01, 0xff, 0xf0, 0xf0, 0x00, 0x01, 0x0f, 0xff,
+	0xf7, 0x00, 0x01, 0x7f, 0xf8, 0xf0, 0x00, 0x01, 0x1f, 0xfe, 0xf7, 0x00,
+	0x01, 0x3f, 0xfe, 0xf0, 0x00, 0x01, 0x7f, 0xfc, 0xf7, 0x00, 0x01, 0x0f,
+	0xff, 0xf0, 0x00, 0x01, 0xff, 0xf8, 0xf7, 0x00, 0x02, 0x0f, 0xff, 0x80,
+	0xf2, 0x00, 0x02, 0x01, 0xff, 0xf0, 0xf7, 0x00, 0x02, 0x03, 0xff, 0xf0,
+	0xf2, 0x00, 0x02, 0x0f, 0xff, 0xc0, 0xf7, 0x00, 0x02, 0x01, 0xff, 0xf8,
+	0xf2, 0x00, 0x02, 0x1f, 0xff, 0x80, 0xf7, 0x00, 0x02, 0x01, 0xff, 0xf8,
+	0xf2, 0x00, 0x02, 0x1f, 0xff, 0x80, 0xf6, 0x00, 0x01, 0x7f, 0xfe, 0xf2,
+	0x00, 0x01, 0x7f, 0xfe, 0xf5, 0x00, 0x01, 0x3f, 0xff, 0xf2, 0x00, 0x01,
+	0xff, 0xfc, 0xf5, 0x00, 0x02, 0x1f, 0xff, 0xc0, 0xf4, 0x00, 0x02, 0x03,
+	0xff, 0xf8, 0xf5, 0x00, 0x02, 0x0f, 0xff, 0xe0, 0xf4, 0x00, 0x02, 0x07,
+	0xff, 0xf0, 0xf5, 0x00, 0x02, 0x03, 0xff, 0xf8, 0xf4, 0x00, 0x02, 0x1f,
+	0xff, 0xc0, 0xf5, 0x00, 0x02, 0x01, 0xff, 0xfe, 0xf4, 0x00, 0x02, 0x7f,
+	0xff, 0x80, 0xf4, 0x00, 0x02, 0x7f, 0xff, 0x80, 0xf6, 0x00, 0x02, 0x01,
+	0xff, 0xfe, 0xf3, 0x00, 0x02, 0x3f, 0xff, 0xe0, 0xf6, 0x00, 0x02, 0x07,
+	0xff, 0xfc, 0xf3, 0x00, 0x02, 0x0f, 0xff, 0xf8, 0xf6, 0x00, 0x02, 0x1f,
+	0xff, 0xf0, 0xf3, 0x00, 0x02, 0x07, 0xff, 0xfe, 0xf6, 0x00, 0x02, 0x7f,
+	0xff, 0xe0, 0xf3, 0x00, 0x03, 0x01, 0xff, 0xff, 0x80, 0xf8, 0x00, 0x03,
+	0x01, 0xff, 0xff, 0x80, 0xf2, 0x00, 0x02, 0xff, 0xff, 0xf0, 0xf8, 0x00,
+	0x02, 0x0f, 0xff, 0xff, 0xf1, 0x00, 0x02, 0x3f, 0xff, 0xfc, 0xf8, 0x00,
+	0x02, 0x3f, 0xff, 0xfc, 0xf1, 0x00, 0x02, 0x2f, 0xff, 0xfe, 0xf8, 0x00,
+	0x02, 0xff, 0xff, 0xf4, 0xf1, 0x00, 0x03, 0x0f, 0xff, 0xff, 0x80, 0xfa,
+	0x00, 0x03, 0x01, 0xff, 0xff, 0xf0, 0xf1, 0x00, 0x03, 0x03, 0xff, 0xff,
+	0xf0, 0xfa, 0x00, 0x03, 0x0f, 0xff, 0xff, 0xc0, 0xf0, 0x00, 0x02, 0xff,
+	0xff, 0xfe, 0xfa, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xef, 0x00, 0x03, 0x3f,
+	0xff, 0xff, 0xe0, 0xfc, 0x00, 0x03, 0x07, 0xff, 0xff, 0xfc, 0xef, 0x00,
+	0x03, 0x0f, 0xff, 0xff, 0xfe, 0xfc, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xf0,
+	0xef, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x00, 0x1f,
+	0xfe, 0xff, 0x00, 0xc0, 0xee, 0x00, 0x00, 0x7f, 0xf8, 0xff, 0x00, 0xfe,
+	0xed, 0x00, 0x00, 0x1f, 0xf8, 0xff, 0x00, 0xf8, 0xed, 0x00, 0x00, 0x03,
+	0xf8, 0xff, 0x00, 0xc0, 0xec, 0x00, 0x00, 0x7f, 0xfa, 0xff, 0x00, 0xfe,
+	0xeb, 0x00, 0x00, 0x07, 0xfa, 0xff, 0x00, 0xe0, 0xea, 0x00, 0xfa, 0xff,
+	0xe9, 0x00, 0x00, 0x0f, 0xfc, 0xff, 0x00, 0xf0, 0xe8, 0x00, 0x00, 0x3f,
+	0xfe, 0xff, 0x00, 0xfc, 0xe6, 0x00, 0x02, 0x7f, 0xff, 0xfe, 0x81, 0x00,
+	0xb9, 0x00};
+uint16_t worried_air_width = 248;
+uint16_t worried_air_height = 248;
+uint16_t worried_air_len = 3110;
+
+// 184x56, 1288 bytes uncompressed
+const uint8_t rak_img[] = {
+	0xfd, 0x00, 0x00, 0xf8, 0xec, 0x00, 0x01, 0x0f, 0xff, 0xec, 0x00, 0x02,
+	0x7f, 0xff, 0x80, 0xee, 0x00, 0x03, 0x01, 0xff, 0xff, 0x80, 0xee, 0x00,
+	0x03, 0x07, 0xff, 0xff, 0x80, 0xee, 0x00, 0x03, 0x1f, 0xff, 0xff, 0x80,
+	0xee, 0x00, 0x02, 0x3f, 0xff, 0xff, 0xed, 0x00, 0x02, 0x7f, 0xff, 0xc2,
+	0xed, 0x00, 0x01, 0xff, 0xf8, 0xec, 0x00, 0x02, 0xff, 0xe3, 0xff, 0xfe,
+	0x00, 0x00, 0x01, 0xfe, 0xff, 0x13, 0x80, 0x00, 0x00, 0x7f, 0xc0, 0x00,
+	0x1f, 0xe0, 0x00, 0x3f, 0xfc, 0x00, 0x01, 0xff, 0x8f, 0xff, 0x80, 0x00,
+	0x00, 0x03, 0xfe, 0xff, 0x13, 0xc0, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x3f,
+	0xf0, 0x00, 0x3f, 0xf8, 0x00, 0x03, 0xff, 0x3f, 0xff, 0x80, 0x00, 0x00,
+	0x03, 0xfe, 0xff, 0x13, 0xf0, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x1f, 0xf0,
+	0x00, 0x7f, 0xf0, 0x00, 0x03, 0xfc, 0x7f, 0xff, 0x90, 0x00, 0x00, 0x03,
+	0xfe, 0xff, 0x13, 0xf8, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x1f, 0xf0, 0x00,
+	0xff, 0xe0, 0x00, 0x07, 0xf9, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x03, 0xfe,
+	0xff, 0x13, 0xfc, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x1f, 0xf0, 0x03, 0xff,
+	0xc0, 0x00, 0x07, 0xf3, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x03, 0xfe, 0xff,
+	0x13, 0xfe, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x1f, 0xf0, 0x07, 0xff, 0x80,
+	0x00, 0x01, 0xe1, 0xfe, 0x07, 0x3f, 0xc0, 0x00, 0x03, 0xfe, 0xff, 0x66,
+	0xfe, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x1f, 0xf0, 0x0f, 0xff, 0x00, 0x00,
+	0x1c, 0x44, 0x40, 0xf0, 0x7f, 0xe0, 0x00, 0x03, 0xfe, 0x00, 0x0f, 0xff,
+	0x00, 0x07, 0xff, 0xf8, 0x00, 0x1f, 0xf0, 0x1f, 0xfe, 0x00, 0x3c, 0x7f,
+	0x1f, 0x1f, 0xff, 0x3f, 0xf0, 0x00, 0x03, 0xfe, 0x00, 0x03, 0xff, 0x00,
+	0x07, 0xff, 0xf8, 0x00, 0x1f, 0xf0, 0x3f, 0xfc, 0x00, 0x7f, 0x7f, 0xbf,
+	0xbf, 0xff, 0x9f, 0xf8, 0x00, 0x03, 0xfe, 0x00, 0x03, 0xff, 0x00, 0x07,
+	0xff, 0xfc, 0x00, 0x1f, 0xf0, 0x7f, 0xf8, 0x00, 0x7f, 0x3f, 0x7f, 0xdf,
+	0xff, 0x8f, 0xfc, 0x00, 0x03, 0xfe, 0x00, 0x01, 0xff, 0x00, 0x0f, 0xfb,
+	0xfc, 0x00, 0x1f, 0xf0, 0xff, 0xf0, 0x00, 0xfe, 0x7f, 0x7f, 0xdf, 0xff,
+	0x87, 0xfc, 0x00, 0x03, 0xfe, 0x00, 0x01, 0xff, 0x00, 0x0f, 0xfb, 0xfe,
+	0x00, 0x1f, 0xf1, 0xff, 0xc0, 0x00, 0xfe, 0x7f, 0x7f, 0xdf, 0xff, 0x93,
+	0xfe, 0x00, 0x03, 0xfe, 0x00, 0x01, 0xff, 0x00, 0x0f, 0xf3, 0xfe, 0x00,
+	0x1f, 0xf3, 0xff, 0x80, 0x00, 0xfe, 0x7f, 0x7f, 0xdf, 0xff, 0xb9, 0xff,
+	0x00, 0x03, 0xfe, 0x00, 0x01, 0xff, 0x00, 0x1f, 0xf1, 0xfe, 0x00, 0x1f,
+	0xe7, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0xdf, 0xfe, 0x3c, 0xff, 0x00,
+	0x03, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x1f, 0xe1, 0xff, 0x00, 0x1f, 0xef,
+	0xfe, 0x00, 0x00, 0xff, 0x7f, 0x7f, 0xc0, 0x00, 0x7c, 0xff, 0x80, 0x03,
+	0xfe, 0x00, 0x03, 0xfe, 0x00, 0x1f, 0xe1, 0xff, 0x80, 0x1f, 0xff, 0xfe,
+	0x00, 0x00, 0xff, 0x7f, 0x7f, 0xc0, 0x01, 0xbe, 0xff, 0x80, 0x03, 0xfe,
+	0x00, 0x0f, 0xfc, 0x00, 0x3f, 0xe1, 0x0f, 0xff, 0x00, 0x1f, 0xff, 0xff,
+	0x00, 0x00, 0xff, 0x7f, 0x7f, 0xc0, 0x7f, 0xbf, 0x7f, 0xc0, 0x03, 0xfe,
+	0xff, 0x13, 0xfc, 0x00, 0x7f, 0xc0, 0xff, 0x80, 0x1f, 0xff, 0xff, 0x80,
+	0x00, 0x7f, 0xbf, 0x7f, 0xc0, 0x7f, 0xbf, 0x3f, 0xc0, 0x03, 0xfe, 0xff,
+	0x13, 0xf8, 0x00, 0x7f, 0xc0, 0xff, 0x80, 0x1f, 0xff, 0xff, 0x80, 0x00,
+	0x7f, 0xbf, 0x3f, 0xc0, 0x7f, 0x9f, 0x3f, 0xc0, 0x03, 0xfe, 0xff, 0x13,
+	0xe0, 0x00, 0x7f, 0x80, 0x7f, 0xc0, 0x1f, 0xff, 0xff, 0xc0, 0x00, 0x3f,
+	0x9f, 0xbf, 0xc0, 0x7f, 0x9f, 0xbf, 0xc0, 0x03, 0xfe, 0xff, 0x13, 0xc0,
+	0x00, 0xff, 0x80, 0x7f, 0xc0, 0x1f, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xcf,
+	0xb0, 0x00, 0x7f, 0x9f, 0x9f, 0xe0, 0x03, 0xfe, 0xff, 0x13, 0xf8, 0x00,
+	0x7f, 0x80, 0x3f, 0xe0, 0x1f, 0xff, 0x7f, 0xe0, 0x00, 0x3f, 0xcf, 0xc0,
+	0x00, 0x7f, 0x9f, 0x9f, 0xe0, 0x03, 0xfe, 0xff, 0x2f, 0xfc, 0x00, 0xff,
+	0x00, 0x3f, 0xe0, 0x1f, 0xfe, 0x3f, 0xf0, 0x00, 0x1f, 0xe7, 0x9f, 0xff,
+	0x7f, 0x9f, 0x9f, 0xe0, 0x03, 0xfe, 0x00, 0x3f, 0xfc, 0x01, 0xff, 0x40,
+	0x3f, 0xe0, 0x1f, 0xfc, 0x3f, 0xf8, 0x00, 0x1f, 0xf3, 0x3f, 0xff, 0x7f,
+	0x9f, 0x9f, 0xe0, 0x03, 0xfe, 0x00, 0x0f, 0xfc, 0x01, 0xfe, 0xff, 0x13,
+	0xf0, 0x1f, 0xf8, 0x1f, 0xf8, 0x00, 0x0f, 0xfb, 0x7f, 0xff, 0x7f, 0x9f,
+	0x9f, 0xe0, 0x03, 0xfe, 0x00, 0x03, 0xfe, 0x01, 0xfe, 0xff, 0x13, 0xf0,
+	0x1f, 0xf0, 0x1f, 0xfe, 0x00, 0x0f, 0xfc, 0x7f, 0xff, 0x7f, 0x9f, 0x9f,
+	0xc0, 0x03, 0xfe, 0x00, 0x03, 0xfe, 0x03, 0xfe, 0xff, 0x13, 0xf0, 0x1f,
+	0xe0, 0x0f, 0xfe, 0x00, 0x07, 0xfe, 0x7f, 0xff, 0x3f, 0xbf, 0x9f, 0xc0,
+	0x03, 0xfe, 0x00, 0x01, 0xfe, 0x03, 0xfe, 0xff, 0x13, 0xf8, 0x1f, 0xf0,
+	0x07, 0xff, 0x00, 0x03, 0xff, 0x7f, 0xff, 0xbf, 0xbf, 0x9f, 0xc0, 0x03,
+	0xfe, 0x00, 0x01, 0xfe, 0x07, 0xfe, 0xff, 0x13, 0xf8, 0x1f, 0xf0, 0x03,
+	0xff, 0x80, 0x01, 0xff, 0x1f, 0xff, 0x1f, 0x9f, 0x87, 0x00, 0x03, 0xfe,
+	0x00, 0x01, 0xfe, 0x07, 0xfe, 0xff, 0x7f, 0xf8, 0x1f, 0xf0, 0x03, 0xff,
+	0xc0, 0x00, 0xff, 0xc3, 0xe0, 0x46, 0x47, 0x00, 0x00, 0x03, 0xfe, 0x00,
+	0x01, 0xff, 0x0f, 0xf8, 0x00, 0x07, 0xfc, 0x1f, 0xf0, 0x01, 0xff, 0xc0,
+	0x00, 0x7f, 0x38, 0x0f, 0xf0, 0xf0, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x01,
+	0xff, 0x07, 0xf8, 0x00, 0x07, 0xfe, 0x1f, 0xf0, 0x00, 0xff, 0xe0, 0x00,
+	0x1f, 0x7f, 0xff, 0xf9, 0xfc, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x01, 0xff,
+	0x0f, 0xf8, 0x00, 0x03, 0xfe, 0x1f, 0xf0, 0x00, 0x7f, 0xe0, 0x00, 0x07,
+	0x7f, 0xff, 0xf3, 0xf8, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x01, 0xff, 0x1f,
+	0xf8, 0x00, 0x03, 0xfe, 0x1f, 0xf0, 0x00, 0x7f, 0xf0, 0x00, 0x01, 0x7f,
+	0xff, 0xe7, 0xf8, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x01, 0xff, 0x1f, 0xf0,
+	0x00, 0x01, 0xff, 0x1f, 0xf0, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x7f, 0xff,
+	0x9f, 0xf0, 0x00, 0x3d, 0x00, 0x03, 0xfe, 0x00, 0x00, 0xff, 0x1f, 0xf0,
+	0x00, 0x01, 0xff, 0x1f, 0xf0, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x7f, 0xfe,
+	0x3f, 0xf0, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0xff, 0x3f, 0xe0, 0x00,
+	0x01, 0xff, 0x1f, 0xe0, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x3f, 0xf8, 0xff,
+	0xe0, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xbf, 0xe0, 0x00, 0x00,
+	0xff, 0xbf, 0xf0, 0x00, 0x0f, 0xfe, 0xfe, 0x00, 0x06, 0x07, 0xff, 0xc0,
+	0x00, 0x00, 0x01, 0x68, 0xfe, 0x00, 0x00, 0x20, 0xf5, 0x00, 0x02, 0x3f,
+	0xff, 0xc0, 0xee, 0x00, 0x03, 0x1f, 0xff, 0xff, 0x80, 0xee, 0x00, 0x02,
+	0x3f, 0xff, 0xfe, 0xed, 0x00, 0x02, 0x7f, 0xff, 0xfc, 0xed, 0x00, 0x02,
+	0x7f, 0xff, 0xf0, 0xed, 0x00, 0x02, 0x3f, 0xff, 0xc0, 0xed, 0x00, 0x01,
+	0x1f, 0xfe, 0xec, 0x00, 0x01, 0x07, 0xf0, 0xee, 0x00};
+uint16_t rak_img_width = 184;
+uint16_t rak_img_height = 56;
+uint16_t rak_img_length = 993;
+
+// 126x66, 1056 bytes uncompressed
+const uint8_t built_img[] = {
+	0xcf, 0x00, 0x04, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xfe, 0xff, 0x07, 0x00,
+	0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x01, 0x00, 0x07,
+	0xfe, 0xff, 0x07, 0x80, 0x07, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x03, 0xfe,
+	0xff, 0x01, 0x80, 0x0f, 0xfe, 0xff, 0x07, 0xc0, 0x0f, 0xff, 0xff, 0xfc,
+	0x00, 0x00, 0x03, 0xfe, 0xff, 0x01, 0x80, 0x0f, 0xfe, 0xff, 0x07, 0xc0,
+	0x0f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x01, 0x80, 0x0f,
+	0xfe, 0xff, 0x07, 0xc0, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xfe,
+	0xff, 0x01, 0x80, 0x0f, 0xfe, 0xff, 0x07, 0xc0, 0x0f, 0xff, 0xff, 0xfc,
+	0x00, 0x00, 0x03, 0xfe, 0xff, 0x01, 0x80, 0x0f, 0xfe, 0xff, 0x07, 0xc0,
+	0x0f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x01, 0x80, 0x0f,
+	0xfe, 0xff, 0x07, 0xc0, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xfe,
+	0xff, 0x01, 0x80, 0x0f, 0xfe, 0xff, 0x07, 0xc0, 0x0f, 0xff, 0xff, 0xfc,
+	0x00, 0x00, 0x07, 0xfe, 0xff, 0x01, 0xc0, 0x1f, 0xfe, 0xff, 0x06, 0xc0,
+	0x0f, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xf8, 0xff, 0x06, 0xe0, 0x1f, 0xff,
+	0xff, 0xfc, 0x00, 0x3f, 0xf4, 0xff, 0x02, 0xfe, 0x00, 0x3f, 0xf3, 0xff,
+	0x01, 0xf0, 0x7f, 0xf3, 0xff, 0x01, 0xfc, 0x7f, 0xf3, 0xff, 0x01, 0xfc,
+	0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3,
+	0xff, 0x01, 0xfe, 0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3, 0xff, 0x01,
+	0xfe, 0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f,
+	0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3, 0xff,
+	0x0b, 0xfe, 0x7f, 0xff, 0xc1, 0xff, 0xed, 0xff, 0xff, 0xfb, 0xfb, 0xfe,
+	0x0f, 0xfd, 0xff, 0x7f, 0xfe, 0x7f, 0xff, 0xc0, 0x7f, 0xec, 0xdf, 0xff,
+	0xfb, 0x33, 0xfe, 0x07, 0xcf, 0x39, 0xbf, 0xff, 0xfe, 0x7f, 0xff, 0xdf,
+	0x7f, 0xfc, 0xcf, 0xff, 0xff, 0x33, 0xfe, 0x73, 0x8f, 0x33, 0xbf, 0xff,
+	0xfe, 0x7f, 0xff, 0xde, 0x6e, 0x6c, 0x87, 0xcd, 0xda, 0x10, 0x3e, 0x73,
+	0x87, 0x27, 0xbf, 0xff, 0xfe, 0x7f, 0xff, 0xc0, 0xee, 0x6c, 0xdf, 0xc8,
+	0x9b, 0x33, 0x3e, 0x43, 0x37, 0x0f, 0xf0, 0xff, 0xfe, 0x7f, 0xff, 0xde,
+	0x6e, 0x6c, 0xdf, 0xea, 0xbb, 0x3b, 0xbe, 0x07, 0x33, 0x07, 0xe7, 0xff,
+	0xfe, 0x7f, 0xff, 0xdf, 0x6e, 0x6c, 0xdf, 0xea, 0xbb, 0x3b, 0xbe, 0x63,
+	0x03, 0x23, 0xf1, 0xff, 0xfe, 0x7f, 0xff, 0xde, 0x6e, 0x6c, 0xdf, 0xe2,
+	0x3b, 0x3b, 0xbe, 0x72, 0x03, 0x33, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xc0,
+	0xe0, 0x6c, 0xc7, 0xf3, 0x7b, 0x13, 0xbe, 0x72, 0x79, 0x31, 0xe7, 0x7f,
+	0x01, 0xfe, 0x7f, 0xf9, 0xff, 0x07, 0xfe, 0x72, 0x79, 0x38, 0xf0, 0xff,
+	0xfe, 0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f,
+	0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3, 0xff, 0x02, 0xfe, 0x7f, 0xff, 0xfd,
+	0x00, 0x00, 0x1f, 0xf9, 0xff, 0x02, 0xfe, 0x7f, 0xff, 0xfd, 0x00, 0x00,
+	0x1f, 0xf9, 0xff, 0x02, 0xfe, 0x7f, 0xff, 0xfd, 0x00, 0x00, 0x1f, 0xf9,
+	0xff, 0x7f, 0xfe, 0x7f, 0xff, 0x1c, 0x38, 0x30, 0x00, 0x18, 0x03, 0xe3,
+	0xfc, 0x07, 0xf0, 0x71, 0xe1, 0xff, 0xfe, 0x7f, 0xff, 0x1c, 0x38, 0x77,
+	0x00, 0x18, 0x03, 0xe3, 0xf8, 0x03, 0xc0, 0x11, 0xc3, 0xff, 0xfe, 0x7f,
+	0xff, 0x1c, 0x3c, 0x77, 0x00, 0x18, 0xf3, 0xe3, 0xf8, 0xf1, 0xc7, 0x11,
+	0x87, 0xff, 0xfe, 0x7f, 0xff, 0x0c, 0x7c, 0x70, 0x1c, 0x18, 0xf3, 0xe3,
+	0xf1, 0xf8, 0x8f, 0x91, 0x8f, 0xff, 0xfe, 0x7f, 0xff, 0x0e, 0x7c, 0x67,
+	0x7f, 0x18, 0xf3, 0xe3, 0xf1, 0xf8, 0x8f, 0xf1, 0x1f, 0xff, 0xfe, 0x7f,
+	0xff, 0x0e, 0x6c, 0xe6, 0x63, 0x98, 0x00, 0x63, 0xf3, 0xfc, 0x9f, 0xf0,
+	0x3f, 0xff, 0xfe, 0x7f, 0xff, 0x0e, 0x6e, 0xe6, 0xe1, 0x18, 0x00, 0x63,
+	0xf3, 0xfc, 0x9f, 0xf0, 0x1f, 0xff, 0xfe, 0x7f, 0xff, 0x06, 0xee, 0xc6,
+	0x7c, 0x18, 0x00, 0x63, 0xf3, 0xfc, 0x9f, 0xf0, 0x0f, 0xff, 0x52, 0xfe,
+	0x7f, 0xff, 0x07, 0xc7, 0xc6, 0x3f, 0x18, 0xfe, 0x63, 0xf1, 0xfc, 0x8f,
+	0xf1, 0x8f, 0xff, 0xfe, 0x7f, 0xff, 0x07, 0xc7, 0xc6, 0x07, 0x98, 0xfe,
+	0x63, 0xf1, 0xf8, 0x8f, 0x91, 0xc7, 0xff, 0xfe, 0x7f, 0xff, 0x07, 0xc7,
+	0xc6, 0xc3, 0x98, 0xfe, 0x63, 0xf8, 0xf1, 0xc7, 0x11, 0xe3, 0xff, 0xfe,
+	0x7f, 0xff, 0x03, 0xc7, 0x86, 0xe3, 0x98, 0x00, 0x60, 0x08, 0x01, 0xc0,
+	0x11, 0xe1, 0xff, 0xfe, 0x7f, 0xff, 0x03, 0x83, 0x86, 0x7f, 0x18, 0x00,
+	0x60, 0x0e, 0x07, 0xf0, 0x71, 0xf1, 0xff, 0xfe, 0x7f, 0xff, 0xfd, 0x00,
+	0x00, 0x1f, 0xf9, 0xff, 0x02, 0xfe, 0x7f, 0xff, 0xfd, 0x00, 0x00, 0x1f,
+	0xf9, 0xff, 0x02, 0xfe, 0x7f, 0xff, 0xfd, 0x00, 0x00, 0x1f, 0xf9, 0xff,
+	0x01, 0xfe, 0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3, 0xff, 0x01, 0xfe,
+	0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3,
+	0xff, 0x00, 0xfe};
+uint16_t built_img_width = 126;
+uint16_t built_img_height = 66;
+uint16_t built_img_length = 711;
+
+// 128x72, 1152 bytes uncompressed
+const uint8_t wisblock_img[] = {
+	0x06, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xfe, 0xff, 0x07, 0x00,
+	0x03, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x01, 0x00, 0x07,
+	0xfe, 0xff, 0x07, 0x80, 0x07, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xfe,
+	0xff, 0x01, 0x80, 0x0f, 0xfe, 0xff, 0x07, 0xc0, 0x0f, 0xff, 0xff, 0xfe,
+	0x00, 0x00, 0x07, 0xfe, 0xff, 0x01, 0x80, 0x0f, 0xfe, 0xff, 0x07, 0xc0,
+	0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x01, 0x80, 0x0f,
+	0xfe, 0xff, 0x07, 0xc0, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xfe,
+	0xff, 0x01, 0x80, 0x0f, 0xfe, 0xff, 0x07, 0xc0, 0x0f, 0xff, 0xff, 0xfe,
+	0x00, 0x00, 0x07, 0xfe, 0xff, 0x01, 0x80, 0x0f, 0xfe, 0xff, 0x07, 0xc0,
+	0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x01, 0x80, 0x0f,
+	0xfe, 0xff, 0x07, 0xc0, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xfe,
+	0xff, 0x01, 0x80, 0x0f, 0xfe, 0xff, 0x07, 0xc0, 0x0f, 0xff, 0xff, 0xfe,
+	0x00, 0x00, 0x07, 0xfe, 0xff, 0x01, 0x80, 0x0f, 0xfe, 0xff, 0x07, 0xc0,
+	0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x01, 0xc0, 0x1f,
+	0xfe, 0xff, 0x06, 0xc0, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xf8, 0xff,
+	0x06, 0xe0, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xf3, 0xff, 0x01, 0x00,
+	0x7f, 0xf3, 0xff, 0x00, 0xf8, 0xf2, 0xff, 0x00, 0xfe, 0xf2, 0xff, 0x00,
+	0xfe, 0x81, 0xff, 0xcf, 0xff, 0x00, 0x83, 0xfd, 0xff, 0x03, 0xfb, 0xfb,
+	0xfe, 0x0f, 0xfa, 0xff, 0x0b, 0x80, 0xff, 0xcd, 0xff, 0xff, 0xfb, 0x3b,
+	0xfe, 0x07, 0xef, 0xbd, 0xdf, 0xfd, 0xff, 0x0b, 0xbe, 0xff, 0xfc, 0xdf,
+	0xff, 0xff, 0x33, 0xfe, 0x73, 0xcf, 0x99, 0xdf, 0xfd, 0xff, 0x0b, 0xbe,
+	0xff, 0xfd, 0x8f, 0xff, 0xff, 0x33, 0xfe, 0x7b, 0x87, 0xb3, 0xdf, 0xfd,
+	0xff, 0x0b, 0xbc, 0xce, 0xcd, 0x87, 0xcd, 0xda, 0x10, 0x3e, 0x73, 0x97,
+	0xb7, 0xdf, 0xfd, 0xff, 0x0c, 0x81, 0xde, 0xed, 0xdf, 0xc8, 0x9b, 0x33,
+	0xbe, 0x43, 0x3b, 0x8f, 0xf8, 0x7f, 0xfe, 0xff, 0x0b, 0xbe, 0xde, 0xcd,
+	0xdf, 0xea, 0xbb, 0x3b, 0xbe, 0x07, 0xbb, 0x83, 0xf3, 0xfd, 0xff, 0x0b,
+	0xbe, 0xde, 0xcd, 0xdf, 0xea, 0xbb, 0x3b, 0xbe, 0x73, 0x03, 0xb1, 0xf8,
+	0xfd, 0xff, 0x0c, 0xbc, 0xde, 0xcd, 0xdf, 0xe2, 0x3b, 0x3b, 0xbe, 0x7b,
+	0x03, 0xbb, 0xff, 0x3f, 0xfe, 0xff, 0x0c, 0x81, 0xc0, 0xcc, 0xc7, 0xf3,
+	0x7b, 0x13, 0xbe, 0x73, 0x7d, 0xb9, 0xf3, 0xbf, 0xf7, 0xff, 0x05, 0xfe,
+	0x73, 0x7d, 0xbc, 0x78, 0x7f, 0xaf, 0xff, 0x00, 0xfe, 0xfd, 0x00, 0x00,
+	0x1f, 0xf7, 0xff, 0x00, 0xfe, 0xfd, 0x00, 0x00, 0x1f, 0xf7, 0xff, 0x00,
+	0xfe, 0xfd, 0x00, 0x00, 0x1f, 0xf7, 0xff, 0x0c, 0xfe, 0x3c, 0x78, 0x70,
+	0x00, 0x18, 0x03, 0xe3, 0xfc, 0x07, 0xf8, 0x78, 0xf0, 0xfe, 0xff, 0x0c,
+	0xfe, 0x38, 0x78, 0xf7, 0x00, 0x18, 0x03, 0xe3, 0xf8, 0x03, 0xc0, 0x19,
+	0xe1, 0xfe, 0xff, 0x0c, 0xfe, 0x38, 0x7c, 0xf7, 0x00, 0x18, 0xf3, 0xe3,
+	0xf8, 0xf1, 0xe7, 0x98, 0xc3, 0xfe, 0xff, 0x0c, 0xfe, 0x18, 0xfc, 0xf0,
+	0x1c, 0x18, 0xf3, 0xe3, 0xf1, 0xf8, 0xcf, 0xd8, 0xc7, 0xfe, 0xff, 0x0c,
+	0xfe, 0x1c, 0xfc, 0xef, 0x7f, 0x18, 0xf3, 0xe3, 0xf1, 0xf8, 0xcf, 0xf9,
+	0x8f, 0xfe, 0xff, 0x0c, 0xfe, 0x1e, 0xd9, 0xee, 0x67, 0x98, 0x00, 0x63,
+	0xf3, 0xfc, 0xdf, 0xf8, 0x1f, 0xfe, 0xff, 0x0c, 0xfe, 0x1e, 0xcd, 0xee,
+	0xe3, 0x98, 0x00, 0x63, 0xf3, 0xfe, 0xdf, 0xf8, 0x1f, 0xfe, 0xff, 0x0c,
+	0xfe, 0x1c, 0xdc, 0xce, 0xf9, 0x18, 0x00, 0x63, 0xf3, 0xfc, 0xdf, 0xf8,
+	0x0f, 0xfe, 0xff, 0x0c, 0xfe, 0x0f, 0xcf, 0xce, 0x7e, 0x18, 0xfe, 0x63,
+	0xf3, 0xfe, 0xdf, 0xf8, 0x87, 0xfe, 0xff, 0x0c, 0xfe, 0x0f, 0x8f, 0xce,
+	0x3f, 0x18, 0xfe, 0x63, 0xf1, 0xfc, 0xcf, 0xf9, 0xc7, 0xfe, 0xff, 0x0c,
+	0xfe, 0x0f, 0xcf, 0xce, 0x07, 0x98, 0xfe, 0x63, 0xf1, 0xf8, 0xcf, 0xd8,
+	0xe3, 0xfe, 0xff, 0x0c, 0xfe, 0x0f, 0xcf, 0xce, 0xc3, 0x98, 0xfe, 0x63,
+	0xf8, 0xf1, 0xe7, 0x99, 0xf1, 0xfe, 0xff, 0x0c, 0xfe, 0x07, 0xcf, 0x8e,
+	0xe3, 0x98, 0x00, 0x60, 0x08, 0x01, 0xe0, 0x18, 0xf0, 0xfe, 0xff, 0x0c,
+	0xfe, 0x07, 0x87, 0x8e, 0xff, 0x18, 0x00, 0x60, 0x0e, 0x07, 0xf8, 0x78,
+	0xf8, 0xfe, 0xff, 0x00, 0xfe, 0xfd, 0x00, 0x00, 0x1f, 0xf7, 0xff, 0x00,
+	0xfe, 0xfd, 0x00, 0x00, 0x1f, 0xf7, 0xff, 0x00, 0xfe, 0xfd, 0x00, 0x00,
+	0x1f, 0x98, 0xff, 0x00, 0x7f, 0xf3, 0xff, 0x01, 0xfe, 0x7f, 0xf3, 0xff,
+	0x01, 0xfe, 0x1f, 0xf3, 0xff, 0x00, 0xf8};
+uint16_t wisblock_width = 128;
+uint16_t wisblock_height = 72;
+uint16_t wisblock_length = 655;
@@ -0,0 +1,152 @@
+/**
+ * @file RAK14000_dump.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Render a screen without updating the display and send it as image
+ *        The frame is sent as binary PBM file (P4) in base64 encoding over
+ *        the AT command interface. Save the lines between the start and the
+ *        end marker and decode them with "base64 -d > frame.pbm"
+ * @version 0.1
+ * @date 2024-03-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "main.h"
+
+/** Bytes per base64 line, encodes to 76 characters */
+#define DUMP_LINE_BYTES 57
+
+static const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/** Bytes waiting for encoding */
+static uint8_t dump_buffer[DUMP_LINE_BYTES];
+/** Number of bytes in dump_buffer */
+static uint8_t dump_len = 0;
+
+/**
+ * @brief Encode and send the bytes in dump_buffer as one base64 line
+ *
+ */
+static void dump_flush(void)
+{
+	char line[DUMP_LINE_BYTES / 3 * 4 + 1];
+	uint8_t out = 0;
+
+	for (uint8_t idx = 0; idx < dump_len; idx += 3)
+	{
+		uint32_t triple = (uint32_t)dump_buffer[idx] << 16;
+		if (idx + 1 < dump_len)
+		{
+			triple |= (uint32_t)dump_buffer[idx + 1] << 8;
+		}
+		if (idx + 2 < dump_len)
+		{
+			triple |= dump_buffer[idx + 2];
+		}
+		line[out++] = base64_chars[(triple >> 18) & 0x3F];
+		line[out++] = base64_chars[(triple >> 12) & 0x3F];
+		line[out++] = (idx + 1 < dump_len) ? base64_chars[(triple >> 6) & 0x3F] : '=';
+		line[out++] = (idx + 2 < dump_len) ? base64_chars[triple & 0x3F] : '=';
+	}
+	line[out] = 0;
+	AT_PRINTF("%s\n", line);
+	dump_len = 0;
+}
+
+/**
+ * @brief Add one byte to the base64 output
+ *
+ * @param data byte to send
+ */
+static void dump_byte(uint8_t data)
+{
+	dump_buffer[dump_len++] = data;
+	if (dump_len == DUMP_LINE_BYTES)
+	{
+		dump_flush();
+	}
+}
+
+/**
+ * @brief Draw a screen into the display buffer
+ *
+ * @param screen 0 = scientific, 1 = iconized, 2 = status, 3 = start screen
+ */
+static void dump_render(uint8_t screen)
+{
+	if (screen == 3)
+	{
+		draw_start_screen_rak14000(true);
+	}
+	else
+	{
+		render_rak14000();
+	}
+}
+
+/**
+ * @brief Render a screen and send it as PBM image
+ *        The display is not updated. The screen is rendered twice, the first
+ *        time the static layer might be drawn, the second time it is taken
+ *        from the template. Both render times are reported.
+ *
+ * @param screen 0 = scientific, 1 = iconized, 2 = status, 3 = start screen
+ * @return true if the frame was sent
+ * @return false if no display or invalid screen
+ */
+bool dump_frame_rak14000(uint8_t screen)
+{
+	if (!has_rak14000 || (screen > 3))
+	{
+		return false;
+	}
+
+	uint8_t old_ui = g_ui_selected;
+	if (screen < 3)
+	{
+		g_ui_selected = screen;
+	}
+
+	time_t start = millis();
+	dump_render(screen);
+	time_t first_time = millis() - start;
+	start = millis();
+	dump_render(screen);
+	time_t second_time = millis() - start;
+
+	g_ui_selected = old_ui;
+
+	AT_PRINTF("+FRAME:%d render %ld ms, again %ld ms\n", screen, first_time, second_time);
+	AT_PRINTF("+FRAME:start\n");
+
+	char header[16];
+	int header_len = snprintf(header, sizeof(header), "P4\n%d %d\n", display.width(), display.height());
+	for (int idx = 0; idx < header_len; idx++)
+	{
+		dump_byte(header[idx]);
+	}
+
+	for (int16_t y = 0; y < display.height(); y++)
+	{
+		uint8_t pixels = 0;
+		for (int16_t x = 0; x < display.width(); x++)
+		{
+			pixels = (pixels << 1) | (display.get_pixel(x, y) ? 1 : 0);
+			if ((x % 8) == 7)
+			{
+				dump_byte(pixels);
+				pixels = 0;
+			}
+		}
+		if ((display.width() % 8) != 0)
+		{
+			dump_byte(pixels << (8 - (display.width() % 8)));
+		}
+	}
+	if (dump_len != 0)
+	{
+		dump_flush();
+	}
+	AT_PRINTF("+FRAME:end\n");
+	return true;
+}
@@ -16,28 +16,33 @@ uint16_t display_width = 400;
 uint16_t display_height = 300;
 
 // 4.2" EPD with SSD1683
-Adafruit_SSD1681 display(display_height, display_width, EPD_MOSI,
-						 EPD_SCK, EPD_DC, EPD_RESET,
-						 EPD_CS, SRAM_CS, EPD_MISO,
-						 EPD_BUSY);
-
-/** Set num_values to 1/4 of the display width */
-
-const uint16_t num_values = 400 / 4;
-uint16_t voc_values[num_values] = {0};
-float temp_values[num_values] = {0.0};
-float humid_values[num_values] = {0.0};
-float baro_values[num_values] = {0.0};
-float co2_values[num_values] = {0.0};
-uint16_t pm10_values[num_values] = {0};
-uint16_t pm25_values[num_values] = {0};
-uint16_t pm100_values[num_values] = {0};
-uint8_t voc_idx = 0;
-uint8_t temp_idx = 0;
-uint8_t humid_idx = 0;
-uint8_t baro_idx = 0;
-uint8_t co2_idx = 0;
-uint8_t pm_idx = 0;
+PartialEPD display(display_height, display_width, EPD_MOSI,
+				   EPD_SCK, EPD_DC, EPD_RESET,
+				   EPD_CS, SRAM_CS, EPD_MISO,
+				   EPD_BUSY);
+
+/**
+ * Value history, num_values is set to 1/4 of the display width
+ * Values are stored as int16_t with the resolution the sensors
+ * really have: value = code * scale + offset
+ * VOC and CO2 keep hourly and daily aggregates for the graphs as well
+ * Only the CO2 graph is auto scaled, only CO2 keeps min/max statistics
+ */
+TieredHistory<num_values> voc_values(1.0, 0.0);			// 1 index step
+QuantizedSeries<num_values> temp_values(0.01, 0.0);		// 0.01 °C
+QuantizedSeries<num_values> humid_values(0.1, 0.0);		// 0.1 %RH
+QuantizedSeries<num_values> baro_values(0.1, 1000.0);	// 0.1 hPa around 1000 hPa
+TieredHistory<num_values, true> co2_values(1.0, 0.0);	// 1 ppm
+QuantizedSeries<num_values> pm10_values(1.0, 0.0);		// 1 ug/m3
+QuantizedSeries<num_values> pm25_values(1.0, 0.0);		// 1 ug/m3
+QuantizedSeries<num_values> pm100_values(1.0, 0.0);		// 1 ug/m3
+QuantizedSeries<num_values> light_values(1.0, 32768.0); // 1 lux, 0 ... 65535 lux
+
+/** Graph time base for VOC and CO2, 0 = per sample, 1 = per hour, 2 = per day */
+uint8_t g_graph_tier = TIER_RAW;
+
+/** Offset of the history time stamps, set from the replayed history log */
+uint32_t g_history_time_offset = 0;
 
 char disp_text[60];
 
@@ -48,24 +53,15 @@ uint8_t g_air_status = 0;
 bool g_status_changed = true;
 
 // For text length calculations
-int16_t txt_x1;
-int16_t txt_y1;
 uint16_t txt_w;
 uint16_t txt_w2;
-uint16_t txt_h;
 
 // For text and image placements
 uint16_t x_text;
 uint16_t y_text;
-uint16_t s_text;
 uint16_t w_text;
 uint16_t h_text;
 uint16_t x_graph;
-uint16_t y_graph;
-uint16_t h_bar;
-uint16_t w_bar;
-float bar_divider;
-uint16_t spacer;
 
 /** UI selector. 0 = scientific, 1 = Icon, 2 = Status */
 uint8_t g_ui_selected = 0;
@@ -75,6 +71,24 @@ uint8_t g_ui_last = 0;
 bool has_rak14000 = false;
 /** Timer for shutdown display */
 SoftwareTimer g_epd_off_timer;
+/** Layer that is drawn, LAYER_STATIC or LAYER_VALUES */
+uint8_t g_draw_layer = LAYER_VALUES;
+/** Flag if a refresh was requested while the display was updating */
+static volatile bool refresh_pending = false;
+
+/**
+ * @brief Interrupt callback for the EPD BUSY pin
+ *        The display update is finished, do the refresh that
+ *        was requested while the display was busy
+ *
+ */
+void epd_busy_int(void)
+{
+	if (display.update_done() && refresh_pending)
+	{
+		api_wake_loop(DISP_UPDATE);
+	}
+}
 
 /**
  * @brief Initialization of RAK14000 EPD
@@ -89,7 +103,11 @@ void init_rak14000(void)
 	display.setRotation(EPD_ROTATION); // 1 for Gavin 3 for mine
 	MYLOG("EPD", "Rotation %d", display.getRotation());
 
+	// BUSY goes low when a display update is finished
+	attachInterrupt(EPD_BUSY, epd_busy_int, FALLING);
+
 	read_ui_settings();
+	read_graph_settings();
 
 	rak14000_start_screen(true);
 
@@ -234,8 +252,72 @@ bool first_time = true;
 
 char *months_txt[] = {(char *)"Jan", (char *)"Feb", (char *)"Mar", (char *)"Apr", (char *)"May", (char *)"Jun", (char *)"Jul", (char *)"Aug", (char *)"Sep", (char *)"Oct", (char *)"Nov", (char *)"Dec"};
 
+/**
+ * @brief Get the layout of the static screen layer
+ *        The static layer has to be redrawn if any of these change
+ *
+ * @return uint32_t layout key
+ */
+static uint32_t layout_key_rak14000(void)
+{
+	return (uint32_t)sensor_caps() |
+		   ((uint32_t)g_ui_selected << 16) |
+		   ((uint32_t)g_graph_tier << 20) |
+		   ((uint32_t)(txt_color == EPD_BLACK) << 24) |
+		   ((uint32_t)display.getRotation() << 25);
+}
+
+/**
+ * @brief Draw the selected UI into the display buffer
+ *        Icons, dividers, axis and unit labels are drawn once into a
+ *        template, each update starts from the template and draws the values
+ *
+ */
+void render_rak14000(void)
+{
+	if (g_ui_selected == 2)
+	{
+		// Status screen has no static layer
+		clear_rak14000();
+		status_ui_rak14000();
+	}
+	else
+	{
+		uint32_t layout_key = layout_key_rak14000();
+		if (!display.restore_template(layout_key))
+		{
+			MYLOG("EPD", "Draw static layer");
+			clear_rak14000();
+			g_draw_layer = LAYER_STATIC;
+			if (g_ui_selected == 0)
+			{
+				scientific_rak14000();
+			}
+			else
+			{
+				icon_rak14000();
+			}
+			g_draw_layer = LAYER_VALUES;
+			display.store_template(layout_key);
+		}
+
+		status_lora_rak14000();
+
+		if (g_ui_selected == 0)
+		{
+			scientific_rak14000();
+		}
+		else
+		{
+			icon_rak14000();
+		}
+	}
+}
+
 /**
  * @brief Update screen content
+ *        Does not wait for the display update. If the display is still
+ *        busy with the last update, the refresh is done when it is finished.
  *
  */
 void refresh_rak14000(void)
@@ -248,31 +330,23 @@ void refresh_rak14000(void)
 		return;
 	}
 
-	// Clear display buffer
-	clear_rak14000();
-
-	status_lora_rak14000();
-
-	switch (g_ui_selected)
+	// Set the flag first, the update might finish right now
+	refresh_pending = true;
+	if (display.update_busy())
 	{
-	case 0:
-		scientific_rak14000();
-		break;
-	case 1:
-		icon_rak14000();
-		break;
-	case 2:
-		status_ui_rak14000();
-		break;
+		// Display is still updating, the BUSY interrupt requests the refresh again
+		MYLOG("EPD", "Display busy, refresh when finished");
+		return;
 	}
+	refresh_pending = false;
 
-	if (has_rak14000)
-	{
-		delay(100);
+	time_t render_start = millis();
+	render_rak14000();
+	uint32_t render_time = millis() - render_start;
+	display.total_blocked += render_time;
+	MYLOG("EPD", "Render time %ld ms", render_time);
 
-		display.display();
-		delay(100);
-	}
+	display.refresh();
 }
 
 /**
@@ -282,22 +356,13 @@ void refresh_rak14000(void)
  */
 void set_voc_rak14000(uint16_t voc_value)
 {
-	MYLOG("EPD", "VOC set to %d at index %d", voc_value, voc_idx);
-	// Shift values if necessary
-	if (voc_idx == num_values)
+	MYLOG("EPD", "VOC set to %d at index %d", voc_value, voc_values.size());
+	uint32_t now = history_time();
+	if (voc_values.push(voc_value, now))
 	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			voc_values[idx] = voc_values[idx + 1];
-		}
-		voc_idx = (num_values - 1);
+		history_tiers_changed();
 	}
-
-	// Fill VOC array
-	voc_values[voc_idx] = voc_value;
-
-	// Increase index
-	voc_idx++;
+	add_history_log(HIST_VOC, voc_values.latest_code(), now);
 }
 
 /**
@@ -307,22 +372,9 @@ void set_voc_rak14000(uint16_t voc_value)
  */
 void set_temp_rak14000(float temp_value)
 {
-	MYLOG("EPD", "Temp set to %.2f at index %d", temp_value, temp_idx);
-	// Shift values if necessary
-	if (temp_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			temp_values[idx] = temp_values[idx + 1];
-		}
-		temp_idx = (num_values - 1);
-	}
-
-	// Fill Temperature array
-	temp_values[temp_idx] = temp_value;
-
-	// Increase index
-	temp_idx++;
+	MYLOG("EPD", "Temp set to %.2f at index %d", temp_value, temp_values.size());
+	temp_values.push(temp_value);
+	add_history_log(HIST_TEMP, temp_values.latest_code(), history_time());
 }
 
 /**
@@ -332,22 +384,9 @@ void set_temp_rak14000(float temp_value)
  */
 void set_humid_rak14000(float humid_value)
 {
-	MYLOG("EPD", "Humid set to %.2f at index %d", humid_value, humid_idx);
-	// Shift values if necessary
-	if (humid_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			humid_values[idx] = humid_values[idx + 1];
-		}
-		humid_idx = (num_values - 1);
-	}
-
-	// Fill VOC array
-	humid_values[humid_idx] = humid_value;
-
-	// Increase index
-	humid_idx++;
+	MYLOG("EPD", "Humid set to %.2f at index %d", humid_value, humid_values.size());
+	humid_values.push(humid_value);
+	add_history_log(HIST_HUMID, humid_values.latest_code(), history_time());
 }
 
 /**
@@ -357,22 +396,13 @@ void set_humid_rak14000(float humid_value)
  */
 void set_co2_rak14000(float co2_value)
 {
-	MYLOG("EPD", "CO2 set to %.2f at index %d", co2_value, co2_idx);
-	// Shift values if necessary
-	if (co2_idx == num_values)
+	MYLOG("EPD", "CO2 set to %.2f at index %d", co2_value, co2_values.size());
+	uint32_t now = history_time();
+	if (co2_values.push(co2_value, now))
 	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			co2_values[idx] = co2_values[idx + 1];
-		}
-		co2_idx = (num_values - 1);
+		history_tiers_changed();
 	}
-
-	// Fill VOC array
-	co2_values[co2_idx] = co2_value;
-
-	// Increase index
-	co2_idx++;
+	add_history_log(HIST_CO2, co2_values.latest_code(), now);
 }
 
 /**
@@ -382,22 +412,9 @@ void set_co2_rak14000(float co2_value)
  */
 void set_baro_rak14000(float baro_value)
 {
-	MYLOG("EPD", "Baro set to %.2f at index %d", baro_value, baro_idx);
-	// Shift values if necessary
-	if (baro_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			baro_values[idx] = baro_values[idx + 1];
-		}
-		baro_idx = (num_values - 1);
-	}
-
-	// Fill Barometer array
-	baro_values[baro_idx] = baro_value;
-
-	// Increase index
-	baro_idx++;
+	MYLOG("EPD", "Baro set to %.2f at index %d", baro_value, baro_values.size());
+	baro_values.push(baro_value);
+	add_history_log(HIST_BARO, baro_values.latest_code(), history_time());
 }
 
 /**
@@ -409,36 +426,74 @@ void set_baro_rak14000(float baro_value)
  */
 void set_pm_rak14000(uint16_t pm10_env, uint16_t pm25_env, uint16_t pm100_env)
 {
-	MYLOG("EPD", "PM set to %d %d %d  at index %d", pm10_env, pm25_env, pm100_env, pm_idx);
-	// Shift values if necessary
-	if (pm_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			pm10_values[idx] = pm10_values[idx + 1];
-			pm25_values[idx] = pm25_values[idx + 1];
-			pm100_values[idx] = pm100_values[idx + 1];
-		}
-		pm_idx = (num_values - 1);
-	}
+	MYLOG("EPD", "PM set to %d %d %d  at index %d", pm10_env, pm25_env, pm100_env, pm10_values.size());
+	uint32_t now = history_time();
+	pm10_values.push(pm10_env);
+	pm25_values.push(pm25_env);
+	pm100_values.push(pm100_env);
+	add_history_log(HIST_PM10, pm10_values.latest_code(), now);
+	add_history_log(HIST_PM25, pm25_values.latest_code(), now);
+	add_history_log(HIST_PM100, pm100_values.latest_code(), now);
+}
 
-	// Fill PM array
-	pm10_values[pm_idx] = pm10_env;
-	pm25_values[pm_idx] = pm25_env;
-	pm100_values[pm_idx] = pm100_env;
+/**
+ * @brief Add light value to buffer
+ *
+ * @param light_value new light value in lux
+ */
+void set_light_rak14000(float light_value)
+{
+	MYLOG("EPD", "Light set to %.2f at index %d", light_value, light_values.size());
+	light_values.push(light_value);
+	add_history_log(HIST_LIGHT, light_values.latest_code(), history_time());
+}
 
-	// Increase index
-	pm_idx++;
+/**
+ * @brief Time stamp for the value history
+ *        Uses the RTC if available, otherwise the time since power up
+ *        plus the last time found in the history log. Then the hour and
+ *        day slots are not aligned to the clock
+ *
+ * @return uint32_t time in seconds
+ */
+uint32_t history_time(void)
+{
+	if (has_rak12002)
+	{
+		return get_rak12002_epoch();
+	}
+	return millis() / 1000 + g_history_time_offset;
 }
 
+/**
+ * @brief Show the start screen
+ *
+ * @param startup true for the welcome screen, false for the shutdown screen
+ */
 void rak14000_start_screen(bool startup)
+{
+	draw_start_screen_rak14000(startup);
+	display.refresh(true);
+	if (!startup)
+	{
+		// Device is reset after the shutdown screen
+		display.wait_update();
+	}
+}
+
+/**
+ * @brief Draw the start screen into the display buffer
+ *
+ * @param startup true for the welcome screen, false for the shutdown screen
+ */
+void draw_start_screen_rak14000(bool startup)
 {
 	// Clear display
 	display.clearBuffer();
 
 	// Draw Welcome Logo
 	display.fillRect(0, 0, display_width, display_height, bg_color);
-	display.drawBitmap(display_width / 2 - 92, 40, rak_img, 184, 56, txt_color); // 184x56
+	display.draw_packed(display_width / 2 - 92, 40, rak_img, 184, 56, txt_color); // 184x56
 
 	display.setFont(SMALL_FONT);
 	display.setTextSize(1);
@@ -452,7 +507,7 @@ void rak14000_start_screen(bool startup)
 			snprintf(disp_text, 59, "%s %d %d %02d:%02d Batt: %.2f V",
 					 months_txt[g_date_time.month - 1], g_date_time.date, g_date_time.year,
 					 g_date_time.hour, g_date_time.minute,
-					 read_batt() / 1000.0);
+					 battery_mv() / 1000.0);
 		}
 		else
 		{
@@ -460,21 +515,17 @@ void rak14000_start_screen(bool startup)
 					 months_txt[g_date_time.month - 1], g_date_time.date, g_date_time.year,
 					 g_date_time.hour, g_date_time.minute);
 		}
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+		txt_w = text_width_rak14000(SMALL_FONT, disp_text);
 		text_rak14000((display_width / 2) - (txt_w / 2), 290, disp_text, (uint16_t)txt_color, 1);
 	}
 
-	display.setFont(LARGE_FONT);
-	display.setTextSize(1);
-	display.getTextBounds((char *)"IoT Made Easy", 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+	txt_w = LARGE_TEXT_W("IoT Made Easy");
 	text_rak14000(display_width / 2 - (txt_w / 2), 110, (char *)"IoT Made Easy", (uint16_t)txt_color, 2);
 
-	display.setFont(LARGE_FONT);
-	display.setTextSize(1);
-	display.getTextBounds((char *)"RAK10702 Indoor Comfort", 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+	txt_w = LARGE_TEXT_W("RAK10702 Indoor Comfort");
 	text_rak14000(display_width / 2 - (txt_w / 2), 150, (char *)"RAK10702 Indoor Comfort", (uint16_t)txt_color, 2);
 
-	display.drawBitmap(display_width / 2 - 63, 190, built_img, 126, 66, txt_color);
+	display.draw_packed(display_width / 2 - 63, 190, built_img, 126, 66, txt_color);
 
 	display.setFont(SMALL_FONT);
 	display.setTextSize(1);
@@ -484,14 +535,14 @@ void rak14000_start_screen(bool startup)
 		{
 			if (!g_lpwan_has_joined)
 			{
-				display.getTextBounds((char *)"Wait for connection to LoRaWAN server", 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+				txt_w = SMALL_TEXT_W("Wait for connection to LoRaWAN server");
 				text_rak14000(display_width / 2 - (txt_w / 2), 260, (char *)"Wait for connection to LoRaWAN server", (uint16_t)txt_color, 1);
 			}
 			else
 			{
 				// snprintf(disp_text, 59, "Wait %lds for first sensor data readings", (uint32_t)(g_lorawan_settings.send_repeat_time - millis() + g_app_start_time) / 1000);
 				snprintf(disp_text, 59, "Wait 30s for first sensor data readings");
-				display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+				txt_w = SMALL_TEXT_W("Wait 30s for first sensor data readings");
 				text_rak14000(display_width / 2 - (txt_w / 2), 260, disp_text, (uint16_t)txt_color, 1);
 			}
 		}
@@ -499,19 +550,17 @@ void rak14000_start_screen(bool startup)
 		{
 			// snprintf(disp_text, 59, "Wait %lds for first sensor data readings", (uint32_t)(g_lorawan_settings.send_repeat_time - millis() + g_app_start_time) / 1000);
 			snprintf(disp_text, 59, "Wait 30s for first sensor data readings");
-			display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+			txt_w = SMALL_TEXT_W("Wait 30s for first sensor data readings");
 			text_rak14000(display_width / 2 - (txt_w / 2), 260, disp_text, (uint16_t)txt_color, 1);
 		}
 	}
 	else
 	{
-		display.getTextBounds((char *)"Thank you!", 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+		txt_w = SMALL_TEXT_W("Thank you!");
 		text_rak14000(display_width / 2 - (txt_w / 2), 260, (char *)"Thank you!", (uint16_t)txt_color, 1);
 	}
 
 	status_lora_rak14000();
-
-	display.display(false);
 }
 
 void rak14000_switch_bg(void)
@@ -15,6 +15,20 @@
 
 #include "RAK14000_epd.h"
 
+/**
+ * @brief Write disp_text at the current text position
+ *        Labels and values are written together, so nothing is written
+ *        into the static layer
+ *
+ */
+static void icon_text_rak14000(void)
+{
+	if (g_draw_layer == LAYER_VALUES)
+	{
+		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+	}
+}
+
 void icon_rak14000(void)
 {
 	uint8_t old_air_status = g_air_status;
@@ -26,58 +40,63 @@ void icon_rak14000(void)
 	display.setFont(SMALL_FONT);
 	display.setTextSize(1);
 
-	if (has_rak12002)
-	{
-		read_rak12002();
-
-		if (g_is_using_battery)
-		{
-			snprintf(disp_text, 59, "RAK10702 Indoor Comfort %s %d %d %02d:%02d Batt: %.2f V",
-					 months_txt[g_date_time.month - 1], g_date_time.date, g_date_time.year,
-					 g_date_time.hour, g_date_time.minute,
-					 read_batt() / 1000.0);
-		}
-		else
-		{
-			snprintf(disp_text, 59, "RAK10702 Indoor Comfort %s %d %d %02d:%02d",
-					 months_txt[g_date_time.month - 1], g_date_time.date, g_date_time.year,
-					 g_date_time.hour, g_date_time.minute);
-		}
-	}
-	else
+	// Status line has date and battery voltage, not part of the static layer
+	if (g_draw_layer == LAYER_VALUES)
 	{
-		if (g_is_using_battery)
+		if (has_rak12002)
 		{
-			snprintf(disp_text, 59, "RAK10702 Indoor Comfort Batt: %.2f V", read_batt() / 1000.0);
+			read_rak12002();
+
+			if (g_is_using_battery)
+			{
+				snprintf(disp_text, 59, "RAK10702 Indoor Comfort %s %d %d %02d:%02d Batt: %.2f V",
+						 months_txt[g_date_time.month - 1], g_date_time.date, g_date_time.year,
+						 g_date_time.hour, g_date_time.minute,
+						 battery_mv() / 1000.0);
+			}
+			else
+			{
+				snprintf(disp_text, 59, "RAK10702 Indoor Comfort %s %d %d %02d:%02d",
+						 months_txt[g_date_time.month - 1], g_date_time.date, g_date_time.year,
+						 g_date_time.hour, g_date_time.minute);
+			}
 		}
 		else
 		{
-			snprintf(disp_text, 59, "RAK10702 Indoor Comfort");
+			if (g_is_using_battery)
+			{
+				snprintf(disp_text, 59, "RAK10702 Indoor Comfort Batt: %.2f V", battery_mv() / 1000.0);
+			}
+			else
+			{
+				snprintf(disp_text, 59, "RAK10702 Indoor Comfort");
+			}
 		}
-	}
 
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-	text_rak14000((display_width / 2) - (txt_w / 2), 290, disp_text, (uint16_t)txt_color, 1);
+		txt_w = text_width_rak14000(SMALL_FONT, disp_text);
+		text_rak14000((display_width / 2) - (txt_w / 2), 290, disp_text, (uint16_t)txt_color, 1);
+	}
 
-	snprintf(disp_text, 29, "Temperature: %.2f~C", temp_values[temp_idx - 1]);
-	text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+	snprintf(disp_text, 29, "Temperature: %.2f~C", temp_values.latest());
+	icon_text_rak14000();
 	y_text += 20;
 
-	snprintf(disp_text, 29, "Humidity: %.2f%%RH", humid_values[humid_idx - 1]);
-	text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+	snprintf(disp_text, 29, "Humidity: %.2f%%RH", humid_values.latest());
+	icon_text_rak14000();
 	y_text += 20;
 
-	if (has_rak1902 || has_rak1906)
+	uint16_t caps = sensor_caps();
+	if (caps & SENSOR_CAP_BARO)
 	{
-		snprintf(disp_text, 29, "Baro: %.2fmBar", baro_values[baro_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		snprintf(disp_text, 29, "Baro: %.2fmBar", baro_values.latest());
+		icon_text_rak14000();
 		y_text += 20;
 	}
 
-	if (has_rak1903 || has_rak12010)
+	if (caps & SENSOR_CAP_LIGHT)
 	{
 		snprintf(disp_text, 29, "Light: %.2f Lux", g_last_light_lux);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		icon_text_rak14000();
 		y_text += 33;
 	}
 	uint8_t level = 0;
@@ -87,14 +106,14 @@ void icon_rak14000(void)
 		// Get VOC status
 		if (g_voc_valid)
 		{
-			if (voc_values[voc_idx - 1] > 400)
+			if (voc_values.latest() > 400)
 			{
 				if (g_air_status < 255)
 				{
 					g_air_status = 255;
 				}
 			}
-			else if (voc_values[voc_idx - 1] > 250)
+			else if (voc_values.latest() > 250)
 			{
 				if (g_air_status < 128)
 				{
@@ -102,46 +121,46 @@ void icon_rak14000(void)
 				}
 			}
 		}
-		level = (uint8_t)(voc_values[voc_idx - 1] / 100);
-		snprintf(disp_text, 29, "VOC %d", voc_values[voc_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		level = (uint8_t)(voc_values.latest() / 100);
+		snprintf(disp_text, 29, "VOC %.0f", voc_values.latest());
+		icon_text_rak14000();
 		draw_bar_rak14000(level, display_width - 72, y_text);
 		y_text += 33;
 	}
 
 	if (has_rak12037)
 	{
-		if (co2_values[co2_idx - 1] > 1500)
+		if (co2_values.latest() > 1500)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (co2_values[co2_idx - 1] > 1000)
+		else if (co2_values.latest() > 1000)
 		{
 			if (g_air_status < 128)
 			{
 				g_air_status = 128;
 			}
 		}
-		level = (uint8_t)(co2_values[co2_idx - 1] / 500);
-		snprintf(disp_text, 29, "CO2 %.0f", co2_values[co2_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		level = (uint8_t)(co2_values.latest() / 500);
+		snprintf(disp_text, 29, "CO2 %.0f", co2_values.latest());
+		icon_text_rak14000();
 		draw_bar_rak14000(level, display_width - 72, y_text);
 		y_text += 33;
 	}
 	if (has_rak12039)
 	{
 		// PM 1.0 levels
-		if (pm10_values[pm_idx - 1] > 75)
+		if (pm10_values.latest() > 75)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (pm10_values[pm_idx - 1] > 35)
+		else if (pm10_values.latest() > 35)
 		{
 			if (g_air_status < 128)
 			{
@@ -149,14 +168,14 @@ void icon_rak14000(void)
 			}
 		}
 		// PM 2.5 levels
-		if (pm25_values[pm_idx - 1] > 75)
+		if (pm25_values.latest() > 75)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (pm25_values[pm_idx - 1] > 35)
+		else if (pm25_values.latest() > 35)
 		{
 			if (g_air_status < 128)
 			{
@@ -164,37 +183,44 @@ void icon_rak14000(void)
 			}
 		}
 		// PM 10 levels
-		if (pm100_values[pm_idx - 1] > 199)
+		if (pm100_values.latest() > 199)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (pm100_values[pm_idx - 1] > 150)
+		else if (pm100_values.latest() > 150)
 		{
 			if (g_air_status < 128)
 			{
 				g_air_status = 128;
 			}
 		}
-		level = (uint8_t)(pm10_values[pm_idx - 1] / 15);
-		snprintf(disp_text, 29, "PM 1.0: %d", pm10_values[pm_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		level = (uint8_t)(pm10_values.latest() / 15);
+		snprintf(disp_text, 29, "PM 1.0: %.0f", pm10_values.latest());
+		icon_text_rak14000();
 		draw_bar_rak14000(level, display_width - 72, y_text);
 		y_text += 33;
-		level = (uint8_t)(pm25_values[pm_idx - 1] / 15);
-		snprintf(disp_text, 29, "PM 2.5: %d", pm25_values[pm_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		level = (uint8_t)(pm25_values.latest() / 15);
+		snprintf(disp_text, 29, "PM 2.5: %.0f", pm25_values.latest());
+		icon_text_rak14000();
 		draw_bar_rak14000(level, display_width - 72, y_text);
 		y_text += 33;
-		level = (uint8_t)(pm100_values[pm_idx - 1] / 40);
-		snprintf(disp_text, 29, "PM 10: %d", pm100_values[pm_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		level = (uint8_t)(pm100_values.latest() / 40);
+		snprintf(disp_text, 29, "PM 10: %.0f", pm100_values.latest());
+		icon_text_rak14000();
 		draw_bar_rak14000(level, display_width - 72, y_text);
 		y_text += 33;
 	}
 
+	if (g_draw_layer == LAYER_STATIC)
+	{
+		// No values in the static layer, keep the air status
+		g_air_status = old_air_status;
+		return;
+	}
+
 	if (old_air_status != g_air_status)
 	{
 		g_status_changed = true;
@@ -202,66 +228,40 @@ void icon_rak14000(void)
 
 	if (g_air_status == 0)
 	{
-		display.drawBitmap((x_text - good_air_width) / 2, (display_height - 20 - good_air_height) / 2, good_air, good_air_width, good_air_height, txt_color);
+		display.draw_packed((x_text - good_air_width) / 2, (display_height - 20 - good_air_height) / 2, good_air, good_air_width, good_air_height, txt_color);
 		// set_rgb_color(RGB_BLUE);
 	}
 	else if (g_air_status < 255)
 	{
-		display.drawBitmap((x_text - bad_air_width) / 2, (display_height - 20 - bad_air_height) / 2, worried_air, worried_air_width, worried_air_height, txt_color);
+		display.draw_packed((x_text - bad_air_width) / 2, (display_height - 20 - bad_air_height) / 2, worried_air, worried_air_width, worried_air_height, txt_color);
 		// set_rgb_color(RGB_YELLOW);
 	}
 	else
 	{
-		display.drawBitmap((x_text - worried_air_width) / 2, (display_height - 20 - worried_air_height) / 2, bad_air, bad_air_width, bad_air_height, txt_color);
+		display.draw_packed((x_text - worried_air_width) / 2, (display_height - 20 - worried_air_height) / 2, bad_air, bad_air_width, bad_air_height, txt_color);
 		// set_rgb_color(RGB_RED);
 	}
 }
 
+/**
+ * @brief Draw a level bar, the frames of the bars are part of the
+ *        static layer, the filled bars are drawn with the values
+ *
+ * @param level number of filled bars, 0 to 5
+ * @param x position of the first bar
+ * @param y top of the first bar
+ */
 void draw_bar_rak14000(uint8_t level, uint16_t x, uint16_t y)
 {
-	switch (level)
+	for (uint8_t bar = 0; bar < 5; bar++)
 	{
-	case 0:
-		display.drawRect(x, y, 10, 10, txt_color);
-		display.drawRect(x + 15, y - 5, 10, 15, txt_color);
-		display.drawRect(x + 30, y - 10, 10, 20, txt_color);
-		display.drawRect(x + 45, y - 15, 10, 25, txt_color);
-		display.drawRect(x + 60, y - 20, 10, 30, txt_color);
-		break;
-	case 1:
-		display.fillRect(x, y, 10, 10, txt_color);
-		display.drawRect(x + 15, y - 5, 10, 15, txt_color);
-		display.drawRect(x + 30, y - 10, 10, 20, txt_color);
-		display.drawRect(x + 45, y - 15, 10, 25, txt_color);
-		display.drawRect(x + 60, y - 20, 10, 30, txt_color);
-		break;
-	case 2:
-		display.fillRect(x, y, 10, 10, txt_color);
-		display.fillRect(x + 15, y - 5, 10, 15, txt_color);
-		display.drawRect(x + 30, y - 10, 10, 20, txt_color);
-		display.drawRect(x + 45, y - 15, 10, 25, txt_color);
-		display.drawRect(x + 60, y - 20, 10, 30, txt_color);
-		break;
-	case 3:
-		display.fillRect(x, y, 10, 10, txt_color);
-		display.fillRect(x + 15, y - 5, 10, 15, txt_color);
-		display.fillRect(x + 30, y - 10, 10, 20, txt_color);
-		display.drawRect(x + 45, y - 15, 10, 25, txt_color);
-		display.drawRect(x + 60, y - 20, 10, 30, txt_color);
-		break;
-	case 4:
-		display.fillRect(x, y, 10, 10, txt_color);
-		display.fillRect(x + 15, y - 5, 10, 15, txt_color);
-		display.fillRect(x + 30, y - 10, 10, 20, txt_color);
-		display.fillRect(x + 45, y - 15, 10, 25, txt_color);
-		display.drawRect(x + 60, y - 20, 10, 30, txt_color);
-		break;
-	default:
-		display.fillRect(x, y, 10, 10, txt_color);
-		display.fillRect(x + 15, y - 5, 10, 15, txt_color);
-		display.fillRect(x + 30, y - 10, 10, 20, txt_color);
-		display.fillRect(x + 45, y - 15, 10, 25, txt_color);
-		display.fillRect(x + 60, y - 20, 10, 30, txt_color);
-		break;
+		if (g_draw_layer == LAYER_STATIC)
+		{
+			display.drawRect(x + bar * 15, y - bar * 5, 10, 10 + bar * 5, txt_color);
+		}
+		else if (bar < level)
+		{
+			display.fillRect(x + bar * 15, y - bar * 5, 10, 10 + bar * 5, txt_color);
+		}
 	}
-}
\ No newline at end of file
+}
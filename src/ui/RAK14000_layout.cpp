@@ -0,0 +1,134 @@
+/**
+ * @file RAK14000_layout.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Layout of the scientific UI
+ *        The position of each widget depends on the found modules.
+ *        All possible positions are listed in one table, the entries
+ *        that match the found modules are copied into a widget list
+ *        once. The scientific UI only walks through this list.
+ *        To support a new module combination, add entries to the table.
+ * @version 0.1
+ * @date 2024-03-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "main.h"
+
+/** Display size used in the layout table, same as display_width and display_height */
+#define LAYOUT_W 400
+#define LAYOUT_H 300
+
+/** Layout table entry */
+struct layout_entry_s
+{
+	/** SENSOR_CAP_xxx that must be found */
+	uint16_t need;
+	/** SENSOR_CAP_xxx that must not be found */
+	uint16_t none;
+	/** Widget and its position */
+	widget_s widget;
+};
+
+/**
+ * @brief Positions of all widgets for all module combinations
+ *
+ * need, none,
+ * {type, style, icon x, icon y, x, y, w, h}
+ */
+static const layout_entry_s scientific_layout[] = {
+	// VOC graph, top left
+	{SENSOR_CAP_VOC, 0,
+	 {WIDGET_VOC_GRAPH, STYLE_ROW, 2, 1, 0, 50, LAYOUT_W / 2, LAYOUT_H / 2 - 60}},
+
+	// With PM sensor: CO2 value top right, PM values right, others bottom left
+	{SENSOR_CAP_CO2 | SENSOR_CAP_PM, 0,
+	 {WIDGET_CO2_VALUE, STYLE_COLUMN, LAYOUT_W / 2 + 53, 5, LAYOUT_W - 1, 25, 0, 0}},
+	{SENSOR_CAP_PM, 0,
+	 {WIDGET_PM, STYLE_COLUMN, LAYOUT_W / 2 + 53, LAYOUT_H / 4 - 10, LAYOUT_W - 45, LAYOUT_H / 4 + 50, 0, 60}},
+	{SENSOR_CAP_PM | SENSOR_CAP_BARO, 0,
+	 {WIDGET_TEMP, STYLE_ROW, 25, LAYOUT_H / 2, 85, LAYOUT_H / 2 + 16, 0, 0}},
+	{SENSOR_CAP_PM | SENSOR_CAP_LIGHT, SENSOR_CAP_BARO,
+	 {WIDGET_TEMP, STYLE_ROW, 25, LAYOUT_H / 2, 85, LAYOUT_H / 2 + 16, 0, 0}},
+	{SENSOR_CAP_PM, SENSOR_CAP_BARO | SENSOR_CAP_LIGHT,
+	 {WIDGET_TEMP, STYLE_ROW, 25, LAYOUT_H / 4 + 95, 85, LAYOUT_H / 4 + 111, 0, 0}},
+	{SENSOR_CAP_PM | SENSOR_CAP_BARO, 0,
+	 {WIDGET_HUMID, STYLE_ROW, 25, LAYOUT_H / 2 + 50, 85, LAYOUT_H / 2 + 66, 0, 0}},
+	{SENSOR_CAP_PM | SENSOR_CAP_LIGHT, SENSOR_CAP_BARO,
+	 {WIDGET_HUMID, STYLE_ROW, 25, LAYOUT_H / 2 + 50, 85, LAYOUT_H / 2 + 66, 0, 0}},
+	{SENSOR_CAP_PM, SENSOR_CAP_BARO | SENSOR_CAP_LIGHT,
+	 {WIDGET_HUMID, STYLE_ROW, 25, LAYOUT_H / 4 + 155, 85, LAYOUT_H / 4 + 171, 0, 0}},
+	{SENSOR_CAP_PM | SENSOR_CAP_BARO, 0,
+	 {WIDGET_BARO, STYLE_ROW, 25, LAYOUT_H / 2 + 100, 85, LAYOUT_H / 2 + 116, 0, 0}},
+	{SENSOR_CAP_PM | SENSOR_CAP_LIGHT, SENSOR_CAP_BARO,
+	 {WIDGET_LIGHT, STYLE_ROW, 25, LAYOUT_H / 2 + 100, 85, LAYOUT_H / 2 + 116, 0, 0}},
+
+	// Without PM sensor: CO2 graph bottom left, others right
+	{SENSOR_CAP_CO2, SENSOR_CAP_PM,
+	 {WIDGET_CO2_GRAPH, STYLE_ROW, 2, LAYOUT_H / 2 - 10, 0, LAYOUT_H / 2 + 40, LAYOUT_W / 2, LAYOUT_H / 2 - 62}},
+	{0, SENSOR_CAP_PM,
+	 {WIDGET_TEMP, STYLE_COLUMN, LAYOUT_W / 4 * 3 + 16, 12, LAYOUT_W - 3, 62, 0, 0}},
+	{0, SENSOR_CAP_PM,
+	 {WIDGET_HUMID, STYLE_COLUMN, LAYOUT_W / 4 * 3 + 16, LAYOUT_H / 3 + 15, LAYOUT_W - 3, LAYOUT_H / 3 + 65, 0, 0}},
+	{SENSOR_CAP_BARO, SENSOR_CAP_PM,
+	 {WIDGET_BARO, STYLE_COLUMN, LAYOUT_W / 4 * 3 + 16, LAYOUT_H / 3 * 2 + 15, LAYOUT_W - 3, LAYOUT_H / 3 * 2 + 65, 0, 0}},
+	{SENSOR_CAP_LIGHT, SENSOR_CAP_PM | SENSOR_CAP_BARO,
+	 {WIDGET_LIGHT, STYLE_COLUMN, LAYOUT_W / 4 * 3 + 16, LAYOUT_H / 3 * 2 + 15, LAYOUT_W - 3, LAYOUT_H / 3 * 2 + 65, 0, 0}},
+
+	// Dividers, line from x/y to x+w/y+h
+	{0, 0,
+	 {WIDGET_DIVIDER, 0, 0, 0, LAYOUT_W / 2 + 50, 0, 0, LAYOUT_H - 13}},
+	{SENSOR_CAP_PM, 0,
+	 {WIDGET_DIVIDER, 0, 0, 0, 0, LAYOUT_H / 2 - 7, LAYOUT_W / 2 + 50, 0}},
+	{SENSOR_CAP_PM, 0,
+	 {WIDGET_DIVIDER, 0, 0, 0, LAYOUT_W / 2 + 50, LAYOUT_H / 5 - 10, LAYOUT_W / 2 - 50, 0}},
+	{0, SENSOR_CAP_PM,
+	 {WIDGET_DIVIDER, 0, 0, 0, LAYOUT_W / 2 + 50, LAYOUT_H / 3 - 10, LAYOUT_W / 2 - 50, 0}},
+	{0, SENSOR_CAP_PM,
+	 {WIDGET_DIVIDER, 0, 0, 0, LAYOUT_W / 2 + 50, LAYOUT_H / 3 * 2 - 10, LAYOUT_W / 2 - 50, 0}},
+};
+
+/** Number of entries in the layout table */
+constexpr uint8_t scientific_layout_num = sizeof(scientific_layout) / sizeof(layout_entry_s);
+
+/** Widgets of the found modules */
+widget_s g_widgets[WIDGETS_MAX];
+/** Number of widgets in g_widgets */
+uint8_t g_widgets_num = 0;
+/** Modules g_widgets was created for */
+static uint16_t layout_caps = 0;
+/** Flag if g_widgets is valid */
+static bool layout_valid = false;
+
+/**
+ * @brief Create the widget list for the found modules
+ *        Only done if the found modules changed
+ *
+ * @param caps SENSOR_CAP_xxx of the found modules
+ */
+void layout_rak14000(uint16_t caps)
+{
+	if (layout_valid && (caps == layout_caps))
+	{
+		return;
+	}
+
+	g_widgets_num = 0;
+	for (uint8_t idx = 0; idx < scientific_layout_num; idx++)
+	{
+		const layout_entry_s *entry = &scientific_layout[idx];
+		if (((caps & entry->need) != entry->need) || ((caps & entry->none) != 0))
+		{
+			continue;
+		}
+		if (g_widgets_num == WIDGETS_MAX)
+		{
+			MYLOG("EPD", "Too many widgets");
+			break;
+		}
+		g_widgets[g_widgets_num++] = entry->widget;
+	}
+	layout_caps = caps;
+	layout_valid = true;
+	MYLOG("EPD", "Layout for caps %04X has %d widgets", caps, g_widgets_num);
+}
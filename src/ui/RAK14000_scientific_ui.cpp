@@ -15,55 +15,68 @@
 
 #include "RAK14000_epd.h"
 
+/** Icon, unit and value format of a value widget */
+struct value_widget_s
+{
+	const unsigned char *img;
+	const char *unit;
+	uint16_t unit_w;
+	const char *row_format;
+	const char *column_format;
+};
+
+/**
+ * @brief Value widgets, icon, unit and value format
+ *        Index is the widget type - WIDGET_TEMP
+ *        The format with a trailing space is used for right aligned values
+ */
+static const value_widget_s value_widgets[] = {
+	{celsius_img, "~C", SMALL_TEXT_W("~C"), "%.2f", "%.2f "},
+	{humidity_img, "%RH", SMALL_TEXT_W("%RH"), "%.2f", "%.2f "},
+	{barometer_img, "mBar", SMALL_TEXT_W("mBar"), "%.2f", "%.1f "},
+	{brightness_img, "Lux", SMALL_TEXT_W("Lux"), "%.2f", "%.1f "},
+};
+
 void scientific_rak14000(void)
 {
 	uint8_t old_air_status = g_air_status;
 
 	g_air_status = 0;
 
-	bool has_baro = false;
-	if (has_rak1902 || has_rak1906)
-	{
-		has_baro = true;
-	}
-	bool has_light = false;
-	if (has_rak1903 || has_rak12010)
-	{
-		has_light = true;
-	}
-	if (has_rak12047)
-	{
-		voc_rak14000();
-	}
-	if (has_rak12037)
-	{
-		co2_rak14000(has_rak12039);
-	}
+	layout_rak14000(sensor_caps());
 
-	if (has_baro)
-	{
-		baro_rak14000(has_rak12039);
-		temp_rak14000(has_rak12039, has_baro);
-		humid_rak14000(has_rak12039, has_baro);
-	}
-	else
+	for (uint8_t idx = 0; idx < g_widgets_num; idx++)
 	{
-		if (has_light)
+		const widget_s &widget = g_widgets[idx];
+		switch (widget.type)
 		{
-			light_rak14000(has_rak12039);
-			temp_rak14000(has_rak12039, has_light);
-			humid_rak14000(has_rak12039, has_light);
-		}
-		else
-		{
-			temp_rak14000(has_rak12039, false);
-			humid_rak14000(has_rak12039, false);
+		case WIDGET_DIVIDER:
+			if (g_draw_layer == LAYER_STATIC)
+			{
+				display.drawLine(widget.x, widget.y, widget.x + widget.w, widget.y + widget.h, (uint16_t)txt_color);
+			}
+			break;
+		case WIDGET_VOC_GRAPH:
+			voc_rak14000(widget);
+			break;
+		case WIDGET_CO2_GRAPH:
+		case WIDGET_CO2_VALUE:
+			co2_rak14000(widget);
+			break;
+		case WIDGET_PM:
+			pm_rak14000(widget);
+			break;
+		default:
+			value_rak14000(widget);
+			break;
 		}
 	}
 
-	if (has_rak12039)
+	if (g_draw_layer == LAYER_STATIC)
 	{
-		pm_rak14000();
+		// No values in the static layer, keep the air status
+		g_air_status = old_air_status;
+		return;
 	}
 
 	if (old_air_status != g_air_status)
@@ -94,7 +107,7 @@ void scientific_rak14000(void)
 			snprintf(disp_text, 59, "RAK10702 Indoor Comfort %s %d %d %02d:%02d Batt: %.2f V",
 					 months_txt[g_date_time.month - 1], g_date_time.date, g_date_time.year,
 					 g_date_time.hour, g_date_time.minute,
-					 read_batt() / 1000.0);
+					 battery_mv() / 1000.0);
 		}
 		else
 		{
@@ -107,7 +120,7 @@ void scientific_rak14000(void)
 	{
 		if (g_is_using_battery)
 		{
-			snprintf(disp_text, 59, "RAK10702 Indoor Comfort Batt: %.2f V", read_batt() / 1000.0);
+			snprintf(disp_text, 59, "RAK10702 Indoor Comfort Batt: %.2f V", battery_mv() / 1000.0);
 		}
 		else
 		{
@@ -115,63 +128,75 @@ void scientific_rak14000(void)
 		}
 	}
 
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+	txt_w = text_width_rak14000(SMALL_FONT, disp_text);
 	text_rak14000((display_width / 2) - (txt_w / 2), 290, disp_text, (uint16_t)txt_color, 1);
+}
+
+/**
+ * @brief Draw the axis of a graph and mark the graph time base next to it
+ *        Nothing is shown for the default per sample graph
+ *
+ * @param widget graph widget
+ */
+void graph_axis_rak14000(const widget_s &widget)
+{
+	int16_t axis_x = widget.x + widget.w + 10;
+	int16_t bottom = widget.y + widget.h;
+
+	display.drawLine(axis_x, bottom, axis_x, widget.y, (uint16_t)txt_color);
+	display.drawLine(axis_x - 5, bottom, axis_x, bottom, (uint16_t)txt_color);
+	display.drawLine(axis_x - 5, widget.y, axis_x, widget.y, (uint16_t)txt_color);
+	display.drawLine(widget.x, bottom, widget.x + widget.w, bottom, (uint16_t)txt_color);
 
-	if (has_rak12039)
+	if (g_graph_tier == TIER_HOUR)
 	{
-		pm_rak14000();
-		// Vertical divider
-		display.drawLine(display_width / 2 + 50, 0, display_width / 2 + 50, display_height - 13, (uint16_t)txt_color);
-		// Horizontal dividers
-		display.drawLine(0, (display_height / 2 + 3) - 10, display_width / 2 + 50, (display_height / 2 + 3) - 10, (uint16_t)txt_color);
-		display.drawLine(display_width / 2 + 50, (display_height / 5) - 10, display_width, (display_height / 5) - 10, (uint16_t)txt_color);
+		text_rak14000(axis_x + 5, widget.y + (widget.h / 2) - 7, (char *)"1h", txt_color, 1);
 	}
-	else
+	else if (g_graph_tier == TIER_DAY)
 	{
-		// Vertical divider
-		display.drawLine(display_width / 2 + 50, 0, display_width / 2 + 50, display_height - 13, (uint16_t)txt_color);
-		// Horizontal dividers
-		display.drawLine(display_width / 2 + 50, (display_height / 3) - 10, display_width, (display_height / 3) - 10, (uint16_t)txt_color);
-		display.drawLine(display_width / 2 + 50, (display_height / 3 * 2) - 10, display_width, (display_height / 3 * 2) - 10, (uint16_t)txt_color);
+		text_rak14000(axis_x + 5, widget.y + (widget.h / 2) - 7, (char *)"1d", txt_color, 1);
 	}
 }
 
 /**
  * @brief Update display for VOC values
  *
+ * @param widget VOC graph widget
  */
-void voc_rak14000(void)
+void voc_rak14000(const widget_s &widget)
 {
-	x_text = 2;
-	y_text = 1;
-	s_text = 2;
-	x_graph = 0;
-	y_graph = 50;
-	h_bar = display_height / 2 - 60;
-	w_bar = 2;
-	bar_divider = 500.0 / h_bar;
+	int16_t bottom = widget.y + widget.h;
+	float bar_divider = 500.0 / widget.h;
 
-	// Write value
-	display.drawBitmap(x_text, y_text, voc_img, 32, 32, txt_color);
+	if (g_draw_layer == LAYER_STATIC)
+	{
+		display.drawBitmap(widget.icon_x, widget.icon_y, voc_img, 32, 32, txt_color);
+
+		text_rak14000(widget.x + widget.w + 15, bottom - 7, (char *)"0", txt_color, 1);
+		text_rak14000(widget.x + widget.w + 15, widget.y - 7, (char *)"500", txt_color, 1);
 
+		graph_axis_rak14000(widget);
+		return;
+	}
+
+	// Write value
 	if (!g_voc_valid)
 	{
 		snprintf(disp_text, 29, "VOC na");
 	}
 	else
 	{
-		if (voc_values[voc_idx - 1] > 400)
+		if (voc_values.latest() > 400)
 		{
-			snprintf(disp_text, 29, " !!  VOC %d", voc_values[voc_idx - 1]);
+			snprintf(disp_text, 29, " !!  VOC %.0f", voc_values.latest());
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (voc_values[voc_idx - 1] > 250)
+		else if (voc_values.latest() > 250)
 		{
-			snprintf(disp_text, 29, " !  VOC %d", voc_values[voc_idx - 1]);
+			snprintf(disp_text, 29, " !  VOC %.0f", voc_values.latest());
 			if (g_air_status < 128)
 			{
 				g_air_status = 128;
@@ -179,68 +204,53 @@ void voc_rak14000(void)
 		}
 		else
 		{
-			snprintf(disp_text, 29, "VOC %d", voc_values[voc_idx - 1]);
+			snprintf(disp_text, 29, "VOC %.0f", voc_values.latest());
 		}
 	}
-	text_rak14000(x_text + 40, y_text + 20, disp_text, txt_color, s_text);
+	text_rak14000(widget.icon_x + 40, widget.icon_y + 20, disp_text, txt_color, 2);
 
-	text_rak14000(display_width / 2 + 15, y_graph + h_bar - 7, (char *)"0", txt_color, 1);
-	text_rak14000(display_width / 2 + 15, y_graph - 7, (char *)"500", txt_color, 1);
-
-	display.drawLine(display_width / 2 + 10, y_graph + h_bar, display_width / 2 + 10, y_graph, (uint16_t)txt_color);
-	display.drawLine(display_width / 2 + 5, y_graph + h_bar, display_width / 2 + 10, y_graph + h_bar, (uint16_t)txt_color);
-	display.drawLine(display_width / 2 + 5, y_graph, display_width / 2 + 10, y_graph, (uint16_t)txt_color);
-
-	// Draw VOC values
-	for (int idx = 0; idx < num_values; idx++)
+	// Draw VOC values of the selected time base, oldest to newest
+	int16_t bar_tops[num_values];
+	uint16_t idx = 0;
+	for (float voc_value : voc_values.series(g_graph_tier))
 	{
-		display.drawLine((int16_t)(x_graph + (idx * w_bar)),
-						 (int16_t)(y_graph + ((h_bar) - (voc_values[idx] / bar_divider))),
-						 (int16_t)(x_graph + (idx * w_bar)),
-						 (int16_t)(y_graph + h_bar),
-						 txt_color);
+		bar_tops[idx] = (int16_t)(widget.y + (widget.h - (voc_value / bar_divider)));
+		idx++;
 	}
-	display.drawLine(x_graph, y_graph + h_bar, x_graph + display_width / 2, y_graph + h_bar, (uint16_t)txt_color);
+	display.draw_bars(widget.x, GRAPH_BAR_STEP, bottom, bar_tops, idx, txt_color);
 }
 
 /**
  * @brief Update display for CO2 values
  *
- * @param has_pm changes display type and position if
- * 			PM sensor is connected
- * @endif
- *
+ * @param widget WIDGET_CO2_VALUE shows only the value
+ * 			WIDGET_CO2_GRAPH shows the value and the graph
  */
-void co2_rak14000(bool has_pm)
+void co2_rak14000(const widget_s &widget)
 {
-	if (has_pm)
+	if (widget.type == WIDGET_CO2_VALUE)
 	{
-		x_text = display_width / 2 + 53;
-		y_text = 5;
-		s_text = 2;
-		spacer = 20;
+		txt_w = SMALL_TEXT_W("ppm");
 
-		// Write value
-		display.drawBitmap(x_text, y_text, co2_img, 32, 32, txt_color);
-
-		snprintf(disp_text, 29, "ppm");
-		display.setFont(SMALL_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-
-		text_rak14000(display_width - txt_w - 1, y_text + spacer + 4, disp_text, (uint16_t)txt_color, 1);
+		if (g_draw_layer == LAYER_STATIC)
+		{
+			display.drawBitmap(widget.icon_x, widget.icon_y, co2_img, 32, 32, txt_color);
+			text_rak14000(widget.x - txt_w, widget.y + 4, (char *)"ppm", (uint16_t)txt_color, 1);
+			return;
+		}
 
-		if (co2_values[co2_idx - 1] > 1500)
+		// Write value
+		if (co2_values.latest() > 1500)
 		{
-			snprintf(disp_text, 29, "!! %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "!! %.0f", co2_values.latest());
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (co2_values[co2_idx - 1] > 1000)
+		else if (co2_values.latest() > 1000)
 		{
-			snprintf(disp_text, 29, "! %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "! %.0f", co2_values.latest());
 			if (g_air_status < 128)
 			{
 				g_air_status = 128;
@@ -248,39 +258,36 @@ void co2_rak14000(bool has_pm)
 		}
 		else
 		{
-			snprintf(disp_text, 29, "%.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "%.0f", co2_values.latest());
 		}
 
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w2, &txt_h);
+		txt_w2 = text_width_rak14000(LARGE_FONT, disp_text);
 
-		text_rak14000(display_width - txt_w - txt_w2 - 4, y_text + spacer, disp_text, (uint16_t)txt_color, s_text);
+		text_rak14000(widget.x - txt_w - txt_w2 - 3, widget.y, disp_text, (uint16_t)txt_color, 2);
 	}
 	else
 	{
-		x_text = 2;
-		y_text = (display_height / 2) - 10;
-		s_text = 2;
-		x_graph = 0;
-		y_graph = display_height / 2 + 40;
-		h_bar = display_height / 2 - 62;
-		w_bar = 2;
-		bar_divider = 2500 / h_bar;
+		int16_t bottom = widget.y + widget.h;
+
+		if (g_draw_layer == LAYER_STATIC)
+		{
+			display.drawBitmap(widget.icon_x, widget.icon_y, co2_img, 32, 32, txt_color);
+
+			text_rak14000(widget.x + widget.w + 15, bottom - 17, (char *)"200", txt_color, 1);
+			text_rak14000(widget.x + widget.w + 15, bottom - 7, (char *)"ppm", txt_color, 1);
+			text_rak14000(widget.x + widget.w + 15, widget.y + 3, (char *)"ppm", txt_color, 1);
+
+			graph_axis_rak14000(widget);
+			return;
+		}
 
 		// Get min and max values => maybe adjust graph to the min and max values
 		int fmin = 2500;
 		int fmax = 0;
-		for (int idx = 0; idx < co2_idx; idx++)
+		if (!co2_values.series(g_graph_tier).empty())
 		{
-			if (co2_values[idx] <= fmin)
-			{
-				fmin = co2_values[idx];
-			}
-			if (co2_values[idx] >= fmax)
-			{
-				fmax = co2_values[idx];
-			}
+			fmin = co2_values.min_value(g_graph_tier);
+			fmax = co2_values.max_value(g_graph_tier);
 		}
 		// give some margin at the top
 		fmax += 50;
@@ -292,24 +299,22 @@ void co2_rak14000(bool has_pm)
 		}
 		// make it an even number
 		fmax = ((fmax / 100) + 1) * 100;
-		bar_divider = fmax / h_bar;
+		float bar_divider = fmax / widget.h;
 
 		MYLOG("EPD", "CO2 min %d max %d", fmin, fmax);
 
 		// Write value
-		display.drawBitmap(x_text, y_text, co2_img, 32, 32, txt_color);
-
-		if (co2_values[co2_idx - 1] > 1500)
+		if (co2_values.latest() > 1500)
 		{
-			snprintf(disp_text, 29, "!!  %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "!!  %.0f", co2_values.latest());
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (co2_values[co2_idx - 1] > 1000)
+		else if (co2_values.latest() > 1000)
 		{
-			snprintf(disp_text, 29, "!  %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "!  %.0f", co2_values.latest());
 			if (g_air_status < 128)
 			{
 				g_air_status = 128;
@@ -317,59 +322,67 @@ void co2_rak14000(bool has_pm)
 		}
 		else
 		{
-			snprintf(disp_text, 29, "%.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "%.0f", co2_values.latest());
 		}
-		text_rak14000(x_text + 40, y_text + 20, disp_text, txt_color, s_text);
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w2, &txt_h);
+		text_rak14000(widget.icon_x + 40, widget.icon_y + 20, disp_text, txt_color, 2);
+		txt_w2 = text_width_rak14000(LARGE_FONT, disp_text);
 
-		text_rak14000(x_text + 40 + txt_w2 + 3, y_text + 24, (char *)"ppm", txt_color, 1);
+		text_rak14000(widget.icon_x + 40 + txt_w2 + 3, widget.icon_y + 24, (char *)"ppm", txt_color, 1);
 
 		sprintf(disp_text, "%d", fmax);
-		text_rak14000(display_width / 2 + 15, y_graph + h_bar - 17, (char *)"200", txt_color, 1);
-		text_rak14000(display_width / 2 + 15, y_graph + h_bar - 7, (char *)"ppm", txt_color, 1);
-		// text_rak14000(display_width / 2 + 15, y_graph + h_bar - 7, (char *)"0ppm", txt_color, 1);
-		text_rak14000(display_width / 2 + 15, y_graph - 7, disp_text, txt_color, 1);
-		text_rak14000(display_width / 2 + 15, y_graph + 3, (char *)"ppm", txt_color, 1);
-
-		display.drawLine(display_width / 2 + 10, y_graph + h_bar, display_width / 2 + 10, y_graph, (uint16_t)txt_color);
-		display.drawLine(display_width / 2 + 5, y_graph + h_bar, display_width / 2 + 10, y_graph + h_bar, (uint16_t)txt_color);
-		display.drawLine(display_width / 2 + 5, y_graph, display_width / 2 + 10, y_graph, (uint16_t)txt_color);
-
-		// Draw CO2 values
-		for (int idx = 0; idx < num_values; idx++)
+		text_rak14000(widget.x + widget.w + 15, widget.y - 7, disp_text, txt_color, 1);
+
+		// Draw CO2 values of the selected time base, oldest to newest
+		int16_t bar_tops[num_values];
+		uint16_t idx = 0;
+		for (float co2_value : co2_values.series(g_graph_tier))
 		{
-			// if (co2_values[idx] != 0.0)
-			if (co2_values[idx] >= 200.0)
+			// Values below 200 ppm are not drawn
+			if (co2_value >= 200.0)
+			{
+				bar_tops[idx] = (int16_t)(widget.y + (widget.h - ((co2_value - 200) / bar_divider)));
+			}
+			else
 			{
-				display.drawLine((int16_t)(x_graph + (idx * w_bar)),
-								 //  (int16_t)(y_graph + ((h_bar) - (co2_values[idx] / bar_divider))),
-								 (int16_t)(y_graph + ((h_bar) - ((co2_values[idx] - 200) / bar_divider))),
-								 (int16_t)(x_graph + (idx * w_bar)),
-								 (int16_t)(y_graph + h_bar),
-								 txt_color);
+				bar_tops[idx] = INT16_MAX;
 			}
+			idx++;
 		}
-		display.drawLine(x_graph, y_graph + h_bar, x_graph + display_width / 2, y_graph + h_bar, (uint16_t)txt_color);
+		display.draw_bars(widget.x, GRAPH_BAR_STEP, bottom, bar_tops, idx, txt_color);
 	}
 }
 
 /**
  * @brief Update display with particle matter values
  *
+ * @param widget PM widget, x is the right end of the values,
+ *			y the first value row and h the distance of the rows
  */
-void pm_rak14000(void)
+void pm_rak14000(const widget_s &widget)
 {
-	x_text = display_width / 2 + 53;
-	y_text = (display_height / 4) - 10;
-	s_text = 2;
+	if (g_draw_layer == LAYER_STATIC)
+	{
+		display.drawBitmap(widget.icon_x, widget.icon_y, pm_img, 32, 32, txt_color);
+
+		snprintf(disp_text, 29, "1.0:");
+		text_rak14000(widget.icon_x, widget.y, disp_text, txt_color, 2);
+		snprintf(disp_text, 29, "2.5:");
+		text_rak14000(widget.icon_x, widget.y + widget.h, disp_text, txt_color, 2);
+		snprintf(disp_text, 29, "10:");
+		text_rak14000(widget.icon_x, widget.y + 2 * widget.h, disp_text, txt_color, 2);
+
+		snprintf(disp_text, 29, "%cg/m%c", 0x7F, 0x80);
+		text_rak14000(widget.x + 7, widget.y + 5, disp_text, txt_color, 1);
+		text_rak14000(widget.x + 7, widget.y + widget.h + 5, disp_text, txt_color, 1);
+		text_rak14000(widget.x + 7, widget.y + 2 * widget.h + 5, disp_text, txt_color, 1);
+		return;
+	}
 
 	// Write value
 	uint8_t pm_value_warning = 0;
 
 	// PM 1.0 levels
-	if (pm10_values[pm_idx - 1] > 75)
+	if (pm10_values.latest() > 75)
 	{
 		if (g_air_status < 255)
 		{
@@ -377,7 +390,7 @@ void pm_rak14000(void)
 		}
 		pm_value_warning = 255;
 	}
-	else if (pm10_values[pm_idx - 1] > 35)
+	else if (pm10_values.latest() > 35)
 	{
 		if (g_air_status < 128)
 		{
@@ -386,19 +399,12 @@ void pm_rak14000(void)
 		pm_value_warning = 128;
 	}
 
-	snprintf(disp_text, 29, "1.0:");
-	text_rak14000(x_text, y_text + 60, disp_text, txt_color, s_text);
-
-	snprintf(disp_text, 29, "%d", pm10_values[pm_idx - 1]);
-	display.setFont(LARGE_FONT);
-	display.setTextSize(1);
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-	text_rak14000(display_width - txt_w - 45, y_text + 60, disp_text, txt_color, s_text);
-	snprintf(disp_text, 29, "%cg/m%c", 0x7F, 0x80);
-	text_rak14000(display_width - 38, y_text + 65, disp_text, txt_color, 1);
+	snprintf(disp_text, 29, "%.0f", pm10_values.latest());
+	txt_w = text_width_rak14000(LARGE_FONT, disp_text);
+	text_rak14000(widget.x - txt_w, widget.y, disp_text, txt_color, 2);
 
 	// PM 2.5 levels
-	if (pm25_values[pm_idx - 1] > 75)
+	if (pm25_values.latest() > 75)
 	{
 		if (g_air_status < 255)
 		{
@@ -406,7 +412,7 @@ void pm_rak14000(void)
 		}
 		pm_value_warning = 255;
 	}
-	else if (pm25_values[pm_idx - 1] > 35)
+	else if (pm25_values.latest() > 35)
 	{
 		if (g_air_status < 128)
 		{
@@ -415,19 +421,12 @@ void pm_rak14000(void)
 		pm_value_warning = 255;
 	}
 
-	snprintf(disp_text, 29, "2.5:");
-	text_rak14000(x_text, y_text + 120, disp_text, txt_color, s_text);
-
-	snprintf(disp_text, 29, "%d", pm25_values[pm_idx - 1]);
-	display.setFont(LARGE_FONT);
-	display.setTextSize(1);
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-	text_rak14000(display_width - txt_w - 45, y_text + 120, disp_text, txt_color, s_text);
-	snprintf(disp_text, 29, "%cg/m%c", 0x7F, 0x80);
-	text_rak14000(display_width - 38, y_text + 125, disp_text, txt_color, 1);
+	snprintf(disp_text, 29, "%.0f", pm25_values.latest());
+	txt_w = text_width_rak14000(LARGE_FONT, disp_text);
+	text_rak14000(widget.x - txt_w, widget.y + widget.h, disp_text, txt_color, 2);
 
 	// PM 10 levels
-	if (pm100_values[pm_idx - 1] > 199)
+	if (pm100_values.latest() > 199)
 	{
 		if (g_air_status < 255)
 		{
@@ -435,7 +434,7 @@ void pm_rak14000(void)
 		}
 		pm_value_warning = 255;
 	}
-	else if (pm100_values[pm_idx - 1] > 150)
+	else if (pm100_values.latest() > 150)
 	{
 		if (g_air_status < 128)
 		{
@@ -444,18 +443,9 @@ void pm_rak14000(void)
 		pm_value_warning = 128;
 	}
 
-	snprintf(disp_text, 29, "10:");
-	text_rak14000(x_text, y_text + 180, disp_text, txt_color, s_text);
-
-	snprintf(disp_text, 29, "%d", pm100_values[pm_idx - 1]);
-	display.setFont(LARGE_FONT);
-	display.setTextSize(1);
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-	text_rak14000(display_width - txt_w - 45, y_text + 180, disp_text, txt_color, s_text);
-	snprintf(disp_text, 29, "%cg/m%c", 0x7F, 0x80);
-	text_rak14000(display_width - 38, y_text + 185, disp_text, txt_color, 1);
-
-	display.drawBitmap(x_text, y_text, pm_img, 32, 32, txt_color);
+	snprintf(disp_text, 29, "%.0f", pm100_values.latest());
+	txt_w = text_width_rak14000(LARGE_FONT, disp_text);
+	text_rak14000(widget.x - txt_w, widget.y + 2 * widget.h, disp_text, txt_color, 2);
 
 	if (pm_value_warning == 255)
 	{
@@ -469,247 +459,61 @@ void pm_rak14000(void)
 	{
 		snprintf(disp_text, 29, "PM");
 	}
-	text_rak14000(x_text + 40, y_text + 20, disp_text, txt_color, s_text);
+	text_rak14000(widget.icon_x + 40, widget.icon_y + 20, disp_text, txt_color, 2);
 }
 
 /**
- * @brief Update display for temperature values
+ * @brief Update display for temperature, humidity, barometric pressure or light
  *
- * @param has_pm changes display type and position if
- * 			PM sensor is connected
- * @param has_baro changes display position if
- * 			barometric pressure sensor is connected
+ * @param widget value widget
+ * 			STYLE_ROW: value at x/y, unit behind the value
+ * 			STYLE_COLUMN: unit right aligned at x, value before the unit
  */
-void temp_rak14000(bool has_pm, bool has_baro)
+void value_rak14000(const widget_s &widget)
 {
-	x_text = 25;
-	if (has_baro)
-	{
-		y_text = display_height / 2;
-	}
-	else
-	{
-		y_text = display_height / 4 + 95;
-	}
-	s_text = 2;
-	spacer = 60;
+	const value_widget_s *value_widget = &value_widgets[widget.type - WIDGET_TEMP];
 
-	// If PM sensor is not available, position is different
-	if (!has_pm)
+	if (g_draw_layer == LAYER_STATIC)
 	{
-		x_text = display_width / 2 + 53;
-		y_text = 12;
-		s_text = 2;
-		spacer = 50;
-
-		// Write value
-		display.drawBitmap(display_width - (display_width / 4 - 16), y_text, celsius_img, 32, 32, txt_color);
-
-		snprintf(disp_text, 29, "~C");
-		display.setFont(SMALL_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-
-		text_rak14000(display_width - txt_w - 3, y_text + spacer + 4, disp_text, (uint16_t)txt_color, 1);
-
-		snprintf(disp_text, 29, "%.2f ", temp_values[temp_idx - 1]);
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w2, &txt_h);
-
-		text_rak14000(display_width - txt_w - txt_w2 - 6, y_text + spacer, disp_text, (uint16_t)txt_color, s_text);
-	}
-	else
-	{
-		// Write value
-		display.drawBitmap(x_text, y_text, celsius_img, 32, 32, txt_color);
-
-		snprintf(disp_text, 29, "%.2f", temp_values[temp_idx - 1]);
-
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-
-		text_rak14000(x_text + spacer, y_text + 16, disp_text, (uint16_t)txt_color, s_text);
-
-		snprintf(disp_text, 29, "~C");
-		text_rak14000(x_text + spacer + txt_w + 4, y_text + 16 + 4, disp_text, (uint16_t)txt_color, 1);
-	}
-}
-
-/**
- * @brief Update display for humidity values
- *
- * @param has_pm changes display type and position if
- * 			PM sensor is connected
- * @param has_baro changes display position if
- * 			barometric pressure sensor is connected
- */
-void humid_rak14000(bool has_pm, bool has_baro)
-{
-	x_text = 25;
-	if (has_baro)
-	{
-		y_text = display_height / 2 + (display_height / 2 / 3);
-	}
-	else
-	{
-		y_text = (display_height / 4) + 155;
-	}
-	s_text = 2;
-	spacer = 60;
-
-	// If PM sensor is not available, position is different
-	if (!has_pm)
-	{
-		x_text = display_width / 2 + 53;
-		y_text = display_height / 3 + 15;
-		s_text = 2;
-		spacer = 50;
-
-		// Write value
-		display.drawBitmap(display_width - (display_width / 4 - 16), y_text, humidity_img, 32, 32, txt_color);
-
-		snprintf(disp_text, 29, "%%RH");
-		display.setFont(SMALL_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-
-		text_rak14000(display_width - txt_w - 3, y_text + spacer + 4, disp_text, (uint16_t)txt_color, 1);
-
-		snprintf(disp_text, 29, "%.2f ", humid_values[humid_idx - 1]);
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w2, &txt_h);
-
-		text_rak14000(display_width - txt_w - txt_w2 - 6, y_text + spacer, disp_text, (uint16_t)txt_color, s_text);
-	}
-	else
-	{
-		// Write value
-		display.drawBitmap(x_text, y_text, humidity_img, 32, 32, txt_color);
-
-		snprintf(disp_text, 29, "%.2f", humid_values[humid_idx - 1]);
-
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-
-		text_rak14000(x_text + spacer, y_text + 16, disp_text, (uint16_t)txt_color, s_text);
-
-		snprintf(disp_text, 29, "%%RH");
-		text_rak14000(x_text + spacer + txt_w + 4, y_text + 16 + 4, disp_text, (uint16_t)txt_color, 1);
+		display.drawBitmap(widget.icon_x, widget.icon_y, value_widget->img, 32, 32, txt_color);
+		if (widget.style == STYLE_COLUMN)
+		{
+			text_rak14000(widget.x - value_widget->unit_w, widget.y + 4, (char *)value_widget->unit, (uint16_t)txt_color, 1);
+		}
+		return;
 	}
-}
-
-/**
- * @brief Update display for barometric pressure
- *
- * @param has_pm changes display type and position if
- * 			PM sensor is connected
- */
-void baro_rak14000(bool has_pm)
-{
-	x_text = 25;
-	y_text = display_height / 2 + (display_height / 2 / 3 * 2);
-	s_text = 2;
-	spacer = 60;
 
-	// If PM sensor is not available, position is different
-	if (!has_pm)
+	float value;
+	switch (widget.type)
 	{
-		x_text = display_width / 2 + 53;
-		y_text = display_height / 3 * 2 + 15;
-		s_text = 2;
-		spacer = 50;
-
-		// Write value
-		display.drawBitmap(display_width - (display_width / 4 - 16), y_text, barometer_img, 32, 32, txt_color);
-
-		snprintf(disp_text, 29, "mBar");
-		display.setFont(SMALL_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-
-		text_rak14000(display_width - txt_w - 3, y_text + spacer + 4, disp_text, (uint16_t)txt_color, 1);
-
-		snprintf(disp_text, 29, "%.1f ", baro_values[baro_idx - 1]);
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w2, &txt_h);
-
-		text_rak14000(display_width - txt_w - txt_w2 - 6, y_text + spacer, disp_text, (uint16_t)txt_color, s_text);
-	}
-	else
-	{
-		// Write value
-		display.drawBitmap(x_text, y_text, barometer_img, 32, 32, txt_color);
-
-		snprintf(disp_text, 29, "%.2f", baro_values[baro_idx - 1]);
-
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-
-		text_rak14000(x_text + spacer, y_text + 16, disp_text, (uint16_t)txt_color, s_text);
-
-		snprintf(disp_text, 29, "mBar");
-		text_rak14000(x_text + spacer + txt_w + 4, y_text + 16 + 4, disp_text, (uint16_t)txt_color, 1);
+	case WIDGET_TEMP:
+		value = temp_values.latest();
+		break;
+	case WIDGET_HUMID:
+		value = humid_values.latest();
+		break;
+	case WIDGET_BARO:
+		value = baro_values.latest();
+		break;
+	default:
+		value = g_last_light_lux;
+		break;
 	}
-}
-
-/**
- * @brief Update display for light
- *
- * @param has_pm changes display type and position if
- * 			PM sensor is connected
- */
-void light_rak14000(bool has_pm)
-{
-	x_text = 25;
-	y_text = display_height / 2 + (display_height / 2 / 3 * 2);
-	s_text = 2;
-	spacer = 60;
 
-	// If PM sensor is not available, position is different
-	if (!has_pm)
+	// Write value
+	if (widget.style == STYLE_COLUMN)
 	{
-		x_text = display_width / 2 + 53;
-		y_text = display_height / 3 * 2 + 15;
-		s_text = 2;
-		spacer = 50;
+		snprintf(disp_text, 29, value_widget->column_format, value);
+		txt_w2 = text_width_rak14000(LARGE_FONT, disp_text);
 
-		// Write value
-		display.drawBitmap(display_width - (display_width / 4 - 16), y_text, brightness_img, 32, 32, txt_color);
-
-		snprintf(disp_text, 29, "Lux");
-		display.setFont(SMALL_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-
-		text_rak14000(display_width - txt_w - 3, y_text + spacer + 4, disp_text, (uint16_t)txt_color, 1);
-
-		snprintf(disp_text, 29, "%.1f ", g_last_light_lux);
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w2, &txt_h);
-
-		text_rak14000(display_width - txt_w - txt_w2 - 6, y_text + spacer, disp_text, (uint16_t)txt_color, s_text);
+		text_rak14000(widget.x - value_widget->unit_w - txt_w2 - 3, widget.y, disp_text, (uint16_t)txt_color, 2);
 	}
 	else
 	{
-		// Write value
-		display.drawBitmap(x_text, y_text, brightness_img, 32, 32, txt_color);
-
-		snprintf(disp_text, 29, "%.2f", g_last_light_lux);
-
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-
-		text_rak14000(x_text + spacer, y_text + 16, disp_text, (uint16_t)txt_color, s_text);
+		snprintf(disp_text, 29, value_widget->row_format, value);
+		txt_w = text_width_rak14000(LARGE_FONT, disp_text);
 
-		snprintf(disp_text, 29, "Lux");
-		text_rak14000(x_text + spacer + txt_w + 4, y_text + 16 + 4, disp_text, (uint16_t)txt_color, 1);
+		text_rak14000(widget.x, widget.y, disp_text, (uint16_t)txt_color, 2);
+		text_rak14000(widget.x + txt_w + 4, widget.y + 4, (char *)value_widget->unit, (uint16_t)txt_color, 1);
 	}
 }
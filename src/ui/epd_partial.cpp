@@ -0,0 +1,567 @@
+/**
+ * @file epd_partial.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief SSD1681/SSD1683 driver with partial refresh
+ * @version 0.1
+ * @date 2024-03-15
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "main.h"
+#include "epd_partial.h"
+
+// SSD1681 commands used for the partial refresh
+#define EPD_CMD_ACTIVATE 0x20
+#define EPD_CMD_UPDATE_CTRL1 0x21
+#define EPD_CMD_UPDATE_CTRL2 0x22
+#define EPD_CMD_RAM_Y_WINDOW 0x45
+
+// Display RAM, new image and old image for the partial refresh
+#define EPD_RAM_NEW 0
+#define EPD_RAM_OLD 1
+
+PartialEPD::PartialEPD(int width, int height, int16_t SID, int16_t SCLK, int16_t DC, int16_t RST,
+					   int16_t CS, int16_t SRCS, int16_t MISO, int16_t BUSY)
+	: Adafruit_SSD1681(width, height, SID, SCLK, DC, RST, CS, SRCS, MISO, BUSY)
+{
+}
+
+/**
+ * @brief Send the display buffer to the display
+ *        Only changed lines are sent with a partial refresh, if nothing
+ *        changed the display is not touched at all.
+ *        The display update is started, but not waited for. If the
+ *        previous update is still running, it is waited for first.
+ *        The display is only reset and initialized if it was powered down.
+ *
+ * @param force_full if true, a full refresh is done
+ * @return true if the display was updated
+ * @return false if the frame did not change
+ */
+bool PartialEPD::refresh(bool force_full)
+{
+	time_t start = millis();
+
+	finish_update();
+
+	if (_shown == NULL)
+	{
+		_shown = (uint8_t *)malloc(buffer1_size);
+	}
+
+	band_s bands[EPD_BANDS_MAX];
+	uint16_t num_bands = 0;
+	uint16_t changed_lines = 0;
+
+	if (!force_full && _shown_valid)
+	{
+		// Exact compare with the shown frame, stops at the first difference of each line
+		num_bands = find_bands(bands);
+		if (num_bands == 0)
+		{
+			skip_count++;
+			total_blocked += millis() - start;
+			MYLOG("EPD", "Same frame, skip refresh");
+			return false;
+		}
+		for (uint16_t idx = 0; idx < num_bands; idx++)
+		{
+			changed_lines += bands[idx].last - bands[idx].first + 1;
+		}
+	}
+
+	// Partial refresh of most of the display leaves too much ghosting
+	bool full = force_full || !_shown_valid || (_partials >= EPD_FULL_REFRESH_CYCLE) || (changed_lines > WIDTH / 2);
+
+	// Reset and init only after a power down, between updates the controller keeps its settings
+	if (!_powered)
+	{
+		powerUp();
+		_powered = true;
+	}
+	last_bytes = 0;
+	if (full)
+	{
+		last_bytes += write_lines(EPD_RAM_NEW, 0, WIDTH - 1, buffer1);
+		last_bytes += write_lines(EPD_RAM_OLD, 0, WIDTH - 1, buffer1);
+		start_update(false);
+		_old_num = 0;
+		_partials = 0;
+		full_count++;
+	}
+	else
+	{
+		for (uint16_t idx = 0; idx < num_bands; idx++)
+		{
+			last_bytes += write_lines(EPD_RAM_NEW, bands[idx].first, bands[idx].last, buffer1);
+		}
+		start_update(true);
+		// Old image RAM is written when the update is finished
+		memcpy(_old_bands, bands, num_bands * sizeof(band_s));
+		_old_num = num_bands;
+		_partials++;
+		partial_count++;
+	}
+
+	if (_shown != NULL)
+	{
+		memcpy(_shown, buffer1, buffer1_size);
+		_shown_valid = true;
+	}
+
+	last_time = millis() - start;
+	total_bytes += last_bytes;
+	total_blocked += last_time;
+	MYLOG("EPD", "%s refresh, %d lines, %ld bytes in %ld ms", full ? "Full" : "Partial",
+		  full ? WIDTH : changed_lines, last_bytes, last_time);
+	return true;
+}
+
+/**
+ * @brief Check if the display is still updating
+ *
+ * @return true if the display update is running
+ * @return false if the display is ready for the next refresh
+ */
+bool PartialEPD::update_busy(void)
+{
+	if (!_updating || (_busy_pin < 0))
+	{
+		return false;
+	}
+	return digitalRead(_busy_pin) == HIGH;
+}
+
+/**
+ * @brief Remember the end of the display update
+ *        Called from the BUSY pin interrupt
+ *
+ * @return true if a display update was running
+ * @return false if the BUSY pin changed for other commands
+ */
+bool PartialEPD::update_done(void)
+{
+	if (!_updating)
+	{
+		return false;
+	}
+	if (_update_end == 0)
+	{
+		_update_end = millis();
+	}
+	return true;
+}
+
+/**
+ * @brief Wait until the display update is finished
+ *        Used before a reset or power down
+ *
+ */
+void PartialEPD::wait_update(void)
+{
+	time_t start = millis();
+	finish_update();
+	total_blocked += millis() - start;
+}
+
+/**
+ * @brief Put the display into deep sleep
+ *        Waits for a running update first. The next refresh resets and
+ *        initializes the display again.
+ *
+ */
+void PartialEPD::powerDown(void)
+{
+	wait_update();
+	Adafruit_SSD1681::powerDown();
+	_powered = false;
+}
+
+/**
+ * @brief Keep the display buffer as template
+ *
+ * @param key layout the template was drawn for
+ */
+void PartialEPD::store_template(uint32_t key)
+{
+	if (_template == NULL)
+	{
+		_template = (uint8_t *)malloc(buffer1_size);
+		if (_template == NULL)
+		{
+			return;
+		}
+	}
+	memcpy(_template, buffer1, buffer1_size);
+	_template_key = key;
+	_template_valid = true;
+}
+
+/**
+ * @brief Start a new frame from the template
+ *
+ * @param key layout of the new frame
+ * @return true if the template was copied into the display buffer
+ * @return false if there is no template for this layout
+ */
+bool PartialEPD::restore_template(uint32_t key)
+{
+	if (!_template_valid || (_template_key != key))
+	{
+		return false;
+	}
+	memcpy(buffer1, _template, buffer1_size);
+	return true;
+}
+
+/**
+ * @brief Read a pixel from the display buffer
+ *        Same position calculation as Adafruit_EPD::drawPixel()
+ *
+ * @param x x position, rotation is applied
+ * @param y y position, rotation is applied
+ * @return true if the pixel is black
+ * @return false if the pixel is white or outside of the display
+ */
+bool PartialEPD::get_pixel(int16_t x, int16_t y)
+{
+	if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()))
+	{
+		return false;
+	}
+
+	uint16_t full_height = HEIGHT;
+	if ((full_height % 8) != 0)
+	{
+		full_height += 8 - (full_height % 8);
+	}
+
+	int16_t swap;
+	switch (getRotation())
+	{
+	case 1:
+		swap = x;
+		x = WIDTH - y - 1;
+		y = swap;
+		break;
+	case 2:
+		x = WIDTH - x - 1;
+		y = full_height - y - 1;
+		break;
+	case 3:
+		swap = x;
+		x = y;
+		y = full_height - swap - 1;
+		break;
+	}
+
+	uint32_t addr = ((uint32_t)(WIDTH - 1 - x) * (uint32_t)full_height + y) / 8;
+	bool bit_set = (black_buffer[addr] & (1 << (7 - y % 8))) != 0;
+	return bit_set != blackInverted;
+}
+
+/**
+ * @brief Draw vertical bars of a bar graph
+ *        In landscape orientation a display row is one line of the display
+ *        buffer. A bar is one bit in consecutive lines, it is written by
+ *        stepping a pointer from line to line with the bit mask of the column.
+ *        Rotation is resolved once per bar, not for each pixel.
+ *
+ * @param x x position of the first bar
+ * @param step distance between the bars
+ * @param bottom bottom row of all bars
+ * @param tops top row of each bar, bars with top > bottom are not drawn
+ * @param count number of bars
+ * @param color bar color
+ */
+void PartialEPD::draw_bars(int16_t x, int16_t step, int16_t bottom, const int16_t *tops, uint16_t count, uint16_t color)
+{
+	uint8_t rotation = getRotation();
+	if ((rotation == 0) || (rotation == 2))
+	{
+		// Bars are lines of the display buffer, use the GFX functions
+		for (uint16_t idx = 0; idx < count; idx++)
+		{
+			if (tops[idx] <= bottom)
+			{
+				drawFastVLine(x + idx * step, tops[idx], bottom - tops[idx] + 1, color);
+			}
+		}
+		return;
+	}
+
+	uint16_t full_height = HEIGHT;
+	if ((full_height % 8) != 0)
+	{
+		full_height += 8 - (full_height % 8);
+	}
+	uint16_t line_bytes = full_height / 8;
+	bool set_bits = (color == EPD_BLACK) != blackInverted;
+
+	if (bottom >= height())
+	{
+		bottom = height() - 1;
+	}
+	// Rotation 1: line = row, bit = column. Rotation 3: both reversed
+	int32_t line_step = (rotation == 1) ? line_bytes : -(int32_t)line_bytes;
+
+	for (uint16_t idx = 0; idx < count; idx++)
+	{
+		int16_t column = x + idx * step;
+		if ((tops[idx] > bottom) || (column < 0) || (column >= width()))
+		{
+			continue;
+		}
+		int16_t top = tops[idx] < 0 ? 0 : tops[idx];
+		uint16_t pos = (rotation == 1) ? column : full_height - 1 - column;
+		uint8_t mask = 1 << (7 - (pos % 8));
+		uint8_t *data = black_buffer + (uint32_t)(rotation == 1 ? top : WIDTH - 1 - top) * line_bytes + pos / 8;
+
+		// One bit in each line of the bar
+		for (int16_t row = top; row <= bottom; row++, data += line_step)
+		{
+			*data = set_bits ? (*data | mask) : (*data & ~mask);
+		}
+	}
+}
+
+/**
+ * @brief Draw 8 pixels of a bitmap row, same result as drawBitmap()
+ *        In landscape orientation the 8 pixels are in one or two bytes
+ *        of a line of the display buffer and are written as byte masks.
+ *        Other orientations and pixels outside of the display are
+ *        drawn pixel by pixel.
+ *
+ * @param x x position of the leftmost pixel
+ * @param y y position
+ * @param bits pixels, MSB is the leftmost pixel
+ * @param color pixel color
+ */
+void PartialEPD::blit_byte(int16_t x, int16_t y, uint8_t bits, uint16_t color)
+{
+	uint8_t rotation = getRotation();
+	if (((rotation != 1) && (rotation != 3)) || (x < 0) || (x + 8 > width()) || (y < 0) || (y >= height()))
+	{
+		for (uint8_t bit = 0; bit < 8; bit++)
+		{
+			if (bits & (0x80 >> bit))
+			{
+				drawPixel(x + bit, y, color);
+			}
+		}
+		return;
+	}
+
+	uint16_t full_height = HEIGHT;
+	if ((full_height % 8) != 0)
+	{
+		full_height += 8 - (full_height % 8);
+	}
+	uint16_t line_bytes = full_height / 8;
+	bool set_bits = (color == EPD_BLACK) != blackInverted;
+
+	// Rotation 1: line = row, bit = column. Rotation 3: both reversed
+	uint8_t *line;
+	uint16_t pos;
+	if (rotation == 1)
+	{
+		line = black_buffer + (uint32_t)y * line_bytes;
+		pos = x;
+	}
+	else
+	{
+		line = black_buffer + (uint32_t)(WIDTH - 1 - y) * line_bytes;
+		pos = full_height - 8 - x;
+		bits = ((bits & 0xF0) >> 4) | ((bits & 0x0F) << 4);
+		bits = ((bits & 0xCC) >> 2) | ((bits & 0x33) << 2);
+		bits = ((bits & 0xAA) >> 1) | ((bits & 0x55) << 1);
+	}
+
+	uint8_t shift = pos % 8;
+	uint8_t mask = bits >> shift;
+	line[pos / 8] = set_bits ? (line[pos / 8] | mask) : (line[pos / 8] & ~mask);
+	if (shift != 0)
+	{
+		mask = bits << (8 - shift);
+		line[pos / 8 + 1] = set_bits ? (line[pos / 8 + 1] | mask) : (line[pos / 8 + 1] & ~mask);
+	}
+}
+
+/**
+ * @brief Draw a PackBits compressed bitmap, same result as drawBitmap()
+ *        with the uncompressed bitmap. The bitmap is decoded while drawing,
+ *        no buffer for the uncompressed bitmap is needed. Runs of empty
+ *        bytes are skipped without drawing.
+ *        Compressed bitmaps are created by compress_bitmaps.py
+ *
+ * @param x x position
+ * @param y y position
+ * @param packed compressed bitmap
+ * @param w width of the bitmap
+ * @param h height of the bitmap
+ * @param color pixel color
+ */
+void PartialEPD::draw_packed(int16_t x, int16_t y, const uint8_t *packed, int16_t w, int16_t h, uint16_t color)
+{
+	uint16_t byte_width = (w + 7) / 8;
+	uint32_t size = (uint32_t)byte_width * h;
+	// Pixels in the last byte of a row that are outside of the bitmap
+	uint8_t last_mask = (w % 8) != 0 ? (0xFF << (8 - (w % 8))) : 0xFF;
+	uint32_t pos = 0;
+
+	while (pos < size)
+	{
+		uint8_t header = *packed++;
+		if (header == 128)
+		{
+			continue;
+		}
+
+		bool repeat = header > 128;
+		uint16_t count = repeat ? 257 - header : header + 1;
+		if (repeat && (*packed == 0))
+		{
+			// Nothing to draw
+			pos += count;
+			packed++;
+			continue;
+		}
+
+		for (; (count > 0) && (pos < size); count--, pos++)
+		{
+			uint8_t bits = repeat ? *packed : *packed++;
+			uint16_t column = pos % byte_width;
+			if (column == byte_width - 1)
+			{
+				bits &= last_mask;
+			}
+			if (bits != 0)
+			{
+				blit_byte(x + column * 8, y + pos / byte_width, bits, color);
+			}
+		}
+		if (repeat)
+		{
+			packed++;
+		}
+	}
+}
+
+/**
+ * @brief Find the changed lines by comparing the display buffer with the shown frame
+ *
+ * @param bands array for EPD_BANDS_MAX changed areas
+ * @return uint16_t number of changed areas, 0 if nothing changed
+ */
+uint16_t PartialEPD::find_bands(band_s *bands)
+{
+	uint16_t line_bytes = buffer1_size / WIDTH;
+	uint16_t num_bands = 0;
+
+	for (uint16_t line = 0; line < WIDTH; line++)
+	{
+		uint32_t offset = (uint32_t)line * line_bytes;
+		if (memcmp(buffer1 + offset, _shown + offset, line_bytes) == 0)
+		{
+			continue;
+		}
+		if ((num_bands != 0) &&
+			((line - bands[num_bands - 1].last <= EPD_BAND_GAP) || (num_bands == EPD_BANDS_MAX)))
+		{
+			bands[num_bands - 1].last = line;
+		}
+		else
+		{
+			bands[num_bands].first = line;
+			bands[num_bands].last = line;
+			num_bands++;
+		}
+	}
+	return num_bands;
+}
+
+/**
+ * @brief Write lines of the display buffer into the display RAM
+ *
+ * @param ram EPD_RAM_NEW or EPD_RAM_OLD
+ * @param first first line
+ * @param last last line
+ * @param source frame buffer the lines are taken from
+ * @return uint32_t number of bytes sent
+ */
+uint32_t PartialEPD::write_lines(uint8_t ram, uint16_t first, uint16_t last, const uint8_t *source)
+{
+	uint16_t line_bytes = buffer1_size / WIDTH;
+	uint8_t buf[4];
+
+	buf[0] = first & 0xFF;
+	buf[1] = first >> 8;
+	buf[2] = last & 0xFF;
+	buf[3] = last >> 8;
+	EPD_command(EPD_CMD_RAM_Y_WINDOW, buf, 4);
+	setRAMAddress(0, first);
+
+	uint32_t len = (uint32_t)(last - first + 1) * line_bytes;
+	const uint8_t *data = source + (uint32_t)first * line_bytes;
+	writeRAMCommand(ram);
+	dcHigh();
+	for (uint32_t idx = 0; idx < len; idx++)
+	{
+		SPItransfer(data[idx]);
+	}
+	csHigh();
+	return len;
+}
+
+/**
+ * @brief Start the display update, does not wait until it is finished
+ *        Full refresh ignores the old image RAM, partial refresh
+ *        only changes the pixels that differ between old and new image
+ *
+ * @param partial true for the partial refresh waveform
+ */
+void PartialEPD::start_update(bool partial)
+{
+	uint8_t buf[2];
+
+	buf[0] = partial ? 0x00 : 0x40; // 0x40 = old image RAM is not used
+	buf[1] = 0x00;
+	EPD_command(EPD_CMD_UPDATE_CTRL1, buf, 2);
+	buf[0] = partial ? 0xFF : 0xF7; // 0xFF = display mode 2
+	EPD_command(EPD_CMD_UPDATE_CTRL2, buf, 1);
+	_update_end = 0;
+	_update_start = millis();
+	_updating = true;
+	EPD_command(EPD_CMD_ACTIVATE);
+}
+
+/**
+ * @brief Finish the display update
+ *        Waits if the display is still busy. After a partial update the
+ *        changed lines are written into the old image RAM, it must match
+ *        the shown image for the next partial refresh. The lines are taken
+ *        from the copy of the shown frame, the display buffer might
+ *        already have new content.
+ *
+ */
+void PartialEPD::finish_update(void)
+{
+	if (!_updating)
+	{
+		return;
+	}
+	busy_wait();
+	last_busy = (_update_end != 0 ? _update_end : millis()) - _update_start;
+	_updating = false;
+
+	uint32_t bytes = 0;
+	for (uint16_t idx = 0; idx < _old_num; idx++)
+	{
+		bytes += write_lines(EPD_RAM_OLD, _old_bands[idx].first, _old_bands[idx].last, _shown);
+	}
+	_old_num = 0;
+	last_bytes += bytes;
+	total_bytes += bytes;
+	MYLOG("EPD", "Update finished after %ld ms", last_busy);
+}
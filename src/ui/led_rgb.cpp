@@ -94,14 +94,14 @@ void set_rgb_air_status(void)
 		// Get VOC status
 		if (g_voc_valid)
 		{
-			if (voc_values[voc_idx - 1] > 400)
+			if (voc_values.latest() > 400)
 			{
 				if (g_air_status < 255)
 				{
 					g_air_status = 255;
 				}
 			}
-			else if (voc_values[voc_idx - 1] > 250)
+			else if (voc_values.latest() > 250)
 			{
 				if (g_air_status < 128)
 				{
@@ -113,14 +113,14 @@ void set_rgb_air_status(void)
 
 	if (has_rak12037)
 	{
-		if (co2_values[co2_idx - 1] > 1500)
+		if (co2_values.latest() > 1500)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (co2_values[co2_idx - 1] > 1000)
+		else if (co2_values.latest() > 1000)
 		{
 			if (g_air_status < 128)
 			{
@@ -131,14 +131,14 @@ void set_rgb_air_status(void)
 	if (has_rak12039)
 	{
 		// PM 1.0 levels
-		if (pm10_values[pm_idx - 1] > 75)
+		if (pm10_values.latest() > 75)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (pm10_values[pm_idx - 1] > 35)
+		else if (pm10_values.latest() > 35)
 		{
 			if (g_air_status < 128)
 			{
@@ -146,14 +146,14 @@ void set_rgb_air_status(void)
 			}
 		}
 		// PM 2.5 levels
-		if (pm25_values[pm_idx - 1] > 75)
+		if (pm25_values.latest() > 75)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (pm25_values[pm_idx - 1] > 35)
+		else if (pm25_values.latest() > 35)
 		{
 			if (g_air_status < 128)
 			{
@@ -161,14 +161,14 @@ void set_rgb_air_status(void)
 			}
 		}
 		// PM 10 levels
-		if (pm100_values[pm_idx - 1] > 199)
+		if (pm100_values.latest() > 199)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (pm100_values[pm_idx - 1] > 150)
+		else if (pm100_values.latest() > 150)
 		{
 			if (g_air_status < 128)
 			{
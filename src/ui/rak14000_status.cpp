@@ -31,7 +31,7 @@ void status_ui_rak14000(void)
 			snprintf(disp_text, 59, "RAK10702 Indoor Comfort %s %d %d %02d:%02d Batt: %.2f V",
 					 months_txt[g_date_time.month - 1], g_date_time.date, g_date_time.year,
 					 g_date_time.hour, g_date_time.minute,
-					 read_batt() / 1000.0);
+					 battery_mv() / 1000.0);
 		}
 		else
 		{
@@ -44,7 +44,7 @@ void status_ui_rak14000(void)
 	{
 		if (g_is_using_battery)
 		{
-			snprintf(disp_text, 59, "RAK10702 Indoor Comfort Batt: %.2f V", read_batt() / 1000.0);
+			snprintf(disp_text, 59, "RAK10702 Indoor Comfort Batt: %.2f V", battery_mv() / 1000.0);
 		}
 		else
 		{
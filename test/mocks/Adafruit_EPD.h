@@ -0,0 +1,211 @@
+/**
+ * @file Adafruit_EPD.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host replacement of the Adafruit EPD library for the native tests
+ *        The frame buffer has the same layout as the SSD1681 driver of the
+ *        library, nothing is sent. Bytes written to the display RAM and
+ *        the commands are counted.
+ * @version 0.1
+ * @date 2024-03-26
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _MOCK_ADAFRUIT_EPD_H_
+#define _MOCK_ADAFRUIT_EPD_H_
+#include <Adafruit_GFX.h>
+
+enum
+{
+	EPD_WHITE,
+	EPD_BLACK,
+	EPD_RED,
+	EPD_GRAY,
+	EPD_DARK,
+	EPD_LIGHT,
+	EPD_NUM_COLORS
+};
+
+/**
+ * @brief Black and white frame buffer of the EPD
+ *
+ */
+class Adafruit_EPD : public Adafruit_GFX
+{
+public:
+	Adafruit_EPD(int width, int height, int16_t SID, int16_t SCLK, int16_t DC, int16_t RST, int16_t CS, int16_t SRCS, int16_t MISO, int16_t BUSY = -1)
+		: Adafruit_GFX(width, height), _busy_pin(BUSY), _cs_pin(CS)
+	{
+		(void)SID;
+		(void)SCLK;
+		(void)DC;
+		(void)RST;
+		(void)SRCS;
+		(void)MISO;
+	}
+	virtual ~Adafruit_EPD() {}
+
+	void begin(bool reset = true) { (void)reset; }
+
+	/**
+	 * @brief Same address calculation as Adafruit_EPD::drawPixel()
+	 *
+	 */
+	void drawPixel(int16_t x, int16_t y, uint16_t color) override
+	{
+		if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()))
+		{
+			return;
+		}
+
+		int16_t swap;
+		switch (getRotation())
+		{
+		case 1:
+			swap = x;
+			x = WIDTH - y - 1;
+			y = swap;
+			break;
+		case 2:
+			x = WIDTH - x - 1;
+			y = _full_height - y - 1;
+			break;
+		case 3:
+			swap = x;
+			x = y;
+			y = _full_height - swap - 1;
+			break;
+		}
+
+		uint32_t addr = ((uint32_t)(WIDTH - 1 - x) * (uint32_t)_full_height + y) / 8;
+		bool black = color == EPD_BLACK;
+		if (black != blackInverted)
+		{
+			black_buffer[addr] |= 1 << (7 - y % 8);
+		}
+		else
+		{
+			black_buffer[addr] &= ~(1 << (7 - y % 8));
+		}
+	}
+
+	void clearBuffer(void) { memset(buffer1, blackInverted ? 0xFF : 0x00, buffer1_size); }
+	void display(bool sleep = false) { (void)sleep; }
+
+	virtual void powerUp(void) = 0;
+	virtual void update(void) = 0;
+	virtual void powerDown(void) = 0;
+
+	/** Number of bytes sent to the display */
+	uint32_t mock_data_bytes = 0;
+	/** Number of commands sent to the display */
+	uint32_t mock_commands = 0;
+	/** Number of powerUp() calls, hardware reset and init of the display */
+	uint32_t mock_power_ups = 0;
+
+protected:
+	virtual uint8_t writeRAMCommand(uint8_t index) = 0;
+	virtual void setRAMAddress(uint16_t x, uint16_t y) = 0;
+	virtual void busy_wait(void) = 0;
+
+	void EPD_command(uint8_t c, const uint8_t *buf, uint16_t len)
+	{
+		EPD_command(c);
+		EPD_data(buf, len);
+	}
+	uint8_t EPD_command(uint8_t c, bool end = true)
+	{
+		(void)c;
+		(void)end;
+		mock_commands++;
+		return 0;
+	}
+	void EPD_data(const uint8_t *buf, uint16_t len)
+	{
+		(void)buf;
+		mock_data_bytes += len;
+	}
+	void EPD_data(uint8_t data)
+	{
+		(void)data;
+		mock_data_bytes++;
+	}
+	uint8_t SPItransfer(uint8_t c)
+	{
+		mock_data_bytes++;
+		return c;
+	}
+	void csLow(void) {}
+	void csHigh(void) {}
+	void dcHigh(void) {}
+	void dcLow(void) {}
+	void hardwareReset(void) {}
+
+	int16_t _busy_pin;
+	int16_t _cs_pin;
+	uint8_t *buffer1 = NULL;
+	uint8_t *buffer2 = NULL;
+	uint32_t buffer1_size = 0;
+	uint32_t buffer2_size = 0;
+	uint8_t *black_buffer = NULL;
+	uint8_t *color_buffer = NULL;
+	bool blackInverted = true;
+	bool colorInverted = false;
+	/** Display height rounded up to full bytes */
+	uint16_t _full_height = 0;
+};
+
+/**
+ * @brief SSD1681 frame buffer, black only, 0 bits are black
+ *
+ */
+class Adafruit_SSD1681 : public Adafruit_EPD
+{
+public:
+	Adafruit_SSD1681(int width, int height, int16_t SID, int16_t SCLK, int16_t DC, int16_t RST, int16_t CS, int16_t SRCS, int16_t MISO, int16_t BUSY = -1)
+		: Adafruit_EPD(width, height, SID, SCLK, DC, RST, CS, SRCS, MISO, BUSY)
+	{
+		_full_height = height;
+		if ((_full_height % 8) != 0)
+		{
+			_full_height += 8 - (_full_height % 8);
+		}
+		buffer1_size = (uint32_t)width * _full_height / 8;
+		buffer2_size = buffer1_size;
+		buffer1 = (uint8_t *)malloc(buffer1_size);
+		buffer2 = (uint8_t *)malloc(buffer2_size);
+		black_buffer = buffer1;
+		color_buffer = buffer2;
+		memset(buffer1, 0xFF, buffer1_size);
+		memset(buffer2, 0x00, buffer2_size);
+	}
+	~Adafruit_SSD1681()
+	{
+		free(buffer1);
+		free(buffer2);
+	}
+
+	/** The driver resets the display and waits 100 ms */
+	void powerUp(void) override
+	{
+		mock_power_ups++;
+		hardwareReset();
+		delay(100);
+	}
+	void update(void) override {}
+	void powerDown(void) override {}
+
+protected:
+	uint8_t writeRAMCommand(uint8_t index) override
+	{
+		return EPD_command(index == 0 ? 0x24 : 0x26, false);
+	}
+	void setRAMAddress(uint16_t x, uint16_t y) override
+	{
+		(void)x;
+		(void)y;
+	}
+	void busy_wait(void) override {}
+};
+
+#endif // _MOCK_ADAFRUIT_EPD_H_
@@ -0,0 +1,365 @@
+/**
+ * @file Adafruit_GFX.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host replacement of the Adafruit GFX library for the native tests
+ *        Same drawing algorithms as the library for the functions the
+ *        application uses, so a frame rendered on the host matches the
+ *        frame rendered on the device pixel by pixel.
+ *        Only GFX fonts are supported, the built in 5x7 font is not used.
+ * @version 0.1
+ * @date 2024-03-26
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _MOCK_ADAFRUIT_GFX_H_
+#define _MOCK_ADAFRUIT_GFX_H_
+#include <Arduino.h>
+
+/** Glyph of a GFX font */
+typedef struct
+{
+	uint16_t bitmapOffset;
+	uint8_t width;
+	uint8_t height;
+	uint8_t xAdvance;
+	int8_t xOffset;
+	int8_t yOffset;
+} GFXglyph;
+
+/** GFX font */
+typedef struct
+{
+	uint8_t *bitmap;
+	GFXglyph *glyph;
+	uint16_t first;
+	uint16_t last;
+	uint8_t yAdvance;
+} GFXfont;
+
+/**
+ * @brief Graphics primitives, the display class provides drawPixel()
+ *
+ */
+class Adafruit_GFX : public Print
+{
+public:
+	Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+	virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+	void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { writeLine(x, y, x, y + h - 1, color); }
+	void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { writeLine(x, y, x + w - 1, y, color); }
+
+	void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+	{
+		if (x0 == x1)
+		{
+			if (y0 > y1)
+			{
+				swap(y0, y1);
+			}
+			drawFastVLine(x0, y0, y1 - y0 + 1, color);
+		}
+		else if (y0 == y1)
+		{
+			if (x0 > x1)
+			{
+				swap(x0, x1);
+			}
+			drawFastHLine(x0, y0, x1 - x0 + 1, color);
+		}
+		else
+		{
+			writeLine(x0, y0, x1, y1, color);
+		}
+	}
+
+	void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+	{
+		drawFastHLine(x, y, w, color);
+		drawFastHLine(x, y + h - 1, w, color);
+		drawFastVLine(x, y, h, color);
+		drawFastVLine(x + w - 1, y, h, color);
+	}
+
+	void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+	{
+		for (int16_t i = x; i < x + w; i++)
+		{
+			drawFastVLine(i, y, h, color);
+		}
+	}
+
+	void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+	{
+		int16_t f = 1 - r;
+		int16_t ddF_x = 1;
+		int16_t ddF_y = -2 * r;
+		int16_t x = 0;
+		int16_t y = r;
+
+		drawPixel(x0, y0 + r, color);
+		drawPixel(x0, y0 - r, color);
+		drawPixel(x0 + r, y0, color);
+		drawPixel(x0 - r, y0, color);
+
+		while (x < y)
+		{
+			if (f >= 0)
+			{
+				y--;
+				ddF_y += 2;
+				f += ddF_y;
+			}
+			x++;
+			ddF_x += 2;
+			f += ddF_x;
+
+			drawPixel(x0 + x, y0 + y, color);
+			drawPixel(x0 - x, y0 + y, color);
+			drawPixel(x0 + x, y0 - y, color);
+			drawPixel(x0 - x, y0 - y, color);
+			drawPixel(x0 + y, y0 + x, color);
+			drawPixel(x0 - y, y0 + x, color);
+			drawPixel(x0 + y, y0 - x, color);
+			drawPixel(x0 - y, y0 - x, color);
+		}
+	}
+
+	void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
+	{
+		int16_t byte_width = (w + 7) / 8;
+		uint8_t b = 0;
+
+		for (int16_t j = 0; j < h; j++, y++)
+		{
+			for (int16_t i = 0; i < w; i++)
+			{
+				if (i & 7)
+				{
+					b <<= 1;
+				}
+				else
+				{
+					b = bitmap[j * byte_width + i / 8];
+				}
+				if (b & 0x80)
+				{
+					drawPixel(x + i, y, color);
+				}
+			}
+		}
+	}
+
+	void setFont(const GFXfont *font)
+	{
+		if (font && !_font)
+		{
+			_cursor_y += 6;
+		}
+		else if (!font && _font)
+		{
+			_cursor_y -= 6;
+		}
+		_font = (GFXfont *)font;
+	}
+	void setCursor(int16_t x, int16_t y)
+	{
+		_cursor_x = x;
+		_cursor_y = y;
+	}
+	void setTextColor(uint16_t color) { _text_color = color; }
+	void setTextSize(uint8_t size) { _text_size = size > 0 ? size : 1; }
+	void setTextWrap(bool wrap) { _wrap = wrap; }
+	int16_t getCursorX(void) const { return _cursor_x; }
+	int16_t getCursorY(void) const { return _cursor_y; }
+
+	void setRotation(uint8_t rotation)
+	{
+		_rotation = rotation & 3;
+		_width = (_rotation & 1) ? HEIGHT : WIDTH;
+		_height = (_rotation & 1) ? WIDTH : HEIGHT;
+	}
+	uint8_t getRotation(void) const { return _rotation; }
+	int16_t width(void) const { return _width; }
+	int16_t height(void) const { return _height; }
+
+	/**
+	 * @brief Draw a character of the GFX font at the cursor
+	 *
+	 */
+	size_t write(uint8_t c) override
+	{
+		if (!_font)
+		{
+			return 1;
+		}
+		if (c == '\n')
+		{
+			_cursor_x = 0;
+			_cursor_y += (int16_t)_text_size * _font->yAdvance;
+		}
+		else if ((c != '\r') && (c >= _font->first) && (c <= _font->last))
+		{
+			GFXglyph *glyph = &_font->glyph[c - _font->first];
+			if ((glyph->width > 0) && (glyph->height > 0))
+			{
+				if (_wrap && ((_cursor_x + _text_size * (glyph->xOffset + glyph->width)) > _width))
+				{
+					_cursor_x = 0;
+					_cursor_y += (int16_t)_text_size * _font->yAdvance;
+				}
+				draw_char(_cursor_x, _cursor_y, glyph);
+			}
+			_cursor_x += glyph->xAdvance * (int16_t)_text_size;
+		}
+		return 1;
+	}
+
+	void getTextBounds(const char *text, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+	{
+		int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+
+		*x1 = x;
+		*y1 = y;
+		*w = 0;
+		*h = 0;
+		for (; _font && *text; text++)
+		{
+			uint8_t c = *text;
+			if (c == '\n')
+			{
+				x = 0;
+				y += _text_size * _font->yAdvance;
+			}
+			else if ((c != '\r') && (c >= _font->first) && (c <= _font->last))
+			{
+				GFXglyph *glyph = &_font->glyph[c - _font->first];
+				if (_wrap && ((x + ((int16_t)glyph->xOffset + glyph->width) * _text_size) > _width))
+				{
+					x = 0;
+					y += _text_size * _font->yAdvance;
+				}
+				int16_t gx1 = x + glyph->xOffset * _text_size;
+				int16_t gy1 = y + glyph->yOffset * _text_size;
+				int16_t gx2 = gx1 + glyph->width * _text_size - 1;
+				int16_t gy2 = gy1 + glyph->height * _text_size - 1;
+				minx = gx1 < minx ? gx1 : minx;
+				miny = gy1 < miny ? gy1 : miny;
+				maxx = gx2 > maxx ? gx2 : maxx;
+				maxy = gy2 > maxy ? gy2 : maxy;
+				x += glyph->xAdvance * _text_size;
+			}
+		}
+		if (maxx >= minx)
+		{
+			*x1 = minx;
+			*w = maxx - minx + 1;
+		}
+		if (maxy >= miny)
+		{
+			*y1 = miny;
+			*h = maxy - miny + 1;
+		}
+	}
+
+protected:
+	/** Display size without rotation */
+	int16_t WIDTH;
+	int16_t HEIGHT;
+	/** Display size with rotation */
+	int16_t _width;
+	int16_t _height;
+
+private:
+	static void swap(int16_t &a, int16_t &b)
+	{
+		int16_t t = a;
+		a = b;
+		b = t;
+	}
+
+	/**
+	 * @brief Bresenham line, same pixels as Adafruit_GFX::writeLine()
+	 *
+	 */
+	void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+	{
+		bool steep = abs(y1 - y0) > abs(x1 - x0);
+		if (steep)
+		{
+			swap(x0, y0);
+			swap(x1, y1);
+		}
+		if (x0 > x1)
+		{
+			swap(x0, x1);
+			swap(y0, y1);
+		}
+
+		int16_t dx = x1 - x0;
+		int16_t dy = abs(y1 - y0);
+		int16_t err = dx / 2;
+		int16_t ystep = (y0 < y1) ? 1 : -1;
+
+		for (; x0 <= x1; x0++)
+		{
+			if (steep)
+			{
+				drawPixel(y0, x0, color);
+			}
+			else
+			{
+				drawPixel(x0, y0, color);
+			}
+			err -= dy;
+			if (err < 0)
+			{
+				y0 += ystep;
+				err += dx;
+			}
+		}
+	}
+
+	void draw_char(int16_t x, int16_t y, const GFXglyph *glyph)
+	{
+		uint16_t offset = glyph->bitmapOffset;
+		uint8_t bits = 0;
+		uint8_t bit = 0;
+
+		for (uint8_t yy = 0; yy < glyph->height; yy++)
+		{
+			for (uint8_t xx = 0; xx < glyph->width; xx++)
+			{
+				if (!(bit++ & 7))
+				{
+					bits = _font->bitmap[offset++];
+				}
+				if (bits & 0x80)
+				{
+					if (_text_size == 1)
+					{
+						drawPixel(x + glyph->xOffset + xx, y + glyph->yOffset + yy, _text_color);
+					}
+					else
+					{
+						fillRect(x + (glyph->xOffset + xx) * _text_size, y + (glyph->yOffset + yy) * _text_size,
+								 _text_size, _text_size, _text_color);
+					}
+				}
+				bits <<= 1;
+			}
+		}
+	}
+
+	GFXfont *_font = NULL;
+	int16_t _cursor_x = 0;
+	int16_t _cursor_y = 0;
+	uint16_t _text_color = 0xFFFF;
+	uint8_t _text_size = 1;
+	bool _wrap = true;
+	uint8_t _rotation = 0;
+};
+
+#endif // _MOCK_ADAFRUIT_GFX_H_
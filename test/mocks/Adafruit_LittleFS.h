@@ -0,0 +1,130 @@
+/**
+ * @file Adafruit_LittleFS.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host replacement of the Adafruit LittleFS library for the native tests
+ *        Files are kept in RAM, the tests can read, change and delete them
+ *        through mock_fs_files to simulate a reset or a torn write.
+ *        Same open modes as the library, FILE_O_WRITE appends to the file.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _MOCK_ADAFRUIT_LITTLEFS_H_
+#define _MOCK_ADAFRUIT_LITTLEFS_H_
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#define FILE_O_READ 0
+#define FILE_O_WRITE 1
+
+/** Content of the files, key is the path */
+inline std::map<std::string, std::vector<uint8_t>> mock_fs_files;
+
+namespace Adafruit_LittleFS_Namespace
+{
+	class File;
+}
+
+/**
+ * @brief File system in RAM
+ *
+ */
+class Adafruit_LittleFS
+{
+public:
+	bool begin(void) { return true; }
+	bool exists(const char *path) { return mock_fs_files.count(path) != 0; }
+	bool remove(const char *path) { return mock_fs_files.erase(path) != 0; }
+	bool mkdir(const char *path)
+	{
+		(void)path;
+		return true;
+	}
+	bool format(void)
+	{
+		mock_fs_files.clear();
+		return true;
+	}
+};
+
+namespace Adafruit_LittleFS_Namespace
+{
+	/**
+	 * @brief Open file, reads and writes go directly to mock_fs_files
+	 *
+	 */
+	class File
+	{
+	public:
+		File(Adafruit_LittleFS &fs) { (void)fs; }
+
+		bool open(const char *path, uint8_t mode)
+		{
+			close();
+			if ((mode == FILE_O_READ) && (mock_fs_files.count(path) == 0))
+			{
+				return false;
+			}
+			_path = path;
+			_open = true;
+			// Files opened for write are created and continued at the end
+			_pos = mode == FILE_O_WRITE ? mock_fs_files[_path].size() : 0;
+			return true;
+		}
+		void close(void) { _open = false; }
+		operator bool(void) { return _open; }
+
+		int read(void *buffer, uint16_t len)
+		{
+			if (!_open)
+			{
+				return -1;
+			}
+			std::vector<uint8_t> &data = mock_fs_files[_path];
+			uint32_t count = _pos < data.size() ? data.size() - _pos : 0;
+			count = count < len ? count : len;
+			memcpy(buffer, data.data() + _pos, count);
+			_pos += count;
+			return count;
+		}
+		int read(void)
+		{
+			uint8_t data;
+			return read(&data, 1) == 1 ? data : -1;
+		}
+		size_t write(const uint8_t *buffer, size_t len)
+		{
+			if (!_open)
+			{
+				return 0;
+			}
+			std::vector<uint8_t> &data = mock_fs_files[_path];
+			if (data.size() < _pos + len)
+			{
+				data.resize(_pos + len);
+			}
+			memcpy(data.data() + _pos, buffer, len);
+			_pos += len;
+			return len;
+		}
+		size_t write(uint8_t data) { return write(&data, 1); }
+		bool seek(uint32_t pos)
+		{
+			_pos = pos;
+			return _open;
+		}
+		uint32_t size(void) { return _open ? mock_fs_files[_path].size() : 0; }
+		uint32_t position(void) { return _pos; }
+
+	private:
+		std::string _path;
+		bool _open = false;
+		uint32_t _pos = 0;
+	};
+}
+
+#endif // _MOCK_ADAFRUIT_LITTLEFS_H_
@@ -0,0 +1,278 @@
+/**
+ * @file Arduino.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host replacement of the Arduino core for the native tests
+ *        Only what the application uses. Time only moves when a test
+ *        sets mock_time_ms or calls delay(), pins keep the written level.
+ * @version 0.1
+ * @date 2024-03-26
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _MOCK_ARDUINO_H_
+#define _MOCK_ARDUINO_H_
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+typedef uint8_t byte;
+typedef void *TimerHandle_t;
+
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define INPUT 0
+#define INPUT_PULLUP 2
+#define RISING 1
+#define FALLING 2
+#define CHANGE 3
+#define HEX 16
+#define DEC 10
+
+#define WB_IO1 17
+#define WB_IO2 34
+#define WB_IO3 21
+#define WB_IO4 4
+#define WB_IO5 9
+#define WB_IO6 10
+#define WB_SW1 33
+#define WB_A0 5
+#define LED_BUILTIN 35
+#define LED_GREEN 35
+#define LED_BLUE 36
+#define MOSI 45
+#define SCK 43
+#define SS 26
+#define AR_INTERNAL_3_0 1
+
+/** Number of pins that are simulated */
+#define MOCK_PIN_NUM 48
+
+/** Simulated time in milliseconds */
+inline unsigned long mock_time_ms = 0;
+/** Level of the simulated pins, digitalRead() returns it */
+inline uint8_t mock_pin_level[MOCK_PIN_NUM] = {0};
+
+/** 32 bit like on the nRF52, wraps around after 49.7 days */
+inline uint32_t millis(void) { return (uint32_t)mock_time_ms; }
+inline unsigned long micros(void) { return mock_time_ms * 1000; }
+inline void delay(uint32_t ms) { mock_time_ms += ms; }
+inline void delayMicroseconds(uint32_t us) { (void)us; }
+inline void yield(void) {}
+
+inline void pinMode(uint32_t pin, uint32_t mode)
+{
+	(void)pin;
+	(void)mode;
+}
+inline void digitalWrite(uint32_t pin, uint32_t level)
+{
+	if (pin < MOCK_PIN_NUM)
+	{
+		mock_pin_level[pin] = level;
+	}
+}
+inline int digitalRead(uint32_t pin) { return pin < MOCK_PIN_NUM ? mock_pin_level[pin] : LOW; }
+inline uint32_t digitalPinToInterrupt(uint32_t pin) { return pin; }
+/** Interrupt callbacks of the pins, a test calls them to simulate an interrupt */
+inline void (*mock_interrupt[MOCK_PIN_NUM])(void) = {NULL};
+inline void attachInterrupt(uint32_t pin, void (*callback)(void), uint32_t mode)
+{
+	(void)mode;
+	if (pin < MOCK_PIN_NUM)
+	{
+		mock_interrupt[pin] = callback;
+	}
+}
+inline void detachInterrupt(uint32_t pin)
+{
+	if (pin < MOCK_PIN_NUM)
+	{
+		mock_interrupt[pin] = NULL;
+	}
+}
+
+/** Value returned by analogRead() */
+inline uint32_t mock_analog_value = 0;
+inline void analogOversampling(uint32_t samples) { (void)samples; }
+inline void analogReadResolution(uint8_t bits) { (void)bits; }
+inline void analogReference(uint8_t reference) { (void)reference; }
+inline uint32_t analogRead(uint32_t pin)
+{
+	(void)pin;
+	return mock_analog_value;
+}
+
+/** Value returned by readResetReason(), POWER_RESETREAS_xxx */
+inline uint32_t mock_reset_reason = 0;
+inline uint32_t readResetReason(void) { return mock_reset_reason; }
+inline void NVIC_SystemReset(void) {}
+
+struct NRF_POWER_Type
+{
+	uint32_t GPREGRET;
+	uint32_t RESETREAS;
+};
+inline NRF_POWER_Type mock_nrf_power = {0, 0};
+inline NRF_POWER_Type *NRF_POWER = &mock_nrf_power;
+#define POWER_RESETREAS_RESETPIN_Msk (1UL << 0)
+#define POWER_RESETREAS_DOG_Msk (1UL << 1)
+#define POWER_RESETREAS_SREQ_Msk (1UL << 2)
+#define POWER_RESETREAS_LOCKUP_Msk (1UL << 3)
+
+/**
+ * @brief Text output, all output goes through write()
+ *
+ */
+class Print
+{
+public:
+	virtual ~Print() {}
+	virtual size_t write(uint8_t data)
+	{
+		(void)data;
+		return 1;
+	}
+	size_t write(const uint8_t *buffer, size_t size)
+	{
+		for (size_t idx = 0; idx < size; idx++)
+		{
+			write(buffer[idx]);
+		}
+		return size;
+	}
+	size_t write(const char *text) { return write((const uint8_t *)text, strlen(text)); }
+	size_t print(const char *text) { return write(text); }
+	size_t print(char data) { return write((uint8_t)data); }
+	size_t print(long value, int base = DEC)
+	{
+		char text[24];
+		snprintf(text, sizeof(text), base == HEX ? "%lX" : "%ld", value);
+		return write(text);
+	}
+	size_t print(int value, int base = DEC) { return print((long)value, base); }
+	size_t print(unsigned int value, int base = DEC) { return print((long)value, base); }
+	size_t print(float value) { return printf("%.2f", value); }
+	size_t println(void) { return write("\r\n"); }
+	size_t println(const char *text) { return print(text) + println(); }
+	size_t printf(const char *format, ...)
+	{
+		char text[256];
+		va_list args;
+		va_start(args, format);
+		vsnprintf(text, sizeof(text), format, args);
+		va_end(args);
+		return write(text);
+	}
+};
+
+class Stream : public Print
+{
+public:
+	void begin(uint32_t baud) { (void)baud; }
+	int available(void) { return 0; }
+	int read(void) { return -1; }
+	void flush(void) {}
+	operator bool(void) { return true; }
+};
+inline Stream Serial;
+
+/**
+ * @brief Simulated I2C devices, reads len bytes starting at register reg
+ *        Returns false if no device answers at the address. Called with
+ *        len 0 when the address is written. Without it no device answers.
+ */
+inline bool (*mock_i2c_read)(uint8_t address, uint8_t reg, uint8_t *data, uint8_t len) = NULL;
+/** Number of I2C transfers */
+inline uint32_t mock_i2c_transfers = 0;
+
+class TwoWire
+{
+public:
+	void begin(void) {}
+	void setClock(uint32_t clock) { (void)clock; }
+	void beginTransmission(uint8_t address)
+	{
+		_address = address;
+		_tx_len = 0;
+	}
+	uint8_t endTransmission(bool stop = true)
+	{
+		(void)stop;
+		mock_i2c_transfers++;
+		return ((mock_i2c_read != NULL) && mock_i2c_read(_address, _reg, NULL, 0)) ? 0 : 2;
+	}
+	uint8_t requestFrom(uint8_t address, uint8_t len)
+	{
+		mock_i2c_transfers++;
+		_rx_len = 0;
+		_rx_pos = 0;
+		if ((mock_i2c_read == NULL) || (len > sizeof(_rx)) || !mock_i2c_read(address, _reg, _rx, len))
+		{
+			return 0;
+		}
+		_rx_len = len;
+		return len;
+	}
+	size_t write(uint8_t data)
+	{
+		if (_tx_len == 0)
+		{
+			_reg = data;
+		}
+		_tx_len++;
+		return 1;
+	}
+	int available(void) { return _rx_len - _rx_pos; }
+	int read(void) { return _rx_pos < _rx_len ? _rx[_rx_pos++] : -1; }
+
+private:
+	uint8_t _address = 0;
+	uint8_t _reg = 0;
+	uint8_t _tx_len = 0;
+	uint8_t _rx[32];
+	uint8_t _rx_len = 0;
+	uint8_t _rx_pos = 0;
+};
+inline TwoWire Wire;
+
+class SPIClass
+{
+public:
+	void begin(void) {}
+	uint8_t transfer(uint8_t data) { return data; }
+};
+inline SPIClass SPI;
+
+/**
+ * @brief FreeRTOS software timer, only remembers its settings
+ *
+ */
+class SoftwareTimer
+{
+public:
+	void begin(uint32_t ms, void (*callback)(TimerHandle_t), void *id = NULL, bool repeat = true)
+	{
+		period = ms;
+		cb = callback;
+		(void)id;
+		repeating = repeat;
+	}
+	void start(void) { running = true; }
+	void stop(void) { running = false; }
+	void reset(void) { running = true; }
+	void setPeriod(uint32_t ms) { period = ms; }
+
+	uint32_t period = 0;
+	void (*cb)(TimerHandle_t) = NULL;
+	bool repeating = false;
+	bool running = false;
+};
+
+#endif // _MOCK_ARDUINO_H_
@@ -0,0 +1,21 @@
+/**
+ * @file InternalFileSystem.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host replacement of the internal flash file system for the native tests
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _MOCK_INTERNAL_FILESYSTEM_H_
+#define _MOCK_INTERNAL_FILESYSTEM_H_
+#include <Adafruit_LittleFS.h>
+
+class InternalFileSystem : public Adafruit_LittleFS
+{
+};
+
+inline InternalFileSystem InternalFS;
+
+#endif // _MOCK_INTERNAL_FILESYSTEM_H_
@@ -0,0 +1,47 @@
+/**
+ * @file Melopero_RV3028.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host replacement of the Melopero RV3028 driver for the native tests
+ *        The control registers are kept in mock_rv3028_regs. setTime() stores
+ *        the new time in mock_rv3028_set_time, the simulated RTC of the test
+ *        takes it from there. The time registers are read with Wire.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _MOCK_MELOPERO_RV3028_H_
+#define _MOCK_MELOPERO_RV3028_H_
+#include <Arduino.h>
+
+/** Registers written with writeToRegister() */
+inline uint8_t mock_rv3028_regs[0x40] = {0};
+/** Time given to setTime(), year, month, weekday, date, hour, minute, second */
+inline uint16_t mock_rv3028_set_time[7] = {0};
+/** Number of setTime() calls */
+inline uint32_t mock_rv3028_set_count = 0;
+
+class Melopero_RV3028
+{
+public:
+	void initI2C(TwoWire &bus) { (void)bus; }
+	void useEEPROM(bool disableRefresh = true) { (void)disableRefresh; }
+	void set24HourMode(void) {}
+	void writeToRegister(uint8_t reg, uint8_t value)
+	{
+		if (reg < sizeof(mock_rv3028_regs))
+		{
+			mock_rv3028_regs[reg] = value;
+		}
+	}
+	uint8_t readFromRegister(uint8_t reg) { return reg < sizeof(mock_rv3028_regs) ? mock_rv3028_regs[reg] : 0; }
+	void setTime(uint16_t year, uint8_t month, uint8_t weekday, uint8_t date, uint8_t hour, uint8_t minute, uint8_t second)
+	{
+		uint16_t time[7] = {year, month, weekday, date, hour, minute, second};
+		memcpy(mock_rv3028_set_time, time, sizeof(time));
+		mock_rv3028_set_count++;
+	}
+};
+
+#endif // _MOCK_MELOPERO_RV3028_H_
@@ -0,0 +1,56 @@
+/**
+ * @file SensirionI2CSgp40.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host replacement of the Sensirion SGP40 driver for the native tests
+ *        measureRawSignal() returns mock_sgp40_sraw, the test sets it from a trace.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _MOCK_SENSIRION_SGP40_H_
+#define _MOCK_SENSIRION_SGP40_H_
+#include <Arduino.h>
+
+/** Raw signal returned by the next measurement */
+inline uint16_t mock_sgp40_sraw = 30000;
+/** Error code returned by the sensor commands, 0 = success */
+inline uint16_t mock_sgp40_error = 0;
+/** Number of measurements */
+inline uint32_t mock_sgp40_measurements = 0;
+
+inline void errorToString(uint16_t error, char errorMessage[], size_t errorMessageSize)
+{
+	snprintf(errorMessage, errorMessageSize, "Error %04X", error);
+}
+
+class SensirionI2CSgp40
+{
+public:
+	void begin(TwoWire &i2cBus) { (void)i2cBus; }
+	uint16_t getSerialNumber(uint16_t serialNumber[], uint8_t serialNumberSize)
+	{
+		for (uint8_t idx = 0; idx < serialNumberSize; idx++)
+		{
+			serialNumber[idx] = 0x1234;
+		}
+		return mock_sgp40_error;
+	}
+	uint16_t executeSelfTest(uint16_t &testResult)
+	{
+		testResult = 0xD400;
+		return mock_sgp40_error;
+	}
+	uint16_t measureRawSignal(uint16_t relativeHumidity, uint16_t temperature, uint16_t &srawVoc)
+	{
+		(void)relativeHumidity;
+		(void)temperature;
+		srawVoc = mock_sgp40_sraw;
+		mock_sgp40_measurements++;
+		return mock_sgp40_error;
+	}
+	uint16_t turnHeaterOff(void) { return 0; }
+};
+
+#endif // _MOCK_SENSIRION_SGP40_H_
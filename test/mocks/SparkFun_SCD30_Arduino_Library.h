@@ -0,0 +1,117 @@
+/**
+ * @file SparkFun_SCD30_Arduino_Library.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host replacement of the SparkFun SCD30 library for the native tests
+ *        The sensor answers only if mock_scd30_present is set. A running
+ *        measurement has new data every mock_scd30_interval ms.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _MOCK_SCD30_H_
+#define _MOCK_SCD30_H_
+#include <Arduino.h>
+
+/** Flag if the sensor answers on the I2C bus */
+inline bool mock_scd30_present = true;
+/** Flag if the sensor is measuring */
+inline bool mock_scd30_measuring = false;
+/** Time the next value is available */
+inline unsigned long mock_scd30_data_time = 0;
+/** Time between two values */
+inline unsigned long mock_scd30_interval = 2000;
+/** Values returned by the next reading */
+inline uint16_t mock_scd30_co2 = 800;
+inline float mock_scd30_temp = 23.5;
+inline float mock_scd30_humid = 45.0;
+/** Number of I2C transactions */
+inline uint32_t mock_scd30_transactions = 0;
+
+class SCD30
+{
+public:
+	bool begin(TwoWire &wirePort, bool autoCalibrate = false, bool measBegin = true)
+	{
+		(void)wirePort;
+		(void)autoCalibrate;
+		(void)measBegin;
+		mock_scd30_transactions++;
+		return mock_scd30_present;
+	}
+	bool setMeasurementInterval(uint16_t interval)
+	{
+		(void)interval;
+		mock_scd30_transactions++;
+		return mock_scd30_present;
+	}
+	bool setAutoSelfCalibration(bool enable)
+	{
+		(void)enable;
+		mock_scd30_transactions++;
+		return mock_scd30_present;
+	}
+	bool beginMeasuring(void)
+	{
+		mock_scd30_transactions++;
+		if (!mock_scd30_present)
+		{
+			return false;
+		}
+		if (!mock_scd30_measuring)
+		{
+			// First value after one interval
+			mock_scd30_measuring = true;
+			mock_scd30_data_time = millis() + mock_scd30_interval;
+		}
+		return true;
+	}
+	bool StopMeasurement(void)
+	{
+		mock_scd30_transactions++;
+		if (!mock_scd30_present)
+		{
+			return false;
+		}
+		mock_scd30_measuring = false;
+		return true;
+	}
+	bool dataAvailable(void)
+	{
+		mock_scd30_transactions++;
+		return mock_scd30_present && mock_scd30_measuring && (millis() >= mock_scd30_data_time);
+	}
+	bool readMeasurement(void)
+	{
+		mock_scd30_transactions++;
+		if (!dataAvailable())
+		{
+			return false;
+		}
+		mock_scd30_data_time = millis() + mock_scd30_interval;
+		return true;
+	}
+	uint16_t getCO2(void)
+	{
+		readMeasurement();
+		return mock_scd30_co2;
+	}
+	float getTemperature(void) { return mock_scd30_temp; }
+	float getHumidity(void) { return mock_scd30_humid; }
+	bool setForcedRecalibrationFactor(uint16_t concentration)
+	{
+		_calibration = concentration;
+		return mock_scd30_present;
+	}
+	bool getForcedRecalibration(uint16_t *concentration)
+	{
+		*concentration = _calibration;
+		return mock_scd30_present;
+	}
+
+private:
+	uint16_t _calibration = 400;
+};
+
+#endif // _MOCK_SCD30_H_
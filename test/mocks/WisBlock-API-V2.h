@@ -0,0 +1,252 @@
+/**
+ * @file WisBlock-API-V2.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host replacement of the WisBlock API for the native tests
+ *        Uplinks are not sent, the last packet is kept for the test.
+ *        Events from api_wake_loop() are collected in g_task_event_type.
+ * @version 0.1
+ * @date 2024-03-26
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _MOCK_WISBLOCK_API_H_
+#define _MOCK_WISBLOCK_API_H_
+#include <Arduino.h>
+
+#define WISBLOCK_API_VER 2
+#define WISBLOCK_API_VER2 0
+#define WISBLOCK_API_VER3 0
+
+// Event flags of the WisBlock API
+#define STATUS 0b0000000000000001
+#define N_STATUS 0b1111111111111110
+#define BLE_CONFIG 0b0000000000000010
+#define N_BLE_CONFIG 0b1111111111111101
+#define BLE_DATA 0b0000000000000100
+#define N_BLE_DATA 0b1111111111111011
+#define LORA_DATA 0b0000000000001000
+#define N_LORA_DATA 0b1111111111110111
+#define LORA_TX_FIN 0b0000000000010000
+#define N_LORA_TX_FIN 0b1111111111101111
+#define AT_CMD 0b0000000000100000
+#define N_AT_CMD 0b1111111111011111
+#define LORA_JOIN_FIN 0b0000000001000000
+#define N_LORA_JOIN_FIN 0b1111111110111111
+
+#define ATQUERY_SIZE 128
+#define AT_SUCCESS 0
+#define AT_ERRNO_EXEC_FAIL 3
+#define AT_ERRNO_NOALLOW 4
+#define AT_ERRNO_PARA_VAL 5
+#define AT_ERRNO_PARA_NUM 6
+
+/** Output of AT_PRINTF, the tests read it back */
+inline char mock_at_output[1024];
+inline size_t mock_at_len = 0;
+
+/**
+ * @brief Collect the AT command output, older output is dropped when the buffer is full
+ *
+ */
+inline void mock_at_printf(const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	int len = vsnprintf(mock_at_output + mock_at_len, sizeof(mock_at_output) - mock_at_len, format, args);
+	va_end(args);
+	if ((len > 0) && (mock_at_len + len < sizeof(mock_at_output)))
+	{
+		mock_at_len += len;
+	}
+	else
+	{
+		mock_at_len = 0;
+	}
+}
+
+#define AT_PRINTF(...) mock_at_printf(__VA_ARGS__)
+#define PRINTF(...) printf(__VA_ARGS__)
+
+typedef struct
+{
+	const char *cmd_name;
+	const char *cmd_desc;
+	int (*query_cb)(void);
+	int (*set_cb)(char *str);
+	int (*exec_cb)(void);
+	const char *permission;
+} atcmd_t;
+
+typedef enum
+{
+	LMH_SUCCESS = 0,
+	LMH_BUSY = -1,
+	LMH_ERROR = -2
+} lmh_error_status;
+
+#define LMH_UNCONFIRMED_MSG 0
+#define LMH_CONFIRMED_MSG 1
+
+typedef enum
+{
+	LORAMAC_REGION_AS923 = 0,
+	LORAMAC_REGION_AU915,
+	LORAMAC_REGION_CN470,
+	LORAMAC_REGION_CN779,
+	LORAMAC_REGION_EU433,
+	LORAMAC_REGION_EU868,
+	LORAMAC_REGION_KR920,
+	LORAMAC_REGION_IN865,
+	LORAMAC_REGION_US915,
+	LORAMAC_REGION_AS923_2,
+	LORAMAC_REGION_AS923_3,
+	LORAMAC_REGION_AS923_4,
+	LORAMAC_REGION_RU864,
+} LoRaMacRegion_t;
+
+typedef enum
+{
+	MIB_CHANNELS_DATARATE = 1,
+} Mib_t;
+
+typedef struct
+{
+	Mib_t Type;
+	union
+	{
+		int8_t ChannelsDatarate;
+	} Param;
+} MibRequestConfirm_t;
+
+/** 32 bit values are unsigned long, same as uint32_t on the nRF52, the format strings expect that */
+struct s_lorawan_settings
+{
+	uint8_t valid_mark_1 = 0xAA;
+	uint8_t valid_mark_2 = 0x55;
+	char sw_version = 0;
+	bool auto_join = false;
+	bool otaa_enabled = true;
+	uint8_t node_device_eui[8] = {0};
+	uint8_t node_app_eui[8] = {0};
+	uint8_t node_app_key[16] = {0};
+	unsigned long node_dev_addr = 0;
+	uint8_t node_nws_key[16] = {0};
+	uint8_t node_apps_key[16] = {0};
+	bool adr_enabled = false;
+	bool public_network = true;
+	bool duty_cycle_enabled = false;
+	unsigned long send_repeat_time = 120000;
+	uint8_t join_trials = 5;
+	uint8_t tx_power = 0;
+	uint8_t data_rate = 3;
+	uint8_t lora_class = 0;
+	uint8_t subband_channels = 1;
+	uint8_t app_port = 2;
+	uint8_t confirmed_msg_enabled = LMH_UNCONFIRMED_MSG;
+	uint8_t lora_region = LORAMAC_REGION_EU868;
+	bool lorawan_enable = true;
+	unsigned long p2p_frequency = 916000000;
+	uint8_t p2p_tx_power = 22;
+	uint8_t p2p_bandwidth = 0;
+	uint8_t p2p_sf = 7;
+	uint8_t p2p_cr = 1;
+	uint8_t p2p_preamble_len = 8;
+	uint16_t p2p_symbol_timeout = 0;
+	bool resetRequest = true;
+	uint8_t lorawan_task = 0;
+};
+
+inline s_lorawan_settings g_lorawan_settings;
+inline volatile uint16_t g_task_event_type = 0;
+inline char g_at_query_buf[ATQUERY_SIZE];
+inline bool g_lpwan_has_joined = false;
+inline bool g_enable_ble = false;
+inline bool g_join_result = false;
+inline bool g_rx_fin_result = false;
+inline int16_t g_last_rssi = 0;
+inline int8_t g_last_snr = 0;
+inline uint8_t g_rx_lora_data[256];
+inline uint16_t g_rx_data_len = 0;
+inline uint8_t g_sw_ver_1 = 1;
+inline uint8_t g_sw_ver_2 = 0;
+inline uint8_t g_sw_ver_3 = 0;
+inline bool g_ble_uart_is_connected = false;
+inline Stream g_ble_uart;
+inline SoftwareTimer g_task_wakeup_timer;
+
+inline char *region_names[] = {(char *)"AS923", (char *)"AU915", (char *)"CN470", (char *)"CN779",
+							   (char *)"EU433", (char *)"EU868", (char *)"KR920", (char *)"IN865",
+							   (char *)"US915", (char *)"AS923-2", (char *)"AS923-3", (char *)"AS923-4",
+							   (char *)"RU864"};
+inline char *bandwidths[] = {(char *)"125", (char *)"250", (char *)"500", (char *)"062", (char *)"041",
+							 (char *)"031", (char *)"020", (char *)"015", (char *)"010", (char *)"007"};
+
+/** Data rate returned by LoRaMacMibGetRequestConfirm() */
+inline int8_t mock_datarate = 3;
+/** Result of the next send_lora_packet() */
+inline lmh_error_status mock_send_result = LMH_SUCCESS;
+/** Bigger packets are rejected with LMH_ERROR, like the LoRaMAC does if the packet is too big for the data rate */
+inline uint8_t mock_send_max = 255;
+/** Last packet given to send_lora_packet() */
+inline uint8_t mock_sent_data[256];
+inline uint8_t mock_sent_len = 0;
+inline uint8_t mock_sent_fport = 0;
+/** Number of send_lora_packet() calls */
+inline uint16_t mock_send_count = 0;
+
+inline void api_set_version(uint16_t sw_1, uint16_t sw_2, uint16_t sw_3)
+{
+	g_sw_ver_1 = sw_1;
+	g_sw_ver_2 = sw_2;
+	g_sw_ver_3 = sw_3;
+}
+inline void api_wake_loop(uint16_t reason) { g_task_event_type |= reason; }
+inline void api_reset(void) {}
+inline void api_timer_stop(void) {}
+inline void api_timer_restart(uint32_t ms) { (void)ms; }
+inline void at_serial_input(uint8_t data) { (void)data; }
+inline void restart_advertising(uint16_t timeout) { (void)timeout; }
+inline void lmh_join(void) {}
+/** Battery voltage in mV returned by read_batt() */
+inline float mock_batt_mv = 3950.0;
+/** Number of read_batt() calls */
+inline uint16_t mock_batt_reads = 0;
+inline float read_batt(void)
+{
+	mock_batt_reads++;
+	return mock_batt_mv;
+}
+
+inline lmh_error_status send_lora_packet(uint8_t *data, uint8_t size, uint8_t fport = 0)
+{
+	mock_send_count++;
+	if (size > mock_send_max)
+	{
+		return LMH_ERROR;
+	}
+	if (mock_send_result == LMH_SUCCESS)
+	{
+		memcpy(mock_sent_data, data, size);
+		mock_sent_len = size;
+		mock_sent_fport = fport;
+	}
+	return mock_send_result;
+}
+inline bool send_p2p_packet(uint8_t *data, uint8_t size)
+{
+	memcpy(mock_sent_data, data, size);
+	mock_sent_len = size;
+	return true;
+}
+
+inline int LoRaMacMibGetRequestConfirm(MibRequestConfirm_t *mib_req)
+{
+	if (mib_req->Type == MIB_CHANNELS_DATARATE)
+	{
+		mib_req->Param.ChannelsDatarate = mock_datarate;
+	}
+	return 0;
+}
+
+#endif // _MOCK_WISBLOCK_API_H_
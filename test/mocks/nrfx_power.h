@@ -0,0 +1,26 @@
+/**
+ * @file nrfx_power.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host replacement of the nRF52 USB power detection for the native tests
+ * @version 0.1
+ * @date 2024-03-26
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _MOCK_NRFX_POWER_H_
+#define _MOCK_NRFX_POWER_H_
+
+typedef enum
+{
+	NRFX_POWER_USB_STATE_DISCONNECTED,
+	NRFX_POWER_USB_STATE_CONNECTED,
+	NRFX_POWER_USB_STATE_READY
+} nrfx_power_usb_state_t;
+
+/** USB state returned by nrfx_power_usbstatus_get() */
+inline nrfx_power_usb_state_t mock_usb_state = NRFX_POWER_USB_STATE_DISCONNECTED;
+
+inline nrfx_power_usb_state_t nrfx_power_usbstatus_get(void) { return mock_usb_state; }
+
+#endif // _MOCK_NRFX_POWER_H_
@@ -0,0 +1,88 @@
+/**
+ * @file wisblock_cayenne.h
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host replacement of the Cayenne LPP encoder for the native tests
+ *        Same data types, sizes and resolutions as the CayenneLPP library
+ *        and the VOC index extension of the WisBlock API.
+ * @version 0.1
+ * @date 2024-03-26
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef _MOCK_WISBLOCK_CAYENNE_H_
+#define _MOCK_WISBLOCK_CAYENNE_H_
+#include <Arduino.h>
+
+#define LPP_CHANNEL_SWITCH 48
+#define LPP_CHANNEL_DEVID 255
+
+/**
+ * @brief Cayenne LPP packet buffer
+ *
+ */
+class WisCayenne
+{
+public:
+	WisCayenne(uint8_t size) : _max_size(size) { _buffer = (uint8_t *)malloc(size); }
+	~WisCayenne() { free(_buffer); }
+
+	void reset(void) { _cursor = 0; }
+	uint8_t getSize(void) { return _cursor; }
+	uint8_t *getBuffer(void) { return _buffer; }
+	uint8_t copy(uint8_t *buffer)
+	{
+		memcpy(buffer, _buffer, _cursor);
+		return _cursor;
+	}
+
+	uint8_t addDigitalInput(uint8_t channel, uint32_t value) { return add(channel, 0, value, 1); }
+	uint8_t addAnalogInput(uint8_t channel, float value) { return add(channel, 2, (int32_t)lroundf(value * 100), 2); }
+	uint8_t addLuminosity(uint8_t channel, uint32_t lux) { return add(channel, 101, lux, 2); }
+	uint8_t addPresence(uint8_t channel, uint32_t value) { return add(channel, 102, value, 1); }
+	uint8_t addTemperature(uint8_t channel, float celsius) { return add(channel, 103, (int32_t)lroundf(celsius * 10), 2); }
+	uint8_t addRelativeHumidity(uint8_t channel, float rh) { return add(channel, 104, (int32_t)lroundf(rh * 2), 1); }
+	uint8_t addBarometricPressure(uint8_t channel, float hpa) { return add(channel, 115, (int32_t)lroundf(hpa * 10), 2); }
+	uint8_t addVoltage(uint8_t channel, float volt) { return add(channel, 116, (int32_t)lroundf(volt * 100), 2); }
+	uint8_t addConcentration(uint8_t channel, uint32_t value) { return add(channel, 125, value, 2); }
+	uint8_t addVoc_index(uint8_t channel, uint32_t value) { return add(channel, 138, value, 2); }
+	uint8_t addDevID(uint8_t channel, uint8_t *dev_id)
+	{
+		if (_cursor + 6 > _max_size)
+		{
+			return 0;
+		}
+		_buffer[_cursor++] = channel;
+		_buffer[_cursor++] = 255;
+		memcpy(&_buffer[_cursor], dev_id, 4);
+		_cursor += 4;
+		return _cursor;
+	}
+
+private:
+	/**
+	 * @brief Add a value, big endian
+	 *
+	 * @return uint8_t new packet size, 0 if the buffer is full
+	 */
+	uint8_t add(uint8_t channel, uint8_t type, int32_t value, uint8_t size)
+	{
+		if (_cursor + 2 + size > _max_size)
+		{
+			return 0;
+		}
+		_buffer[_cursor++] = channel;
+		_buffer[_cursor++] = type;
+		for (int8_t idx = size - 1; idx >= 0; idx--)
+		{
+			_buffer[_cursor++] = (value >> (idx * 8)) & 0xFF;
+		}
+		return _cursor;
+	}
+
+	uint8_t *_buffer;
+	uint8_t _max_size;
+	uint8_t _cursor = 0;
+};
+
+#endif // _MOCK_WISBLOCK_CAYENNE_H_
@@ -0,0 +1,343 @@
+/**
+ * @file test_batch_payload.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the batched uplinks
+ *        Readings are collected, sent with send_lora_packet() of the mocks
+ *        and decoded again with the logic of decodeBatch() of
+ *        decoders/compact_decoder.js. Packets that are too big for the data
+ *        rate are rejected by the mock with LMH_ERROR.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include "../../src/tools/compact_payload.cpp"
+#include "../../src/tools/batch_payload.cpp"
+#include "../../src/tools/payload_packer.cpp"
+
+/** Decoded reading of a batch packet */
+struct decoded_sample_s
+{
+	uint16_t age;
+	uint16_t bitmap;
+	int32_t codes[COMPACT_FIELDS_MAX];
+};
+
+/** Readings received by the server, in the order they were sent */
+static decoded_sample_s received[64];
+static uint8_t received_num = 0;
+
+/** EU868 data rates */
+#define DR_51_BYTES 0
+#define DR_222_BYTES 5
+
+void setUp(void)
+{
+	mock_time_ms = 1000000;
+	mock_datarate = DR_222_BYTES;
+	mock_send_result = LMH_SUCCESS;
+	mock_send_max = 255;
+	mock_send_count = 0;
+	g_lorawan_settings.lora_region = LORAMAC_REGION_EU868;
+	g_batch_samples = 4;
+	batch_num = 0;
+	received_num = 0;
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief Cayenne LPP packet of a reading with all sensors
+ *        The values are taken from the reading number
+ *
+ * @return uint8_t packet size
+ */
+static uint8_t make_reading(uint16_t number, uint8_t *lpp)
+{
+	uint8_t len = 0;
+	auto add = [&](uint8_t channel, uint8_t type, int32_t value, uint8_t size)
+	{
+		lpp[len++] = channel;
+		lpp[len++] = type;
+		if (size == 2)
+		{
+			lpp[len++] = (value >> 8) & 0xFF;
+		}
+		lpp[len++] = value & 0xFF;
+	};
+	add(LPP_CHANNEL_BATT, 116, 390 + number % 20, 2);
+	add(LPP_CHANNEL_HUMID, 104, 90 + number % 30, 1);
+	add(LPP_CHANNEL_TEMP, 103, 215 + number, 2);
+	add(LPP_CHANNEL_PRESS, 115, 10130 - number, 2);
+	add(LPP_CHANNEL_LIGHT, 101, 300 + 7 * number, 2);
+	add(LPP_CHANNEL_VOC, 138, 100 + number, 2);
+	add(LPP_CHANNEL_CO2_2, 125, 600 + 11 * number, 2);
+	add(LPP_CHANNEL_PM_1_0, 138, 3 + number % 5, 2);
+	add(LPP_CHANNEL_PM_2_5, 138, 5 + number % 7, 2);
+	add(LPP_CHANNEL_PM_10_0, 138, 8 + number % 9, 2);
+	add(LPP_CHANNEL_SWITCH, 102, number & 1, 1);
+	return len;
+}
+
+/**
+ * @brief Add a reading to the batch
+ *
+ * @return uint8_t result of add_batch_sample()
+ */
+static uint8_t add_reading(uint16_t number)
+{
+	uint8_t lpp[64];
+	uint8_t lpp_len = make_reading(number, lpp);
+	return add_batch_sample(lpp, lpp_len);
+}
+
+static bool read_bits(const uint8_t *packet, uint8_t len, uint16_t *pos, uint8_t bits, uint32_t *value)
+{
+	*value = 0;
+	for (uint8_t bit = 0; bit < bits; bit++, (*pos)++)
+	{
+		if (*pos / 8 >= len)
+		{
+			return false;
+		}
+		*value = (*value << 1) | ((packet[*pos / 8] >> (7 - (*pos % 8))) & 1);
+	}
+	return true;
+}
+
+/**
+ * @brief Decode the last sent batch packet, same logic as decodeBatch() of decoders/compact_decoder.js
+ *        The readings are added to received[]
+ *
+ * @return uint8_t number of readings in the packet
+ */
+static uint8_t decode_sent_batch(void)
+{
+	TEST_ASSERT_EQUAL_UINT8(BATCH_FPORT, mock_sent_fport);
+	TEST_ASSERT_EQUAL_UINT8(COMPACT_VERSION, mock_sent_data[0] >> 6);
+	uint8_t num = mock_sent_data[0] & 0x0F;
+	uint16_t pos = 8;
+	uint32_t value;
+	for (uint8_t sample = 0; sample < num; sample++)
+	{
+		decoded_sample_s *decoded = &received[received_num++];
+		TEST_ASSERT_TRUE(read_bits(mock_sent_data, mock_sent_len, &pos, 16, &value));
+		decoded->age = value;
+		TEST_ASSERT_TRUE(read_bits(mock_sent_data, mock_sent_len, &pos, 16, &value));
+		decoded->bitmap = value;
+		for (uint8_t idx = 0; idx < compact_fields_num; idx++)
+		{
+			if (decoded->bitmap & (1 << idx))
+			{
+				uint8_t bits = compact_fields[idx].bits;
+				TEST_ASSERT_TRUE(read_bits(mock_sent_data, mock_sent_len, &pos, bits, &value));
+				decoded->codes[idx] = (compact_fields[idx].is_signed && (value >= (1UL << (bits - 1)))) ? (int32_t)value - (1L << bits) : (int32_t)value;
+			}
+		}
+	}
+	// Only fill bits are left
+	TEST_ASSERT_EQUAL_UINT8((pos + 7) / 8, mock_sent_len);
+	return num;
+}
+
+/**
+ * @brief Compare a received reading with the reading it was created from
+ *
+ */
+static void check_received(uint8_t idx, uint16_t number, uint16_t age)
+{
+	uint8_t lpp[64];
+	int32_t values[COMPACT_FIELDS_MAX];
+	uint16_t bitmap;
+	TEST_ASSERT_TRUE(compact_values(lpp, make_reading(number, lpp), values, &bitmap));
+
+	TEST_ASSERT_EQUAL_UINT16(age, received[idx].age);
+	TEST_ASSERT_EQUAL_HEX32(bitmap, received[idx].bitmap);
+	for (uint8_t field = 0; field < compact_fields_num; field++)
+	{
+		if (bitmap & (1 << field))
+		{
+			TEST_ASSERT_EQUAL_INT32(values[field], received[idx].codes[field]);
+		}
+	}
+	// Spot check against the Cayenne LPP values
+	TEST_ASSERT_EQUAL_INT32(215 + number, received[idx].codes[2]);
+	TEST_ASSERT_EQUAL_INT32(600 + 11 * number, received[idx].codes[10]);
+}
+
+/**
+ * @brief The batch is sent when it has g_batch_samples readings
+ *        Each reading has its age in seconds
+ *
+ */
+void test_batch_full(void)
+{
+	for (uint16_t number = 0; number < 3; number++)
+	{
+		TEST_ASSERT_EQUAL_UINT8(BATCH_STORED, add_reading(number));
+		mock_time_ms += 60000;
+	}
+	TEST_ASSERT_EQUAL_UINT8(BATCH_SEND, add_reading(3));
+	mock_time_ms += 2000;
+
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_batch());
+	TEST_ASSERT_EQUAL_UINT8(4, decode_sent_batch());
+	TEST_ASSERT_EQUAL_UINT8(0, batch_num);
+	for (uint16_t number = 0; number < 4; number++)
+	{
+		check_received(number, number, 2 + (3 - number) * 60);
+	}
+}
+
+/**
+ * @brief The batch is sent early if the next reading would not fit the data rate
+ *
+ */
+void test_batch_data_rate(void)
+{
+	g_batch_samples = BATCH_SAMPLES_MAX;
+	mock_datarate = DR_51_BYTES;
+
+	uint16_t number = 0;
+	while (add_reading(number) == BATCH_STORED)
+	{
+		number++;
+		mock_time_ms += 60000;
+		TEST_ASSERT_LESS_THAN(BATCH_SAMPLES_MAX, number);
+	}
+	number++;
+	TEST_ASSERT_GREATER_THAN(1, number);
+
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_batch());
+	TEST_ASSERT_LESS_OR_EQUAL(51, mock_sent_len);
+	TEST_ASSERT_EQUAL_UINT8(number, decode_sent_batch());
+	TEST_ASSERT_EQUAL_UINT8(0, batch_num);
+
+	// Every region and data rate
+	uint8_t regions[] = {LORAMAC_REGION_EU868, LORAMAC_REGION_US915, LORAMAC_REGION_AU915, LORAMAC_REGION_CN470, LORAMAC_REGION_AS923};
+	for (uint8_t region : regions)
+	{
+		g_lorawan_settings.lora_region = region;
+		for (mock_datarate = 0; mock_datarate < 8; mock_datarate++)
+		{
+			batch_num = 0;
+			number = 0;
+			while ((add_reading(number) == BATCH_STORED) && (number < BATCH_SAMPLES_MAX))
+			{
+				number++;
+			}
+			mock_sent_len = 0;
+			if (send_batch() == LMH_SUCCESS)
+			{
+				TEST_ASSERT_LESS_OR_EQUAL(lora_max_payload(), mock_sent_len);
+				TEST_ASSERT_EQUAL_UINT8(number + 1 - batch_num, decode_sent_batch());
+			}
+			else
+			{
+				// Not even one reading fits, e.g. US915 DR0
+				TEST_ASSERT_EQUAL_UINT8(0, mock_sent_len);
+				TEST_ASSERT_LESS_THAN(1 + (BATCH_SAMPLE_HDR_BITS + compact_bits(batch[0].bitmap) + 7) / 8, lora_max_payload());
+			}
+		}
+	}
+}
+
+/**
+ * @brief A packet rejected as too big is sent with less readings
+ *        The other readings stay for the next packet
+ *
+ */
+void test_batch_too_big(void)
+{
+	g_batch_samples = 3;
+	TEST_ASSERT_EQUAL_UINT8(BATCH_STORED, add_reading(0));
+	TEST_ASSERT_EQUAL_UINT8(BATCH_STORED, add_reading(1));
+	TEST_ASSERT_EQUAL_UINT8(BATCH_SEND, add_reading(2));
+
+	// Pending MAC commands leave space for one reading
+	mock_send_max = 30;
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_batch());
+	TEST_ASSERT_GREATER_THAN(1, mock_send_count);
+	TEST_ASSERT_EQUAL_UINT8(1, decode_sent_batch());
+	TEST_ASSERT_EQUAL_UINT8(2, batch_num);
+
+	mock_send_max = 255;
+	mock_time_ms += 10000;
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_batch());
+	TEST_ASSERT_EQUAL_UINT8(2, decode_sent_batch());
+	TEST_ASSERT_EQUAL_UINT8(0, batch_num);
+	check_received(0, 0, 0);
+	check_received(1, 1, 10);
+	check_received(2, 2, 10);
+
+	// Not even one reading fits
+	add_reading(3);
+	mock_send_max = 10;
+	TEST_ASSERT_EQUAL(LMH_ERROR, send_batch());
+	TEST_ASSERT_EQUAL_UINT8(1, batch_num);
+}
+
+/**
+ * @brief Readings stay stored if the LoRaWAN stack is busy
+ *        If the buffer is full, the oldest reading is dropped
+ *
+ */
+void test_batch_busy(void)
+{
+	g_batch_samples = BATCH_SAMPLES_MAX;
+	mock_send_result = LMH_BUSY;
+	uint8_t lpp[] = {LPP_CHANNEL_VOC, 138, 0, 0};
+	for (uint16_t number = 0; number < BATCH_SAMPLES_MAX + 2; number++)
+	{
+		lpp[3] = number;
+		uint8_t result = add_batch_sample(lpp, sizeof(lpp));
+		TEST_ASSERT_EQUAL_UINT8(number < BATCH_SAMPLES_MAX - 1 ? BATCH_STORED : BATCH_SEND, result);
+		if (result == BATCH_SEND)
+		{
+			TEST_ASSERT_EQUAL(LMH_BUSY, send_batch());
+		}
+		mock_time_ms += 1000;
+	}
+	TEST_ASSERT_EQUAL_UINT8(BATCH_SAMPLES_MAX, batch_num);
+
+	mock_send_result = LMH_SUCCESS;
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_batch());
+	TEST_ASSERT_EQUAL_UINT8(BATCH_SAMPLES_MAX, decode_sent_batch());
+	for (uint8_t idx = 0; idx < BATCH_SAMPLES_MAX; idx++)
+	{
+		TEST_ASSERT_EQUAL_INT32(idx + 2, received[idx].codes[9]);
+		TEST_ASSERT_EQUAL_UINT16(BATCH_SAMPLES_MAX - idx, received[idx].age);
+	}
+}
+
+/**
+ * @brief Ages above 16 bits are limited, unknown values are not stored
+ *
+ */
+void test_batch_limits(void)
+{
+	uint8_t lpp[64];
+	uint8_t lpp_len = make_reading(0, lpp);
+	add_batch_sample(lpp, lpp_len);
+	mock_time_ms += 100000000;
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_batch());
+	TEST_ASSERT_EQUAL_UINT8(1, decode_sent_batch());
+	TEST_ASSERT_EQUAL_UINT16(0xFFFF, received[0].age);
+
+	uint8_t unknown[] = {LPP_CHANNEL_TEMP, 103, 0x00, 0xE6, 10, 136, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	TEST_ASSERT_EQUAL_UINT8(BATCH_INVALID, add_batch_sample(unknown, sizeof(unknown)));
+	TEST_ASSERT_EQUAL_UINT8(0, batch_num);
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_batch_full);
+	RUN_TEST(test_batch_data_rate);
+	RUN_TEST(test_batch_too_big);
+	RUN_TEST(test_batch_busy);
+	RUN_TEST(test_batch_limits);
+	return UNITY_END();
+}
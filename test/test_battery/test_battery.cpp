@@ -0,0 +1,145 @@
+/**
+ * @file test_battery.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the battery monitor
+ *        read_batt() of the WisBlock API is replaced by a mock that
+ *        returns mock_batt_mv. A discharge is simulated by lowering the
+ *        voltage once per sensor cycle.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include "../../src/tools/battery.cpp"
+
+/** Sensor cycle of the simulated device in ms */
+#define CYCLE_MS 300000
+
+void setUp(void)
+{
+	mock_time_ms = 10000;
+	mock_batt_mv = 4000.0;
+	mock_batt_reads = 0;
+	init_battery();
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief One sample per call, readers get the cached value
+ *
+ */
+void test_cached_value(void)
+{
+	TEST_ASSERT_EQUAL_UINT16(1, mock_batt_reads);
+	TEST_ASSERT_EQUAL_FLOAT(4000.0, battery_mv());
+	for (uint8_t idx = 0; idx < 10; idx++)
+	{
+		battery_mv();
+	}
+	TEST_ASSERT_EQUAL_UINT16(1, mock_batt_reads);
+
+	sample_battery();
+	TEST_ASSERT_EQUAL_UINT16(2, mock_batt_reads);
+}
+
+/**
+ * @brief A new sample moves the filtered value by 1 / BATT_FILTER_WEIGHT
+ *        Single outliers are damped, a step is followed
+ *
+ */
+void test_filter(void)
+{
+	mock_batt_mv = 3600.0;
+	sample_battery();
+	TEST_ASSERT_EQUAL_FLOAT(4000.0 - 400.0 / BATT_FILTER_WEIGHT, battery_mv());
+
+	for (uint8_t idx = 0; idx < 30; idx++)
+	{
+		sample_battery();
+	}
+	TEST_ASSERT_FLOAT_WITHIN(1.0, 3600.0, battery_mv());
+}
+
+/**
+ * @brief The slope is known after BATT_SLOPE_INTERVAL, the runtime is calculated from it
+ *
+ */
+void test_discharge(void)
+{
+	// 10 mV per hour
+	float drop = 10.0 * CYCLE_MS / 3600000.0;
+
+	TEST_ASSERT_EQUAL_FLOAT(0.0, battery_slope());
+	TEST_ASSERT_EQUAL_INT32(-1, battery_runtime());
+
+	for (uint16_t cycle = 0; cycle < 24 * 12; cycle++)
+	{
+		mock_time_ms += CYCLE_MS;
+		mock_batt_mv -= drop;
+		sample_battery();
+	}
+	TEST_ASSERT_FLOAT_WITHIN(0.5, -10.0, battery_slope());
+	int32_t expected = (int32_t)((battery_mv() - BATT_EMPTY_MV) / 10.0);
+	TEST_ASSERT_INT32_WITHIN(3, expected, battery_runtime());
+
+	char msg[96];
+	snprintf(msg, sizeof(msg), "%.0f mV, slope %.2f mV/h, runtime %ld h", battery_mv(), battery_slope(), (long)battery_runtime());
+	TEST_MESSAGE(msg);
+}
+
+/**
+ * @brief No runtime while charging, below the empty voltage the runtime is 0
+ *
+ */
+void test_runtime_limits(void)
+{
+	// Charging
+	for (uint16_t cycle = 0; cycle < 24; cycle++)
+	{
+		mock_time_ms += CYCLE_MS;
+		mock_batt_mv += 1.0;
+		sample_battery();
+	}
+	TEST_ASSERT_TRUE(battery_slope() > 0);
+	TEST_ASSERT_EQUAL_INT32(-1, battery_runtime());
+
+	// Empty battery
+	for (uint16_t cycle = 0; cycle < 48; cycle++)
+	{
+		mock_time_ms += CYCLE_MS;
+		mock_batt_mv = 3200.0 - cycle;
+		sample_battery();
+	}
+	TEST_ASSERT_TRUE(battery_slope() < 0);
+	TEST_ASSERT_EQUAL_INT32(0, battery_runtime());
+}
+
+/**
+ * @brief Powered from USB without battery, no runtime
+ *
+ */
+void test_no_battery(void)
+{
+	mock_batt_mv = 0.0;
+	init_battery();
+	for (uint16_t cycle = 0; cycle < 24; cycle++)
+	{
+		mock_time_ms += CYCLE_MS;
+		sample_battery();
+	}
+	TEST_ASSERT_EQUAL_INT32(-1, battery_runtime());
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_cached_value);
+	RUN_TEST(test_filter);
+	RUN_TEST(test_discharge);
+	RUN_TEST(test_runtime_limits);
+	RUN_TEST(test_no_battery);
+	return UNITY_END();
+}
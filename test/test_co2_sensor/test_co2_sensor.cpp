@@ -0,0 +1,259 @@
+/**
+ * @file test_co2_sensor.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the RAK12037 CO2 sensor state machine
+ *        The SCD30 is replaced by a mock, the poll timer is simulated by
+ *        advancing the time by the timer period and calling poll_rak12037().
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include "../../src/sensors/RAK12037_co2.cpp"
+
+// Application parts the CO2 sensor code uses
+WisCayenne g_solution_data(255);
+float g_last_temp = 0;
+float g_last_humid = 0;
+float g_last_pressure = 0;
+/** Last value given to the display */
+static float display_co2 = 0;
+
+void set_co2_rak14000(float co2_value) { display_co2 = co2_value; }
+void sensor_wakeup(TimerHandle_t unused) { (void)unused; }
+
+/**
+ * @brief Run the poll timer until a reading is finished or the timer stops
+ *
+ * @param max_ms max time to run the timer
+ * @return true if poll_rak12037() reported a finished reading
+ */
+static bool run_poll_timer(uint32_t max_ms)
+{
+	unsigned long end = mock_time_ms + max_ms;
+	while (co2_poll_timer.running && (mock_time_ms < end))
+	{
+		mock_time_ms += co2_poll_timer.period;
+		if (poll_rak12037())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void setUp(void)
+{
+	mock_time_ms = 100000;
+	mock_scd30_present = true;
+	mock_scd30_measuring = false;
+	mock_scd30_interval = 2000;
+	mock_scd30_co2 = 800;
+	co2_state = CO2_OFF;
+	co2_next_state = CO2_OFF;
+	co2_read_requested = false;
+	co2_valid = false;
+	co2_poll_timer.stop();
+	g_solution_data.reset();
+	display_co2 = 0;
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief Normal reading, the value is waited for with the poll timer
+ *
+ */
+void test_reading(void)
+{
+	TEST_ASSERT_TRUE(init_rak12037());
+	TEST_ASSERT_EQUAL_UINT8(CO2_MEASURING, co2_state);
+
+	// First value needs one measurement interval
+	TEST_ASSERT_FALSE(request_rak12037());
+	TEST_ASSERT_TRUE(co2_poll_timer.running);
+	TEST_ASSERT_TRUE(run_poll_timer(5000));
+	TEST_ASSERT_FALSE(co2_poll_timer.running);
+
+	read_rak12037();
+	TEST_ASSERT_EQUAL_UINT8(CO2_MEASURING, co2_state);
+	TEST_ASSERT_EQUAL_FLOAT(800.0, display_co2);
+	TEST_ASSERT_EQUAL_FLOAT(23.5, g_last_temp);
+	TEST_ASSERT_GREATER_THAN(0, g_solution_data.getSize());
+
+	// Next value is already there, no polling
+	mock_time_ms += 60000;
+	mock_scd30_co2 = 900;
+	TEST_ASSERT_TRUE(request_rak12037());
+	TEST_ASSERT_FALSE(co2_poll_timer.running);
+	read_rak12037();
+	TEST_ASSERT_EQUAL_FLOAT(900.0, display_co2);
+}
+
+/**
+ * @brief A first value of 0 ppm is discarded, the next value is used
+ *
+ */
+void test_zero_retry(void)
+{
+	TEST_ASSERT_TRUE(init_rak12037());
+	mock_scd30_co2 = 0;
+	TEST_ASSERT_FALSE(request_rak12037());
+	mock_time_ms += mock_scd30_interval;
+	TEST_ASSERT_FALSE(poll_rak12037());
+	TEST_ASSERT_TRUE(co2_zero_retry);
+
+	mock_scd30_co2 = 650;
+	TEST_ASSERT_TRUE(run_poll_timer(5000));
+	read_rak12037();
+	TEST_ASSERT_EQUAL_FLOAT(650.0, display_co2);
+}
+
+/**
+ * @brief A measuring sensor without data times out after 20 seconds
+ *        and is still measuring for the next reading
+ *
+ */
+void test_timeout(void)
+{
+	TEST_ASSERT_TRUE(init_rak12037());
+	mock_scd30_interval = 60000;
+	mock_scd30_data_time = mock_time_ms + 60000;
+
+	unsigned long start = mock_time_ms;
+	TEST_ASSERT_FALSE(request_rak12037());
+	TEST_ASSERT_TRUE(run_poll_timer(30000));
+	TEST_ASSERT_GREATER_THAN(20000, mock_time_ms - start);
+	TEST_ASSERT_LESS_OR_EQUAL(22000, mock_time_ms - start);
+
+	read_rak12037();
+	TEST_ASSERT_EQUAL_FLOAT(0.0, display_co2);
+	TEST_ASSERT_EQUAL_UINT8(CO2_MEASURING, co2_state);
+}
+
+/**
+ * @brief A sensor that failed to start stays off after the reading without data
+ *        The next request finishes at once instead of waiting for the timeout
+ *
+ */
+void test_no_data_sensor_off(void)
+{
+	TEST_ASSERT_TRUE(init_rak12037());
+	shutdown_rak12037();
+	TEST_ASSERT_EQUAL_UINT8(CO2_OFF, co2_state);
+
+	// Sensor power on, but the sensor does not answer
+	mock_scd30_present = false;
+	startup_rak12037();
+	TEST_ASSERT_EQUAL_UINT8(CO2_STARTING, co2_state);
+	TEST_ASSERT_FALSE(request_rak12037());
+	TEST_ASSERT_TRUE(run_poll_timer(5000));
+	TEST_ASSERT_FALSE(co2_poll_timer.running);
+
+	read_rak12037();
+	TEST_ASSERT_EQUAL_UINT8(CO2_OFF, co2_state);
+	TEST_ASSERT_EQUAL_FLOAT(0.0, display_co2);
+
+	// Next cycle without a startup, no polling of the stopped sensor
+	mock_scd30_present = true;
+	uint32_t transactions = mock_scd30_transactions;
+	unsigned long start = mock_time_ms;
+	TEST_ASSERT_TRUE(request_rak12037());
+	TEST_ASSERT_FALSE(co2_poll_timer.running);
+	TEST_ASSERT_EQUAL_UINT32(transactions, mock_scd30_transactions);
+	TEST_ASSERT_EQUAL_UINT32(start, mock_time_ms);
+	read_rak12037();
+	TEST_ASSERT_EQUAL_UINT8(CO2_OFF, co2_state);
+}
+
+/**
+ * @brief A reading requested while the sensor is stopping ends without data, the sensor stays off
+ *
+ */
+void test_request_while_stopping(void)
+{
+	TEST_ASSERT_TRUE(init_rak12037());
+	mock_scd30_present = false;
+	shutdown_rak12037();
+	TEST_ASSERT_EQUAL_UINT8(CO2_STOPPING, co2_state);
+
+	TEST_ASSERT_FALSE(request_rak12037());
+	mock_scd30_present = true;
+	TEST_ASSERT_TRUE(run_poll_timer(5000));
+	read_rak12037();
+	TEST_ASSERT_EQUAL_UINT8(CO2_OFF, co2_state);
+	TEST_ASSERT_FALSE(mock_scd30_measuring);
+}
+
+/**
+ * @brief On battery the sensor power is switched on before each reading
+ *        startup_rak12037() must not wait for the sensor, the start is retried from the poll timer
+ *
+ */
+void test_battery_startup_does_not_block(void)
+{
+	TEST_ASSERT_TRUE(init_rak12037());
+	shutdown_rak12037();
+
+	// Sensor is still booting after the power was switched on
+	mock_scd30_present = false;
+	unsigned long start = mock_time_ms;
+	uint32_t transactions = mock_scd30_transactions;
+	startup_rak12037();
+	TEST_ASSERT_EQUAL_UINT32(start, mock_time_ms);
+	TEST_ASSERT_LESS_OR_EQUAL(2, mock_scd30_transactions - transactions);
+	TEST_ASSERT_EQUAL_UINT8(CO2_STARTING, co2_state);
+	TEST_ASSERT_TRUE(co2_poll_timer.running);
+	TEST_ASSERT_EQUAL_UINT32(250, co2_poll_timer.period);
+
+	// Sensor answers after 500 ms
+	mock_time_ms += 250;
+	TEST_ASSERT_FALSE(poll_rak12037());
+	TEST_ASSERT_EQUAL_UINT8(CO2_STARTING, co2_state);
+	mock_scd30_present = true;
+	mock_time_ms += 250;
+	TEST_ASSERT_FALSE(poll_rak12037());
+	TEST_ASSERT_EQUAL_UINT8(CO2_MEASURING, co2_state);
+	TEST_ASSERT_FALSE(co2_poll_timer.running);
+
+	// The reading waits for the first value without blocking
+	TEST_ASSERT_FALSE(request_rak12037());
+	TEST_ASSERT_TRUE(run_poll_timer(5000));
+	read_rak12037();
+	TEST_ASSERT_EQUAL_FLOAT(800.0, display_co2);
+	TEST_ASSERT_EQUAL_UINT8(CO2_MEASURING, co2_state);
+}
+
+/**
+ * @brief A reading requested while the sensor is starting continues when the sensor runs
+ *
+ */
+void test_request_while_starting(void)
+{
+	TEST_ASSERT_TRUE(init_rak12037());
+	shutdown_rak12037();
+
+	mock_scd30_present = false;
+	startup_rak12037();
+	TEST_ASSERT_FALSE(request_rak12037());
+	mock_scd30_present = true;
+	TEST_ASSERT_TRUE(run_poll_timer(10000));
+	read_rak12037();
+	TEST_ASSERT_EQUAL_FLOAT(800.0, display_co2);
+	TEST_ASSERT_EQUAL_UINT8(CO2_MEASURING, co2_state);
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_reading);
+	RUN_TEST(test_zero_retry);
+	RUN_TEST(test_timeout);
+	RUN_TEST(test_no_data_sensor_off);
+	RUN_TEST(test_request_while_stopping);
+	RUN_TEST(test_battery_startup_does_not_block);
+	RUN_TEST(test_request_while_starting);
+	return UNITY_END();
+}
@@ -0,0 +1,599 @@
+/**
+ * @file test_compact_payload.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the compact payload format
+ *        Cayenne LPP packets are encoded, decoded again with the logic of
+ *        decoders/compact_decoder.js and compared with the original values.
+ *        Difference packets are sent over a simulated link that loses packets
+ *        and ACKs, the server side keeps the received packets as references.
+ *        The benchmark prints the packet sizes and the encode time.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include <chrono>
+#include <string>
+#include "../../src/tools/compact_payload.cpp"
+
+/** Cayenne LPP data type and size of the values in compact_fields[] */
+static const uint8_t field_types[][2] = {
+	{116, 2}, // Voltage
+	{104, 1}, // Humidity
+	{103, 2}, // Temperature
+	{115, 2}, // Barometer
+	{101, 2}, // Illuminance
+	{104, 1}, // Humidity
+	{103, 2}, // Temperature
+	{115, 2}, // Barometer
+	{101, 2}, // Illuminance
+	{138, 2}, // VOC index
+	{125, 2}, // Concentration
+	{138, 2}, // PM 1.0
+	{138, 2}, // PM 2.5
+	{138, 2}, // PM 10
+	{102, 1}, // Presence
+};
+static_assert(sizeof(field_types) / sizeof(field_types[0]) == compact_fields_num, "Test table does not match compact_fields[]");
+
+/** Range of the test values, Cayenne LPP resolution */
+static const int32_t field_ranges[][2] = {
+	{300, 420}, {40, 140}, {-100, 400}, {9500, 10500}, {0, 2000}, {40, 140}, {-100, 400}, {9500, 10500}, {0, 2000}, {0, 500}, {400, 5000}, {0, 300}, {0, 300}, {0, 300}, {0, 1}};
+
+/** A reading, Cayenne LPP values of the fields */
+struct reading_s
+{
+	uint16_t bitmap;
+	int32_t values[COMPACT_FIELDS_MAX];
+};
+
+/** Decoded compact packet */
+struct decoded_s
+{
+	uint8_t seq;
+	bool delta;
+	uint8_t ref_seq;
+	uint16_t bitmap;
+	int32_t codes[COMPACT_FIELDS_MAX];
+};
+
+/** Number of values per COMPACT_DELTA_xxx encoding seen by the decoder */
+static uint32_t encodings[4];
+
+/** Random numbers, same sequence in every run */
+static uint32_t rng_state = 1;
+static uint32_t rng(void)
+{
+	rng_state = rng_state * 1103515245UL + 12345UL;
+	return (rng_state >> 8) & 0xFFFFFF;
+}
+
+/**
+ * @brief Reset the encoder, as after a device start
+ *
+ */
+static void reset_encoder(uint8_t format)
+{
+	g_payload_format = format;
+	packet_count = 0;
+	new_bitmap = 0;
+	new_absolute = false;
+	sent_pending = false;
+	sent_count = 0;
+	sent_confirmed = false;
+	ref_bitmap = 0;
+	ref_count = 0;
+	ref_valid = false;
+}
+
+void setUp(void)
+{
+	reset_encoder(PAYLOAD_COMPACT);
+	memset(encodings, 0, sizeof(encodings));
+	rng_state = 1;
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief Create the Cayenne LPP packet of a reading
+ *        A value of the gas sensor, which is not in the compact format, is added
+ *
+ * @return uint8_t size of the packet
+ */
+static uint8_t make_lpp(const reading_s &reading, uint8_t *lpp)
+{
+	uint8_t len = 0;
+	for (uint8_t idx = 0; idx < compact_fields_num; idx++)
+	{
+		if ((reading.bitmap & (1 << idx)) == 0)
+		{
+			continue;
+		}
+		lpp[len++] = compact_fields[idx].channel;
+		lpp[len++] = field_types[idx][0];
+		if (field_types[idx][1] == 2)
+		{
+			lpp[len++] = (reading.values[idx] >> 8) & 0xFF;
+		}
+		lpp[len++] = reading.values[idx] & 0xFF;
+	}
+	// Analog input, 12.34
+	uint8_t gas[] = {LPP_CHANNEL_GAS_2, 2, 0x04, 0xD2};
+	memcpy(&lpp[len], gas, sizeof(gas));
+	return len + sizeof(gas);
+}
+
+/**
+ * @brief Value as it is expected in the compact packet
+ *        Offset removed and limited to the bits of the field
+ *
+ */
+static int32_t expected_code(uint8_t idx, int32_t value)
+{
+	uint8_t bits = compact_fields[idx].bits;
+	int32_t code = value - compact_fields[idx].offset;
+	int32_t min_code = compact_fields[idx].is_signed ? -(1 << (bits - 1)) : 0;
+	int32_t max_code = compact_fields[idx].is_signed ? (1 << (bits - 1)) - 1 : (1 << bits) - 1;
+	return code < min_code ? min_code : (code > max_code ? max_code : code);
+}
+
+/**
+ * @brief Random reading, each value is missing with the given probability
+ *
+ */
+static void random_reading(reading_s &reading, uint8_t missing_percent)
+{
+	reading.bitmap = 0;
+	for (uint8_t idx = 0; idx < compact_fields_num; idx++)
+	{
+		int32_t range = field_ranges[idx][1] - field_ranges[idx][0] + 1;
+		reading.values[idx] = field_ranges[idx][0] + (int32_t)(rng() % range);
+		if ((rng() % 100) >= missing_percent)
+		{
+			reading.bitmap |= 1 << idx;
+		}
+	}
+}
+
+/**
+ * @brief Read bits from the packet, MSB first, like BitReader of the decoder
+ *
+ */
+static bool read_bits(const uint8_t *packet, uint8_t len, uint16_t *pos, uint8_t bits, uint32_t *value)
+{
+	*value = 0;
+	for (uint8_t bit = 0; bit < bits; bit++, (*pos)++)
+	{
+		if (*pos / 8 >= len)
+		{
+			return false;
+		}
+		*value = (*value << 1) | ((packet[*pos / 8] >> (7 - (*pos % 8))) & 1);
+	}
+	return true;
+}
+
+static int32_t sign_extend(uint32_t value, uint8_t bits)
+{
+	return value >= (1UL << (bits - 1)) ? (int32_t)value - (1L << bits) : (int32_t)value;
+}
+
+/**
+ * @brief Decode a compact packet, same logic as decodeCompact() of decoders/compact_decoder.js
+ *
+ * @param packet compact packet
+ * @param len packet size
+ * @param reference decoded reference packet, only used for difference packets
+ * @param result decoded packet
+ * @return true if the packet could be decoded
+ */
+static bool decode_compact(const uint8_t *packet, uint8_t len, const decoded_s *reference, decoded_s *result)
+{
+	uint16_t pos = 8;
+	uint32_t value;
+
+	if ((len < 3) || ((packet[0] >> 6) != COMPACT_VERSION))
+	{
+		return false;
+	}
+	result->seq = packet[0] & 0x0F;
+	result->delta = (packet[0] & 0x20) != 0;
+	if (result->delta)
+	{
+		read_bits(packet, len, &pos, 8, &value);
+		result->ref_seq = value & 0x0F;
+		if ((reference == NULL) || (reference->seq != result->ref_seq))
+		{
+			return false;
+		}
+	}
+	if (!read_bits(packet, len, &pos, 16, &value))
+	{
+		return false;
+	}
+	result->bitmap = value;
+
+	for (uint8_t idx = 0; idx < compact_fields_num; idx++)
+	{
+		if ((result->bitmap & (1 << idx)) == 0)
+		{
+			continue;
+		}
+		uint8_t bits = compact_fields[idx].bits;
+		uint32_t encoding = COMPACT_DELTA_FULL;
+		if (result->delta && !read_bits(packet, len, &pos, 2, &encoding))
+		{
+			return false;
+		}
+		if (result->delta)
+		{
+			encodings[encoding]++;
+		}
+		if (encoding == COMPACT_DELTA_FULL)
+		{
+			if (!read_bits(packet, len, &pos, bits, &value))
+			{
+				return false;
+			}
+			result->codes[idx] = compact_fields[idx].is_signed ? sign_extend(value, bits) : (int32_t)value;
+			continue;
+		}
+		if ((reference->bitmap & (1 << idx)) == 0)
+		{
+			return false;
+		}
+		uint32_t zigzag = 0;
+		if ((encoding != COMPACT_DELTA_SAME) && !read_bits(packet, len, &pos, encoding == COMPACT_DELTA_4 ? 4 : 8, &zigzag))
+		{
+			return false;
+		}
+		int32_t diff = (zigzag & 1) ? -(int32_t)((zigzag + 1) >> 1) : (int32_t)(zigzag >> 1);
+		result->codes[idx] = reference->codes[idx] + diff;
+	}
+	// Only fill bits are left
+	return (pos + 7) / 8 == len;
+}
+
+/**
+ * @brief Compare the decoded packet with the reading
+ *
+ */
+static void check_decoded(const reading_s &reading, const decoded_s &decoded)
+{
+	TEST_ASSERT_EQUAL_HEX32(reading.bitmap, decoded.bitmap);
+	for (uint8_t idx = 0; idx < compact_fields_num; idx++)
+	{
+		if (reading.bitmap & (1 << idx))
+		{
+			TEST_ASSERT_EQUAL_INT32(expected_code(idx, reading.values[idx]), decoded.codes[idx]);
+		}
+	}
+}
+
+/**
+ * @brief The field table of the reference decoder matches compact_fields[]
+ *
+ */
+void test_decoder_fields(void)
+{
+	std::string path = __FILE__;
+	size_t slash = path.find_last_of("/\\");
+	path = (slash == std::string::npos) ? std::string(".") : path.substr(0, slash);
+	path += "/../../decoders/compact_decoder.js";
+	FILE *file = fopen(path.c_str(), "r");
+	TEST_ASSERT_NOT_NULL(file);
+
+	char line[200];
+	bool in_fields = false;
+	uint8_t idx = 0;
+	while (fgets(line, sizeof(line), file) != NULL)
+	{
+		if (strstr(line, "var FIELDS = [") != NULL)
+		{
+			in_fields = true;
+			continue;
+		}
+		if (!in_fields)
+		{
+			continue;
+		}
+		if (strstr(line, "];") != NULL)
+		{
+			break;
+		}
+		char name[32];
+		int bits;
+		char is_signed[8];
+		int offset;
+		TEST_ASSERT_EQUAL_INT(4, sscanf(line, " [\"%31[^\"]\", %d, %7[a-z], %d,", name, &bits, is_signed, &offset));
+		TEST_ASSERT_LESS_THAN(compact_fields_num, idx);
+		// Names end with the Cayenne LPP channel
+		TEST_ASSERT_EQUAL_INT(compact_fields[idx].channel, atoi(strrchr(name, '_') + 1));
+		TEST_ASSERT_EQUAL_INT(compact_fields[idx].bits, bits);
+		TEST_ASSERT_EQUAL(compact_fields[idx].is_signed, strcmp(is_signed, "true") == 0);
+		TEST_ASSERT_EQUAL_INT(compact_fields[idx].offset, offset);
+		idx++;
+	}
+	fclose(file);
+	TEST_ASSERT_EQUAL_UINT8(compact_fields_num, idx);
+}
+
+/**
+ * @brief Absolute packets with random values and random missing values
+ *
+ */
+void test_absolute_round_trip(void)
+{
+	uint8_t lpp[128];
+	uint8_t packet[COMPACT_SIZE_MAX];
+	reading_s reading;
+	decoded_s decoded;
+
+	for (uint16_t count = 0; count < 1000; count++)
+	{
+		random_reading(reading, count < 10 ? 0 : 30);
+		uint8_t lpp_len = make_lpp(reading, lpp);
+		uint8_t len = encode_compact(lpp, lpp_len, packet);
+		TEST_ASSERT_EQUAL_UINT8((8 + 16 + compact_bits(reading.bitmap) + 7) / 8, len);
+		TEST_ASSERT_LESS_OR_EQUAL(COMPACT_SIZE_MAX, len);
+		TEST_ASSERT_FALSE(compact_needs_ack());
+
+		TEST_ASSERT_TRUE(decode_compact(packet, len, NULL, &decoded));
+		TEST_ASSERT_FALSE(decoded.delta);
+		TEST_ASSERT_EQUAL_UINT8((count + 1) & COMPACT_HDR_SEQ, decoded.seq);
+		check_decoded(reading, decoded);
+	}
+}
+
+/**
+ * @brief Values outside of the range of a field are limited
+ *
+ */
+void test_limits(void)
+{
+	uint8_t lpp[128];
+	uint8_t packet[COMPACT_SIZE_MAX];
+	reading_s reading;
+	decoded_s decoded;
+
+	random_reading(reading, 0);
+	reading.values[2] = -2000; // -200 °C
+	reading.values[6] = 1500;  // 150 °C
+	reading.values[3] = 2000;  // 200 hPa, below the offset
+	reading.values[7] = 13000; // 1300 hPa
+	reading.values[10] = 20000;
+	reading.values[11] = 2000;
+	uint8_t len = encode_compact(lpp, make_lpp(reading, lpp), packet);
+	TEST_ASSERT_TRUE(decode_compact(packet, len, NULL, &decoded));
+	TEST_ASSERT_EQUAL_INT32(-1024, decoded.codes[2]);
+	TEST_ASSERT_EQUAL_INT32(1023, decoded.codes[6]);
+	TEST_ASSERT_EQUAL_INT32(0, decoded.codes[3]);
+	TEST_ASSERT_EQUAL_INT32(8191, decoded.codes[7]);
+	TEST_ASSERT_EQUAL_INT32(16383, decoded.codes[10]);
+	TEST_ASSERT_EQUAL_INT32(1023, decoded.codes[11]);
+	check_decoded(reading, decoded);
+}
+
+/**
+ * @brief Difference packets over a link that loses packets and ACKs
+ *        The values change slowly with some jumps, values can be missing.
+ *        Every received packet is decoded with the reference the server has.
+ *
+ */
+void test_delta_round_trip(void)
+{
+	uint8_t lpp[128];
+	uint8_t packet[COMPACT_SIZE_MAX];
+	reading_s reading;
+	decoded_s server[16];
+	bool server_has[16] = {false};
+	uint32_t delta_packets = 0;
+	uint32_t received_packets = 0;
+
+	reset_encoder(PAYLOAD_DELTA);
+	random_reading(reading, 0);
+
+	for (uint16_t count = 0; count < 2000; count++)
+	{
+		// Random walk, mostly small changes
+		reading.bitmap = 0;
+		for (uint8_t idx = 0; idx < compact_fields_num; idx++)
+		{
+			uint32_t change = rng() % 100;
+			int32_t step = 0;
+			if (change >= 95)
+			{
+				step = (int32_t)(rng() % 2000) - 1000;
+			}
+			else if (change >= 80)
+			{
+				step = (int32_t)(rng() % 255) - 127;
+			}
+			else if (change >= 50)
+			{
+				step = (int32_t)(rng() % 15) - 7;
+			}
+			int32_t value = reading.values[idx] + step;
+			int32_t min_value = field_ranges[idx][0];
+			int32_t max_value = field_ranges[idx][1];
+			reading.values[idx] = value < min_value ? min_value : (value > max_value ? max_value : value);
+			if ((rng() % 100) >= 5)
+			{
+				reading.bitmap |= 1 << idx;
+			}
+		}
+
+		uint8_t len = encode_compact(lpp, make_lpp(reading, lpp), packet);
+		TEST_ASSERT_NOT_EQUAL(0, len);
+		TEST_ASSERT_LESS_OR_EQUAL(COMPACT_SIZE_MAX, len);
+
+		// LMH_BUSY, the packet is not enqueued and has no TX cycle
+		if ((rng() % 100) < 5)
+		{
+			continue;
+		}
+		bool confirmed = compact_needs_ack() || ((rng() % 31) == 0);
+		compact_tx_started(confirmed);
+
+		bool received = (rng() % 100) >= 15;
+		bool acked = confirmed && received && ((rng() % 100) >= 10);
+		if (received)
+		{
+			decoded_s decoded;
+			uint8_t seq = packet[0] & COMPACT_HDR_SEQ;
+			uint8_t ref_seq = packet[1] & COMPACT_HDR_SEQ;
+			bool delta = (packet[0] & COMPACT_HDR_DELTA) != 0;
+			// The reference of a difference packet was acknowledged, so the server has it
+			TEST_ASSERT_TRUE(!delta || server_has[ref_seq]);
+			TEST_ASSERT_TRUE(decode_compact(packet, len, delta ? &server[ref_seq] : NULL, &decoded));
+			check_decoded(reading, decoded);
+			server[seq] = decoded;
+			server_has[seq] = true;
+			received_packets++;
+			delta_packets += delta ? 1 : 0;
+		}
+		compact_tx_finished(confirmed ? acked : true);
+	}
+
+	char message[128];
+	snprintf(message, sizeof(message), "%lu received, %lu difference packets, same %lu, 4 bit %lu, 8 bit %lu, absolute %lu",
+			 (unsigned long)received_packets, (unsigned long)delta_packets, (unsigned long)encodings[COMPACT_DELTA_SAME],
+			 (unsigned long)encodings[COMPACT_DELTA_4], (unsigned long)encodings[COMPACT_DELTA_8], (unsigned long)encodings[COMPACT_DELTA_FULL]);
+	TEST_MESSAGE(message);
+	TEST_ASSERT_GREATER_THAN(received_packets / 2, delta_packets);
+	for (uint8_t encoding = 0; encoding < 4; encoding++)
+	{
+		TEST_ASSERT_GREATER_THAN(0, encodings[encoding]);
+	}
+}
+
+/**
+ * @brief Encode a reading and run a TX cycle
+ *
+ * @return bool true if the packet was a difference packet
+ */
+static bool send_reading(const reading_s &reading, bool enqueued, bool confirmed, bool acked)
+{
+	uint8_t lpp[128];
+	uint8_t packet[COMPACT_SIZE_MAX];
+	TEST_ASSERT_NOT_EQUAL(0, encode_compact(lpp, make_lpp(reading, lpp), packet));
+	if (enqueued)
+	{
+		compact_tx_started(confirmed);
+	}
+	compact_tx_finished(acked);
+	return (packet[0] & COMPACT_HDR_DELTA) != 0;
+}
+
+/**
+ * @brief Only an enqueued, confirmed and acknowledged packet becomes the reference
+ *        A reference is used for COMPACT_DELTA_MAX packets
+ *
+ */
+void test_reference(void)
+{
+	reading_s reading;
+	random_reading(reading, 0);
+	reset_encoder(PAYLOAD_DELTA);
+
+	// No ACK
+	TEST_ASSERT_FALSE(send_reading(reading, true, true, false));
+	TEST_ASSERT_TRUE(compact_needs_ack());
+	// Not enqueued, e.g. LMH_BUSY, the ACK belongs to another packet
+	TEST_ASSERT_FALSE(send_reading(reading, false, true, true));
+	// Unconfirmed
+	TEST_ASSERT_FALSE(send_reading(reading, true, false, true));
+	// Reference
+	TEST_ASSERT_FALSE(send_reading(reading, true, true, true));
+	uint32_t reference = packet_count;
+
+	while (packet_count - reference < COMPACT_DELTA_MAX)
+	{
+		TEST_ASSERT_TRUE(send_reading(reading, true, false, true));
+		TEST_ASSERT_FALSE(compact_needs_ack());
+	}
+	// Too old, absolute packet that has to be acknowledged
+	TEST_ASSERT_FALSE(send_reading(reading, true, true, true));
+	TEST_ASSERT_TRUE(compact_needs_ack());
+	TEST_ASSERT_TRUE(send_reading(reading, true, false, true));
+
+	// PAYLOAD_COMPACT does not use references
+	g_payload_format = PAYLOAD_COMPACT;
+	TEST_ASSERT_FALSE(send_reading(reading, true, false, true));
+	TEST_ASSERT_FALSE(compact_needs_ack());
+}
+
+/**
+ * @brief Cayenne LPP packets with an unknown data type are not converted
+ *
+ */
+void test_unknown_type(void)
+{
+	uint8_t lpp[] = {LPP_CHANNEL_TEMP, 103, 0x00, 0xE6, 10, 136, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	uint8_t packet[COMPACT_SIZE_MAX];
+	TEST_ASSERT_EQUAL_UINT8(0, encode_compact(lpp, sizeof(lpp), packet));
+	// Truncated value
+	TEST_ASSERT_EQUAL_UINT8(0, encode_compact(lpp, 3, packet));
+}
+
+/**
+ * @brief Packet sizes and encode time with all sensors installed
+ *
+ */
+void test_benchmark(void)
+{
+	uint8_t lpp[128];
+	uint8_t packet[COMPACT_SIZE_MAX];
+	reading_s reading;
+	random_reading(reading, 0);
+	uint8_t lpp_len = make_lpp(reading, lpp) - 4;
+
+	reset_encoder(PAYLOAD_COMPACT);
+	uint8_t compact_len = encode_compact(lpp, lpp_len, packet);
+
+	// Difference packet with small changes
+	reset_encoder(PAYLOAD_DELTA);
+	encode_compact(lpp, lpp_len, packet);
+	compact_tx_started(true);
+	compact_tx_finished(true);
+	reading.values[1] += 2;
+	reading.values[2] -= 3;
+	reading.values[10] += 40;
+	reading.values[12] += 1;
+	lpp_len = make_lpp(reading, lpp) - 4;
+	uint8_t delta_len = encode_compact(lpp, lpp_len, packet);
+	TEST_ASSERT_TRUE((packet[0] & COMPACT_HDR_DELTA) != 0);
+
+	const uint32_t runs = 100000;
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t run = 0; run < runs; run++)
+	{
+		lpp[3] = run & 0xFF;
+		encode_compact(lpp, lpp_len, packet);
+	}
+	auto end = std::chrono::steady_clock::now();
+	double encode_us = std::chrono::duration<double, std::micro>(end - start).count() / runs;
+
+	char message[128];
+	snprintf(message, sizeof(message), "Cayenne LPP %d bytes, compact %d bytes, difference %d bytes, encode %.3f us",
+			 lpp_len, compact_len, delta_len, encode_us);
+	TEST_MESSAGE(message);
+	TEST_ASSERT_LESS_THAN(lpp_len / 2, compact_len);
+	TEST_ASSERT_LESS_THAN(compact_len, delta_len);
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_decoder_fields);
+	RUN_TEST(test_absolute_round_trip);
+	RUN_TEST(test_limits);
+	RUN_TEST(test_delta_round_trip);
+	RUN_TEST(test_reference);
+	RUN_TEST(test_unknown_type);
+	RUN_TEST(test_benchmark);
+	return UNITY_END();
+}
@@ -0,0 +1,512 @@
+/**
+ * @file test_epd_partial.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the drawing functions of the EPD driver
+ *        The fast functions write directly into the display buffer. Each
+ *        is compared with the Adafruit GFX function it replaces, drawn
+ *        into a second display, in all rotations. The compressed images
+ *        are compared with the uncompressed images in assets/bitmaps.
+ *        The benchmark prints the time of a bar graph, draw_bars() against
+ *        the drawLine() loop it replaced.
+ *        Refreshes of unchanged frames are skipped. A frame started from
+ *        the template is the same as a full redraw. The display is only
+ *        initialized after a power down.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "../../src/ui/epd_partial.cpp"
+#include "../../src/ui/RAK14000_bitmaps.cpp"
+
+/** Display drawn with the fast functions */
+PartialEPD display(300, 400, -1, -1, -1, -1, -1, -1, -1, -1);
+/** Display drawn with the GFX functions */
+PartialEPD reference(300, 400, -1, -1, -1, -1, -1, -1, -1, -1);
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/**
+ * @brief Clear both displays and set the rotation
+ *
+ * @param rotation display rotation
+ * @param bg background color
+ */
+static void start_frame(uint8_t rotation, uint16_t bg)
+{
+	display.setRotation(rotation);
+	reference.setRotation(rotation);
+	display.fillRect(0, 0, display.width(), display.height(), bg);
+	reference.fillRect(0, 0, reference.width(), reference.height(), bg);
+}
+
+/**
+ * @brief Compare both displays pixel by pixel
+ *
+ */
+static void check_frames(const char *what, uint8_t rotation)
+{
+	char message[128];
+	for (int16_t y = 0; y < display.height(); y++)
+	{
+		for (int16_t x = 0; x < display.width(); x++)
+		{
+			if (display.get_pixel(x, y) != reference.get_pixel(x, y))
+			{
+				snprintf(message, sizeof(message), "%s: rotation %d pixel %d/%d differs", what, rotation, x, y);
+				TEST_FAIL_MESSAGE(message);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Draw bars with draw_bars() and with drawFastVLine()
+ *
+ */
+static void draw_bars_both(int16_t x, int16_t step, int16_t bottom, const int16_t *tops, uint16_t count, uint16_t color)
+{
+	display.draw_bars(x, step, bottom, tops, count, color);
+	for (uint16_t idx = 0; idx < count; idx++)
+	{
+		if (tops[idx] <= bottom)
+		{
+			reference.drawFastVLine(x + idx * step, tops[idx], bottom - tops[idx] + 1, color);
+		}
+	}
+}
+
+/**
+ * @brief Bar graphs like the VOC and CO2 graphs
+ *
+ */
+void test_draw_bars(void)
+{
+	int16_t tops[100];
+	for (uint16_t idx = 0; idx < 100; idx++)
+	{
+		tops[idx] = 60 + (idx * 37) % 90;
+	}
+	// Bars that are not drawn, CO2 below 200 ppm
+	tops[10] = INT16_MAX;
+	tops[11] = 200;
+
+	for (uint8_t rotation = 0; rotation < 4; rotation++)
+	{
+		start_frame(rotation, EPD_WHITE);
+		draw_bars_both(0, 2, 150, tops, 100, EPD_BLACK);
+		// Step 1 and 3, bars start inside a byte
+		draw_bars_both(5, 1, 200, tops, 60, EPD_BLACK);
+		draw_bars_both(3, 3, 280, tops + 40, 60, EPD_BLACK);
+		check_frames("bars", rotation);
+	}
+}
+
+/**
+ * @brief Bars that are partly outside of the display are clipped
+ *
+ */
+void test_draw_bars_clipped(void)
+{
+	int16_t tops[100];
+	for (uint16_t idx = 0; idx < 100; idx++)
+	{
+		tops[idx] = -20 + (idx * 53) % 120;
+	}
+
+	for (uint8_t rotation = 0; rotation < 4; rotation++)
+	{
+		start_frame(rotation, EPD_WHITE);
+		// Left of the display
+		draw_bars_both(-30, 2, 80, tops, 100, EPD_BLACK);
+		// Right and below the display
+		draw_bars_both(display.width() - 50, 2, display.height() + 10, tops, 100, EPD_BLACK);
+		check_frames("clipped bars", rotation);
+	}
+}
+
+/**
+ * @brief White bars on black background, inverted display colors
+ *
+ */
+void test_draw_bars_white(void)
+{
+	int16_t tops[50];
+	for (uint16_t idx = 0; idx < 50; idx++)
+	{
+		tops[idx] = 100 + (idx * 11) % 80;
+	}
+
+	for (uint8_t rotation = 0; rotation < 4; rotation++)
+	{
+		start_frame(rotation, EPD_BLACK);
+		draw_bars_both(7, 2, 199, tops, 50, EPD_WHITE);
+		check_frames("white bars", rotation);
+	}
+}
+
+/** Number of graphs drawn for the benchmark */
+#define BENCH_RUNS 200
+
+/**
+ * @brief Time of a bar graph with draw_bars() and with the drawLine() loop used before
+ *        Graphs with 100 and 400 columns in both landscape rotations
+ *
+ */
+void test_draw_bars_benchmark(void)
+{
+	static int16_t tops[400];
+	for (uint16_t idx = 0; idx < 400; idx++)
+	{
+		tops[idx] = 150 + (idx * 37) % 90;
+	}
+	const int16_t bottom = 240;
+	uint16_t columns[][2] = {{100, 2}, {400, 1}};
+
+	char message[128];
+	for (uint8_t rotation = 1; rotation < 4; rotation += 2)
+	{
+		for (auto &graph : columns)
+		{
+			uint16_t count = graph[0];
+			int16_t step = graph[1];
+			start_frame(rotation, EPD_WHITE);
+
+			auto start = std::chrono::steady_clock::now();
+			for (uint16_t run = 0; run < BENCH_RUNS; run++)
+			{
+				display.draw_bars(0, step, bottom, tops, count, EPD_BLACK);
+			}
+			auto end = std::chrono::steady_clock::now();
+			double bars_us = std::chrono::duration<double, std::micro>(end - start).count() / BENCH_RUNS;
+
+			start = std::chrono::steady_clock::now();
+			for (uint16_t run = 0; run < BENCH_RUNS; run++)
+			{
+				// Old code of voc_rak14000() and co2_rak14000()
+				for (uint16_t idx = 0; idx < count; idx++)
+				{
+					reference.drawLine(idx * step, tops[idx], idx * step, bottom, EPD_BLACK);
+				}
+			}
+			end = std::chrono::steady_clock::now();
+			double lines_us = std::chrono::duration<double, std::micro>(end - start).count() / BENCH_RUNS;
+
+			check_frames("benchmark bars", rotation);
+			snprintf(message, sizeof(message), "Rotation %d, %d columns: draw_bars %.1f us, drawLine loop %.1f us",
+					 rotation, count, bars_us, lines_us);
+			TEST_MESSAGE(message);
+			TEST_ASSERT_LESS_THAN(lines_us, bars_us);
+		}
+	}
+}
+
+/**
+ * @brief Compress a bitmap with PackBits, like compress_bitmaps.py
+ *        Starts with a no-op header 128, draw_packed() has to skip it
+ *
+ * @param raw uncompressed bitmap
+ * @return std::vector<uint8_t> compressed bitmap
+ */
+static std::vector<uint8_t> pack_bits(const std::vector<uint8_t> &raw)
+{
+	std::vector<uint8_t> packed = {128};
+	size_t pos = 0;
+	while (pos < raw.size())
+	{
+		size_t run = 1;
+		while ((pos + run < raw.size()) && (run < 128) && (raw[pos + run] == raw[pos]))
+		{
+			run++;
+		}
+		if (run > 1)
+		{
+			packed.push_back(257 - run);
+			packed.push_back(raw[pos]);
+			pos += run;
+			continue;
+		}
+		size_t literal = 1;
+		while ((pos + literal < raw.size()) && (literal < 128) &&
+			   ((pos + literal + 1 >= raw.size()) || (raw[pos + literal] != raw[pos + literal + 1])))
+		{
+			literal++;
+		}
+		packed.push_back(literal - 1);
+		packed.insert(packed.end(), raw.begin() + pos, raw.begin() + pos + literal);
+		pos += literal;
+	}
+	return packed;
+}
+
+/**
+ * @brief Read an uncompressed image from assets/bitmaps
+ *
+ * @param name image name
+ * @param w expected width
+ * @param h expected height
+ * @return std::vector<uint8_t> pixel data, empty if the image could not be read
+ */
+static std::vector<uint8_t> read_asset(const char *name, int16_t w, int16_t h)
+{
+	std::string path = __FILE__;
+	size_t slash = path.find_last_of("/\\");
+	path = (slash == std::string::npos) ? std::string(".") : path.substr(0, slash);
+	path += std::string("/../../assets/bitmaps/") + name + ".pbm";
+
+	std::vector<uint8_t> image((w + 7) / 8 * h);
+	FILE *file = fopen(path.c_str(), "rb");
+	if (file == NULL)
+	{
+		return std::vector<uint8_t>();
+	}
+	int file_w = 0;
+	int file_h = 0;
+	bool ok = (fscanf(file, "P4 %d %d", &file_w, &file_h) == 2) && (fgetc(file) == '\n') &&
+			  (file_w == w) && (file_h == h) &&
+			  (fread(image.data(), 1, image.size(), file) == image.size());
+	fclose(file);
+	return ok ? image : std::vector<uint8_t>();
+}
+
+/**
+ * @brief Draw a bitmap with draw_packed() and with drawBitmap() at several positions
+ *        Centered, at odd positions inside a byte and clipped at all edges
+ *
+ */
+static void check_packed(const char *what, const uint8_t *packed, const uint8_t *raw, int16_t w, int16_t h, uint16_t color, uint16_t bg)
+{
+	for (uint8_t rotation = 0; rotation < 4; rotation++)
+	{
+		start_frame(rotation, bg);
+		int16_t positions[][2] = {
+			{(int16_t)((display.width() - w) / 2), (int16_t)((display.height() - h) / 2)},
+			{3, 5},
+			{-5, -3},
+			{(int16_t)(display.width() - w + 7), (int16_t)(display.height() - h + 2)},
+			{(int16_t)(display.width() - 4), 11},
+		};
+		for (auto &position : positions)
+		{
+			display.draw_packed(position[0], position[1], packed, w, h, color);
+			reference.drawBitmap(position[0], position[1], raw, w, h, color);
+		}
+		check_frames(what, rotation);
+	}
+}
+
+/**
+ * @brief The compressed images are drawn like the uncompressed images in assets/bitmaps
+ *
+ */
+void test_draw_packed_images(void)
+{
+	struct
+	{
+		const char *name;
+		const uint8_t *packed;
+		int16_t w;
+		int16_t h;
+	} images[] = {
+		{"good_air", good_air, (int16_t)good_air_width, (int16_t)good_air_height},
+		{"bad_air", bad_air, (int16_t)bad_air_width, (int16_t)bad_air_height},
+		{"worried_air", worried_air, (int16_t)worried_air_width, (int16_t)worried_air_height},
+		{"rak_img", rak_img, (int16_t)rak_img_width, (int16_t)rak_img_height},
+		{"built_img", built_img, (int16_t)built_img_width, (int16_t)built_img_height},
+		{"wisblock_img", wisblock_img, (int16_t)wisblock_width, (int16_t)wisblock_height},
+	};
+
+	for (auto &image : images)
+	{
+		std::vector<uint8_t> raw = read_asset(image.name, image.w, image.h);
+		TEST_ASSERT_TRUE_MESSAGE(!raw.empty(), image.name);
+		check_packed(image.name, image.packed, raw.data(), image.w, image.h, EPD_BLACK, EPD_WHITE);
+	}
+}
+
+/**
+ * @brief Test patterns with odd widths, literal and repeat runs, both colors
+ *
+ */
+void test_draw_packed_patterns(void)
+{
+	int16_t sizes[][2] = {{13, 9}, {21, 17}, {8, 5}, {64, 30}, {1, 40}};
+	for (auto &size : sizes)
+	{
+		int16_t w = size[0];
+		int16_t h = size[1];
+		std::vector<uint8_t> raw((w + 7) / 8 * h);
+		for (size_t idx = 0; idx < raw.size(); idx++)
+		{
+			// Empty and full runs, then random bytes, also in the unused bits of the last byte of a row
+			if ((idx / 16) % 3 == 0)
+			{
+				raw[idx] = 0x00;
+			}
+			else if ((idx / 16) % 3 == 1)
+			{
+				raw[idx] = 0xFF;
+			}
+			else
+			{
+				raw[idx] = (uint8_t)((idx * 1103515245UL + 12345UL) >> 16);
+			}
+		}
+		std::vector<uint8_t> packed = pack_bits(raw);
+
+		char what[32];
+		snprintf(what, sizeof(what), "pattern %dx%d", w, h);
+		check_packed(what, packed.data(), raw.data(), w, h, EPD_BLACK, EPD_WHITE);
+		check_packed(what, packed.data(), raw.data(), w, h, EPD_WHITE, EPD_BLACK);
+	}
+}
+
+/**
+ * @brief Frames identical to the shown frame are skipped
+ *        Changed frames are sent with a partial refresh of the changed lines
+ *
+ */
+void test_refresh_skip(void)
+{
+	display.setRotation(1);
+	display.fillRect(0, 0, display.width(), display.height(), EPD_WHITE);
+	TEST_ASSERT_TRUE(display.refresh(true));
+	uint32_t skips = display.skip_count;
+	uint32_t partials = display.partial_count;
+
+	TEST_ASSERT_FALSE(display.refresh());
+	TEST_ASSERT_EQUAL_UINT32(skips + 1, display.skip_count);
+
+	// One pixel, one display line is sent
+	display.drawPixel(150, 200, EPD_BLACK);
+	TEST_ASSERT_TRUE(display.refresh());
+	TEST_ASSERT_EQUAL_UINT32(partials + 1, display.partial_count);
+	TEST_ASSERT_EQUAL_UINT32(display.width() / 8, display.last_bytes);
+	TEST_ASSERT_FALSE(display.refresh());
+
+	// Pixel drawn and cleared again
+	display.drawPixel(10, 10, EPD_BLACK);
+	display.drawPixel(10, 10, EPD_WHITE);
+	TEST_ASSERT_FALSE(display.refresh());
+
+	// The last pixel of the buffer is compared as well
+	display.drawPixel(display.width() - 1, display.height() - 1, EPD_BLACK);
+	TEST_ASSERT_TRUE(display.refresh());
+	TEST_ASSERT_EQUAL_UINT32(skips + 3, display.skip_count);
+}
+
+/**
+ * @brief Draw the static part of a test screen
+ *
+ */
+static void draw_static(void)
+{
+	display.fillRect(0, 0, display.width(), display.height(), EPD_WHITE);
+	display.drawRect(5, 5, 120, 60, EPD_BLACK);
+	display.drawFastHLine(0, 100, display.width(), EPD_BLACK);
+	display.drawFastVLine(200, 0, display.height(), EPD_BLACK);
+}
+
+/**
+ * @brief Draw the values of a test screen
+ *
+ * @param value changes the size of the drawn value
+ */
+static void draw_values(int16_t value)
+{
+	display.fillRect(20, 20, value, 10, EPD_BLACK);
+	display.drawLine(220, 150, 220 + value, 150 + value, EPD_BLACK);
+}
+
+/**
+ * @brief A frame started from the template equals a full redraw
+ *        Values of the older frame are not left in the new frame
+ *
+ */
+void test_template(void)
+{
+	display.setRotation(1);
+	draw_static();
+	display.store_template(1);
+	TEST_ASSERT_FALSE(display.restore_template(2));
+
+	// Full redraw is the shown frame
+	draw_static();
+	draw_values(40);
+	TEST_ASSERT_TRUE(display.refresh(true));
+
+	// Same values drawn on the template, nothing to refresh
+	TEST_ASSERT_TRUE(display.restore_template(1));
+	draw_values(40);
+	TEST_ASSERT_FALSE(display.refresh());
+
+	// Other values, the old ones are removed by the template
+	TEST_ASSERT_TRUE(display.restore_template(1));
+	draw_values(80);
+	TEST_ASSERT_TRUE(display.refresh());
+	draw_static();
+	draw_values(80);
+	TEST_ASSERT_FALSE(display.refresh());
+
+	// Template of another layout replaces the old one
+	display.fillRect(0, 0, display.width(), display.height(), EPD_WHITE);
+	display.store_template(2);
+	TEST_ASSERT_FALSE(display.restore_template(1));
+	TEST_ASSERT_TRUE(display.restore_template(2));
+}
+
+/**
+ * @brief The display is only reset and initialized after a power down
+ *        The time of the reset is counted as blocked time
+ *
+ */
+void test_refresh_power_up(void)
+{
+	PartialEPD epd(300, 400, -1, -1, -1, -1, -1, -1, -1, -1);
+	epd.setRotation(1);
+
+	uint32_t blocked = epd.total_blocked;
+	TEST_ASSERT_TRUE(epd.refresh(true));
+	TEST_ASSERT_EQUAL_UINT32(1, epd.mock_power_ups);
+	TEST_ASSERT_GREATER_OR_EQUAL(100, epd.last_time);
+	TEST_ASSERT_GREATER_OR_EQUAL(blocked + 100, epd.total_blocked);
+
+	// Partial and full refreshes of the powered display
+	for (uint8_t frame = 0; frame < EPD_FULL_REFRESH_CYCLE + 2; frame++)
+	{
+		epd.drawPixel(frame, 20, EPD_BLACK);
+		TEST_ASSERT_TRUE(epd.refresh());
+		TEST_ASSERT_LESS_THAN(100, epd.last_time);
+	}
+	TEST_ASSERT_TRUE(epd.refresh(true));
+	TEST_ASSERT_EQUAL_UINT32(1, epd.mock_power_ups);
+
+	// After a power down the display is initialized again
+	epd.powerDown();
+	epd.drawPixel(50, 50, EPD_BLACK);
+	blocked = epd.total_blocked;
+	TEST_ASSERT_TRUE(epd.refresh());
+	TEST_ASSERT_EQUAL_UINT32(2, epd.mock_power_ups);
+	TEST_ASSERT_GREATER_OR_EQUAL(blocked + 100, epd.total_blocked);
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_draw_bars);
+	RUN_TEST(test_draw_bars_clipped);
+	RUN_TEST(test_draw_bars_white);
+	RUN_TEST(test_draw_bars_benchmark);
+	RUN_TEST(test_draw_packed_images);
+	RUN_TEST(test_draw_packed_patterns);
+	RUN_TEST(test_refresh_skip);
+	RUN_TEST(test_template);
+	RUN_TEST(test_refresh_power_up);
+	return UNITY_END();
+}
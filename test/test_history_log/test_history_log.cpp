@@ -0,0 +1,291 @@
+/**
+ * @file test_history_log.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the persistent history log
+ *        The log is written to the RAM file system of the mocks. A reset
+ *        is simulated by clearing the value history and the state of the
+ *        log, the files stay.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include "../../src/tools/history_log.cpp"
+
+// Value history as in RAK14000_epd.cpp
+TieredHistory<num_values> voc_values(1.0, 0.0);
+QuantizedSeries<num_values> temp_values(0.01, 0.0);
+QuantizedSeries<num_values> humid_values(0.1, 0.0);
+QuantizedSeries<num_values> baro_values(0.1, 1000.0);
+TieredHistory<num_values, true> co2_values(1.0, 0.0);
+QuantizedSeries<num_values> pm10_values(1.0, 0.0);
+QuantizedSeries<num_values> pm25_values(1.0, 0.0);
+QuantizedSeries<num_values> pm100_values(1.0, 0.0);
+QuantizedSeries<num_values> light_values(1.0, 32768.0);
+uint32_t g_history_time_offset = 0;
+bool has_rak12002 = false;
+
+/** Time of the first record */
+#define START_TIME 1000
+
+/**
+ * @brief Simulate a reset, RAM is cleared, the files stay
+ *
+ */
+static void reset_device(void)
+{
+	voc_values = TieredHistory<num_values>(1.0, 0.0);
+	temp_values = QuantizedSeries<num_values>(0.01, 0.0);
+	co2_values = TieredHistory<num_values, true>(1.0, 0.0);
+	g_history_time_offset = 0;
+
+	log_batch_num = 0;
+	log_segment = HIST_SEG_NUM - 1;
+	log_sequence = 0;
+	log_segment_size = 0;
+	log_new_segment = true;
+	log_tiers_changed = false;
+}
+
+void setUp(void)
+{
+	mock_fs_files.clear();
+	reset_device();
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief Add temperature records with the codes first ... first + count - 1
+ *
+ */
+static void add_temp(int16_t first, uint16_t count)
+{
+	for (uint16_t idx = 0; idx < count; idx++)
+	{
+		temp_values.push_code(first + idx);
+		add_history_log(HIST_TEMP, first + idx, START_TIME + first + idx);
+	}
+}
+
+/**
+ * @brief Check that the temperature history ends with the codes first ... last
+ *
+ */
+static void check_temp(int16_t first, int16_t last)
+{
+	uint16_t expected = last - first + 1;
+	if (expected > num_values)
+	{
+		first = last - num_values + 1;
+		expected = num_values;
+	}
+	TEST_ASSERT_EQUAL_UINT16(expected, temp_values.size());
+	for (uint16_t idx = 0; idx < expected; idx++)
+	{
+		TEST_ASSERT_EQUAL_INT16(first + idx, temp_values.code(idx));
+	}
+}
+
+/**
+ * @brief Check that all series of a tier are equal
+ *
+ */
+template <class H>
+static void check_tier(const H &expected, const H &restored, uint8_t tier)
+{
+	QuantizedRange<num_values> expected_range = expected.series(tier);
+	QuantizedRange<num_values> restored_range = restored.series(tier);
+	QuantizedIterator<num_values> it = restored_range.begin();
+	uint16_t count = 0;
+	for (float value : expected_range)
+	{
+		TEST_ASSERT_TRUE(it != restored_range.end());
+		TEST_ASSERT_EQUAL_FLOAT(value, *it);
+		++it;
+		count++;
+	}
+	TEST_ASSERT_TRUE(it == restored_range.end());
+	TEST_ASSERT_GREATER_THAN(0, count);
+}
+
+/**
+ * @brief Records written before a reset are replayed, the time stamps continue
+ *
+ */
+void test_replay(void)
+{
+	add_temp(0, 70);
+	// 6 records are still in the write buffer
+	flush_history_log();
+
+	reset_device();
+	init_history_log();
+
+	check_temp(0, 69);
+	TEST_ASSERT_EQUAL_UINT32(START_TIME + 69 + 1, g_history_time_offset);
+
+	// New records continue the same segment
+	add_temp(70, 10);
+	flush_history_log();
+	TEST_ASSERT_EQUAL(1, mock_fs_files.size());
+
+	reset_device();
+	init_history_log();
+	check_temp(0, 79);
+}
+
+/**
+ * @brief The oldest segment is reused when all segments are full
+ *        The replay still gets the newest records in the right order
+ *
+ */
+void test_segment_rotation(void)
+{
+	// More than fits into all segments
+	add_temp(0, 2000);
+	flush_history_log();
+
+	TEST_ASSERT_EQUAL(HIST_SEG_NUM, mock_fs_files.size());
+	for (auto &file : mock_fs_files)
+	{
+		TEST_ASSERT_LESS_OR_EQUAL(HIST_SEG_SIZE, file.second.size());
+	}
+
+	reset_device();
+	init_history_log();
+	check_temp(0, 1999);
+	TEST_ASSERT_EQUAL_UINT32(START_TIME + 1999 + 1, g_history_time_offset);
+}
+
+/**
+ * @brief A record that was only partly written ends the replay of its segment
+ *        New records go to a new segment, so they are replayed after the next reset
+ *
+ */
+void test_torn_record(void)
+{
+	add_temp(0, 64);
+	flush_history_log();
+
+	// Power loss while the last record was written
+	std::vector<uint8_t> &segment = mock_fs_files["HIST0"];
+	segment.resize(segment.size() - 3);
+
+	reset_device();
+	init_history_log();
+	check_temp(0, 62);
+
+	add_temp(63, 20);
+	flush_history_log();
+	TEST_ASSERT_EQUAL(2, mock_fs_files.size());
+
+	reset_device();
+	init_history_log();
+	check_temp(0, 82);
+}
+
+/**
+ * @brief Replay stops at a record with a wrong CRC
+ *
+ */
+void test_corrupted_record(void)
+{
+	add_temp(0, 40);
+	flush_history_log();
+
+	// Segment header is record 0, break record 31
+	mock_fs_files["HIST0"][32 * sizeof(history_record_s) + 2] ^= 0x01;
+
+	reset_device();
+	init_history_log();
+	check_temp(0, 30);
+}
+
+/**
+ * @brief Hourly and daily aggregates are saved when a slot closes and restored on reset
+ *        The log only holds the last samples, the older hours come from the tier file
+ *
+ */
+void test_tier_restore(void)
+{
+	uint32_t now = START_TIME;
+
+	// 14 days, one CO2 sample every 10 minutes, as set_co2_rak14000() does
+	for (uint16_t count = 0; count < 14 * 144; count++)
+	{
+		if (co2_values.push(450.0 + (count * 37) % 400, now))
+		{
+			history_tiers_changed();
+		}
+		add_history_log(HIST_CO2, co2_values.latest_code(), now);
+		now += 600;
+	}
+	flush_history_log();
+	TEST_ASSERT_TRUE(mock_fs_files.count(tier_name) == 1);
+	TEST_ASSERT_FALSE(log_tiers_changed);
+
+	TieredHistory<num_values, true> expected = co2_values;
+
+	reset_device();
+	init_history_log();
+
+	check_tier(expected, co2_values, TIER_RAW);
+	check_tier(expected, co2_values, TIER_HOUR);
+	check_tier(expected, co2_values, TIER_DAY);
+	TEST_ASSERT_EQUAL_UINT32(expected.tier(TIER_HOUR).last_slot(), co2_values.tier(TIER_HOUR).last_slot());
+	TEST_ASSERT_EQUAL_UINT32(expected.tier(TIER_DAY).last_slot(), co2_values.tier(TIER_DAY).last_slot());
+	TEST_ASSERT_EQUAL_FLOAT(expected.min_value(TIER_DAY), co2_values.min_value(TIER_DAY));
+	TEST_ASSERT_EQUAL_FLOAT(expected.max_value(TIER_DAY), co2_values.max_value(TIER_DAY));
+
+	// Without the tier file the oldest days are lost
+	InternalFS.remove(tier_name);
+	reset_device();
+	init_history_log();
+	TEST_ASSERT_LESS_THAN(expected.tier(TIER_DAY).mean.size(), co2_values.tier(TIER_DAY).mean.size());
+}
+
+/**
+ * @brief A tier file with a wrong CRC is ignored, the log is still replayed
+ *
+ */
+void test_tier_corrupted(void)
+{
+	uint32_t now = START_TIME;
+
+	for (uint16_t count = 0; count < 30; count++)
+	{
+		if (voc_values.push(100 + count, now))
+		{
+			history_tiers_changed();
+		}
+		add_history_log(HIST_VOC, voc_values.latest_code(), now);
+		now += 900;
+	}
+	flush_history_log();
+	mock_fs_files[tier_name][sizeof(tier_header_s)] ^= 0x10;
+
+	TieredHistory<num_values> expected = voc_values;
+
+	reset_device();
+	init_history_log();
+
+	// The replay alone rebuilds the hours, nothing was added from the broken file
+	TEST_ASSERT_EQUAL_UINT16(30, voc_values.size());
+	check_tier(expected, voc_values, TIER_HOUR);
+	TEST_ASSERT_EQUAL_UINT16(0, voc_values.tier(TIER_DAY).mean.size());
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_replay);
+	RUN_TEST(test_segment_rotation);
+	RUN_TEST(test_torn_record);
+	RUN_TEST(test_corrupted_record);
+	RUN_TEST(test_tier_restore);
+	RUN_TEST(test_tier_corrupted);
+	return UNITY_END();
+}
@@ -0,0 +1,362 @@
+/**
+ * @file test_payload_packer.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the Cayenne LPP packer
+ *        Packets are sent with send_lora_packet() of the mocks in every region
+ *        and data rate. The values of all sent packets are collected, each value
+ *        of a reading has to arrive exactly once, in the order of the priority list.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include "../../src/tools/compact_payload.cpp"
+#include "../../src/tools/payload_packer.cpp"
+
+/** Values received by the server, per channel */
+static uint8_t received[256][6];
+/** Number of values received per channel */
+static uint8_t received_num[256];
+/** Number of sent packets */
+static uint16_t packets_num = 0;
+
+/** EU868 data rates */
+#define DR_51_BYTES 0
+#define DR_222_BYTES 5
+
+/** Values of a reading with all sensors, 42 bytes */
+static const uint8_t reading[] = {
+	LPP_CHANNEL_BATT, 116, 0x01, 0x86,
+	LPP_CHANNEL_HUMID, 104, 0x5A,
+	LPP_CHANNEL_TEMP, 103, 0x00, 0xD7,
+	LPP_CHANNEL_PRESS, 115, 0x27, 0x92,
+	LPP_CHANNEL_LIGHT, 101, 0x01, 0x2C,
+	LPP_CHANNEL_VOC, 138, 0x00, 0x64,
+	LPP_CHANNEL_CO2_2, 125, 0x02, 0x58,
+	LPP_CHANNEL_PM_1_0, 138, 0x00, 0x03,
+	LPP_CHANNEL_PM_2_5, 138, 0x00, 0x05,
+	LPP_CHANNEL_PM_10_0, 138, 0x00, 0x08,
+	LPP_CHANNEL_SWITCH, 102, 0x01};
+
+void setUp(void)
+{
+	mock_datarate = DR_222_BYTES;
+	mock_send_result = LMH_SUCCESS;
+	mock_send_max = 255;
+	g_lorawan_settings.lora_region = LORAMAC_REGION_EU868;
+	g_lorawan_settings.confirmed_msg_enabled = LMH_CONFIRMED_MSG;
+	g_lpp_priority[0] = LPP_CHANNEL_CO2_2;
+	g_lpp_priority[1] = LPP_CHANNEL_PM_2_5;
+	g_lpp_priority[2] = LPP_CHANNEL_VOC;
+	g_lpp_priority_num = 3;
+
+	// Drop the values deferred by the last test
+	while (send_lpp_deferred())
+	{
+	}
+	mock_send_count = 0;
+	mock_sent_len = 0;
+	memset(received_num, 0, sizeof(received_num));
+	packets_num = 0;
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief Collect the values of the last sent packet
+ *        Each channel may be received only once
+ *
+ */
+static void receive_packet(void)
+{
+	TEST_ASSERT_EQUAL_UINT8(LPP_FPORT, mock_sent_fport);
+	TEST_ASSERT_NOT_EQUAL(0, mock_sent_len);
+	uint8_t pos = 0;
+	while (pos < mock_sent_len)
+	{
+		int8_t size = lpp_size(mock_sent_data[pos + 1]);
+		TEST_ASSERT_GREATER_THAN(0, size);
+		TEST_ASSERT_LESS_OR_EQUAL(mock_sent_len, pos + 2 + size);
+		uint8_t channel = mock_sent_data[pos];
+		TEST_ASSERT_EQUAL_UINT8_MESSAGE(0, received_num[channel], "Channel received twice");
+		memcpy(received[channel], &mock_sent_data[pos], 2 + size);
+		received_num[channel]++;
+		pos += 2 + size;
+	}
+	packets_num++;
+}
+
+/**
+ * @brief Send the deferred values until nothing is left
+ *        Each packet has to fit the data rate and is sent unconfirmed
+ *
+ */
+static void receive_deferred(void)
+{
+	for (uint8_t packet = 0; packet < 20; packet++)
+	{
+		uint16_t send_count = mock_send_count;
+		g_lorawan_settings.confirmed_msg_enabled = LMH_CONFIRMED_MSG;
+		if (!send_lpp_deferred())
+		{
+			TEST_ASSERT_EQUAL_UINT16(send_count, mock_send_count);
+			return;
+		}
+		TEST_ASSERT_EQUAL_UINT8(LMH_UNCONFIRMED_MSG, g_lorawan_settings.confirmed_msg_enabled);
+		TEST_ASSERT_LESS_OR_EQUAL(lora_max_payload(), mock_sent_len);
+		receive_packet();
+	}
+	TEST_FAIL_MESSAGE("Deferred values are never sent");
+}
+
+/**
+ * @brief Check that every value of a packet was received unchanged
+ *
+ */
+static void check_received(const uint8_t *lpp, uint8_t lpp_len)
+{
+	uint8_t values = 0;
+	uint8_t pos = 0;
+	while (pos < lpp_len)
+	{
+		uint8_t size = 2 + lpp_size(lpp[pos + 1]);
+		TEST_ASSERT_EQUAL_UINT8(1, received_num[lpp[pos]]);
+		TEST_ASSERT_EQUAL_HEX8_ARRAY(&lpp[pos], received[lpp[pos]], size);
+		values++;
+		pos += size;
+	}
+	uint16_t total = 0;
+	for (uint16_t channel = 0; channel < 256; channel++)
+	{
+		total += received_num[channel];
+	}
+	TEST_ASSERT_EQUAL_UINT16(values, total);
+}
+
+/**
+ * @brief Max payload of every region and data rate
+ *        Regions without a table use EU868, unknown data rates the smallest size
+ *
+ */
+void test_packer_max_payload(void)
+{
+	struct
+	{
+		uint8_t region;
+		uint8_t sizes[8];
+		uint8_t datarates;
+	} regions[] = {
+		{LORAMAC_REGION_EU868, {51, 51, 51, 115, 222, 222, 222, 222}, 8},
+		{LORAMAC_REGION_US915, {11, 53, 125, 242, 242}, 5},
+		{LORAMAC_REGION_AU915, {51, 51, 51, 115, 222, 222, 222}, 7},
+		{LORAMAC_REGION_CN470, {51, 51, 51, 115, 222, 222}, 6},
+		{LORAMAC_REGION_AS923, {11, 11, 11, 53, 125, 242, 242, 242}, 8},
+		{LORAMAC_REGION_AS923_2, {11, 11, 11, 53, 125, 242, 242, 242}, 8},
+		{LORAMAC_REGION_AS923_3, {11, 11, 11, 53, 125, 242, 242, 242}, 8},
+		{LORAMAC_REGION_AS923_4, {11, 11, 11, 53, 125, 242, 242, 242}, 8},
+		{LORAMAC_REGION_KR920, {51, 51, 51, 115, 222, 222, 222, 222}, 8},
+		{LORAMAC_REGION_IN865, {51, 51, 51, 115, 222, 222, 222, 222}, 8},
+		{LORAMAC_REGION_RU864, {51, 51, 51, 115, 222, 222, 222, 222}, 8},
+	};
+
+	char message[64];
+	for (auto &region : regions)
+	{
+		g_lorawan_settings.lora_region = region.region;
+		for (mock_datarate = -1; mock_datarate < 16; mock_datarate++)
+		{
+			snprintf(message, sizeof(message), "region %d DR %d", region.region, mock_datarate);
+			uint8_t expected = ((mock_datarate >= 0) && (mock_datarate < region.datarates)) ? region.sizes[mock_datarate] : region.sizes[0];
+			TEST_ASSERT_EQUAL_UINT8_MESSAGE(expected, lora_max_payload(), message);
+		}
+	}
+}
+
+/**
+ * @brief A reading that fits is sent as it is, nothing is deferred
+ *
+ */
+void test_packer_fits(void)
+{
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_lpp_packet(reading, sizeof(reading)));
+	TEST_ASSERT_EQUAL_UINT8(sizeof(reading), mock_sent_len);
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(reading, mock_sent_data, sizeof(reading));
+	TEST_ASSERT_FALSE(send_lpp_deferred());
+	TEST_ASSERT_EQUAL_UINT16(1, mock_send_count);
+}
+
+/**
+ * @brief The values of the priority list are sent first
+ *        Smaller values with lower priority fill the rest of the packet
+ *
+ */
+void test_packer_priority(void)
+{
+	g_lorawan_settings.lora_region = LORAMAC_REGION_US915;
+	mock_datarate = 0;
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_lpp_packet(reading, sizeof(reading)));
+	// CO2 and PM 2.5, VOC is too big for the 3 bytes left, humidity fits
+	const uint8_t expected[] = {LPP_CHANNEL_CO2_2, 125, 0x02, 0x58,
+								LPP_CHANNEL_PM_2_5, 138, 0x00, 0x05,
+								LPP_CHANNEL_HUMID, 104, 0x5A};
+	TEST_ASSERT_EQUAL_UINT8(sizeof(expected), mock_sent_len);
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, mock_sent_data, sizeof(expected));
+	receive_packet();
+
+	// VOC has the highest priority of the deferred values
+	TEST_ASSERT_TRUE(send_lpp_deferred());
+	TEST_ASSERT_EQUAL_UINT8(LPP_CHANNEL_VOC, mock_sent_data[0]);
+	receive_packet();
+
+	receive_deferred();
+	check_received(reading, sizeof(reading));
+	// 42 bytes in packets of 11 bytes
+	TEST_ASSERT_LESS_OR_EQUAL(6, packets_num);
+
+	// Changed priority list
+	memset(received_num, 0, sizeof(received_num));
+	g_lpp_priority[0] = LPP_CHANNEL_SWITCH;
+	g_lpp_priority[1] = LPP_CHANNEL_LIGHT;
+	g_lpp_priority_num = 2;
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_lpp_packet(reading, sizeof(reading)));
+	TEST_ASSERT_EQUAL_UINT8(LPP_CHANNEL_SWITCH, mock_sent_data[0]);
+	TEST_ASSERT_EQUAL_UINT8(LPP_CHANNEL_LIGHT, mock_sent_data[3]);
+	receive_packet();
+	receive_deferred();
+	check_received(reading, sizeof(reading));
+}
+
+/**
+ * @brief Every value arrives exactly once in every region and data rate
+ *
+ */
+void test_packer_data_rate(void)
+{
+	uint8_t regions[] = {LORAMAC_REGION_EU868, LORAMAC_REGION_US915, LORAMAC_REGION_AU915, LORAMAC_REGION_CN470, LORAMAC_REGION_AS923};
+	for (uint8_t region : regions)
+	{
+		g_lorawan_settings.lora_region = region;
+		for (mock_datarate = 0; mock_datarate < 8; mock_datarate++)
+		{
+			memset(received_num, 0, sizeof(received_num));
+			TEST_ASSERT_EQUAL(LMH_SUCCESS, send_lpp_packet(reading, sizeof(reading)));
+			TEST_ASSERT_LESS_OR_EQUAL(lora_max_payload(), mock_sent_len);
+			receive_packet();
+			receive_deferred();
+			check_received(reading, sizeof(reading));
+		}
+	}
+}
+
+/**
+ * @brief A value of the next reading replaces the deferred value of the same channel
+ *
+ */
+void test_packer_replace(void)
+{
+	mock_datarate = DR_51_BYTES;
+	uint8_t big[sizeof(reading) + 12];
+	memcpy(big, reading, sizeof(reading));
+	// Add three values to get over 51 bytes
+	const uint8_t more[] = {LPP_CHANNEL_HUMID_2, 104, 0x50,
+							LPP_CHANNEL_TEMP_2, 103, 0x00, 0xE0,
+							LPP_CHANNEL_PRESS_2, 115, 0x27, 0x80};
+	memcpy(&big[sizeof(reading)], more, sizeof(more));
+	uint8_t big_len = sizeof(reading) + sizeof(more);
+
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_lpp_packet(big, big_len));
+	TEST_ASSERT_LESS_OR_EQUAL(51, mock_sent_len);
+	receive_packet();
+	// Something was deferred
+	TEST_ASSERT_EQUAL_UINT8(0, received_num[LPP_CHANNEL_PRESS_2]);
+
+	// Next reading has a new pressure, the deferred pressure is dropped
+	const uint8_t next[] = {LPP_CHANNEL_PRESS_2, 115, 0x27, 0x70};
+	mock_datarate = DR_222_BYTES;
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_lpp_packet(next, sizeof(next)));
+	receive_packet();
+	TEST_ASSERT_FALSE(send_lpp_deferred());
+
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(next, received[LPP_CHANNEL_PRESS_2], sizeof(next));
+	// All other values of the first reading arrived
+	memcpy(&big[big_len - sizeof(next)], next, sizeof(next));
+	check_received(big, big_len);
+}
+
+/**
+ * @brief A packet rejected as too big is sent again with less values
+ *        If nothing fits, all values are deferred
+ *
+ */
+void test_packer_too_big(void)
+{
+	// Pending MAC commands
+	mock_send_max = 30;
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_lpp_packet(reading, sizeof(reading)));
+	TEST_ASSERT_GREATER_THAN(1, mock_send_count);
+	TEST_ASSERT_LESS_OR_EQUAL(30, mock_sent_len);
+	TEST_ASSERT_EQUAL_UINT8(LPP_CHANNEL_CO2_2, mock_sent_data[0]);
+	receive_packet();
+	mock_send_max = 255;
+	receive_deferred();
+	check_received(reading, sizeof(reading));
+
+	// Nothing fits
+	memset(received_num, 0, sizeof(received_num));
+	mock_send_max = 2;
+	TEST_ASSERT_EQUAL(LMH_ERROR, send_lpp_packet(reading, sizeof(reading)));
+	mock_send_max = 255;
+	receive_deferred();
+	check_received(reading, sizeof(reading));
+}
+
+/**
+ * @brief All values are deferred if the LoRaWAN stack is busy
+ *
+ */
+void test_packer_busy(void)
+{
+	mock_send_result = LMH_BUSY;
+	TEST_ASSERT_EQUAL(LMH_BUSY, send_lpp_packet(reading, sizeof(reading)));
+	TEST_ASSERT_EQUAL_UINT16(1, mock_send_count);
+	mock_send_result = LMH_SUCCESS;
+	receive_deferred();
+	check_received(reading, sizeof(reading));
+	TEST_ASSERT_EQUAL_UINT16(1, packets_num);
+}
+
+/**
+ * @brief Packets with types unknown to the packer are sent as they are
+ *
+ */
+void test_packer_unknown(void)
+{
+	// GPS location, type 136
+	const uint8_t gps[] = {LPP_CHANNEL_GPS, 136, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+						   LPP_CHANNEL_TEMP, 103, 0x00, 0xD7};
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_lpp_packet(gps, sizeof(gps)));
+	TEST_ASSERT_EQUAL_UINT8(LPP_FPORT, mock_sent_fport);
+	TEST_ASSERT_EQUAL_UINT8(sizeof(gps), mock_sent_len);
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(gps, mock_sent_data, sizeof(gps));
+	TEST_ASSERT_FALSE(send_lpp_deferred());
+
+	// Value cut off at the end of the packet
+	TEST_ASSERT_EQUAL(LMH_SUCCESS, send_lpp_packet(reading, sizeof(reading) - 1));
+	TEST_ASSERT_EQUAL_UINT8(sizeof(reading) - 1, mock_sent_len);
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_packer_max_payload);
+	RUN_TEST(test_packer_fits);
+	RUN_TEST(test_packer_priority);
+	RUN_TEST(test_packer_data_rate);
+	RUN_TEST(test_packer_replace);
+	RUN_TEST(test_packer_too_big);
+	RUN_TEST(test_packer_busy);
+	RUN_TEST(test_packer_unknown);
+	return UNITY_END();
+}
@@ -0,0 +1,142 @@
+/**
+ * @file test_quantized_series.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the fixed point value history
+ * @version 0.1
+ * @date 2024-03-25
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include "quantized_series.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/**
+ * @brief Values of the sensor ranges come back within half a resolution step
+ *        Scales and offsets are the same as in RAK14000_epd.cpp
+ *
+ */
+void test_round_trip(void)
+{
+	QuantizedSeries<10> temp(0.01, 0.0);
+	QuantizedSeries<10> humid(0.1, 0.0);
+	QuantizedSeries<10> baro(0.1, 1000.0);
+	QuantizedSeries<10> light(1.0, 32768.0);
+
+	for (float value = -40.0; value <= 85.0; value += 0.37)
+	{
+		TEST_ASSERT_FLOAT_WITHIN(0.005 + 1e-4, value, temp.decode(temp.encode(value)));
+	}
+	for (float value = 0.0; value <= 100.0; value += 0.33)
+	{
+		TEST_ASSERT_FLOAT_WITHIN(0.05 + 1e-4, value, humid.decode(humid.encode(value)));
+	}
+	for (float value = 260.0; value <= 1260.0; value += 1.13)
+	{
+		TEST_ASSERT_FLOAT_WITHIN(0.05 + 1e-3, value, baro.decode(baro.encode(value)));
+	}
+	for (float value = 0.0; value <= 65535.0; value += 97.5)
+	{
+		TEST_ASSERT_FLOAT_WITHIN(0.5, value, light.decode(light.encode(value)));
+	}
+}
+
+/**
+ * @brief Values outside of the int16_t range are clipped
+ *
+ */
+void test_clipping(void)
+{
+	QuantizedSeries<4> series(0.01, 0.0);
+
+	TEST_ASSERT_EQUAL_INT16(32767, series.encode(1000.0));
+	TEST_ASSERT_EQUAL_INT16(-32768, series.encode(-1000.0));
+	TEST_ASSERT_EQUAL_INT16(32767, series.encode(327.67));
+	TEST_ASSERT_EQUAL_INT16(-32768, series.encode(-327.68));
+}
+
+/**
+ * @brief Stored values are decoded by index, by iterator and by range
+ *
+ */
+void test_access(void)
+{
+	QuantizedSeries<5> series(0.1, 1000.0);
+
+	TEST_ASSERT_EQUAL_FLOAT(0.0, series.latest());
+	for (uint16_t count = 0; count < 8; count++)
+	{
+		series.push(1000.0 + count);
+	}
+
+	TEST_ASSERT_EQUAL_UINT16(5, series.size());
+	TEST_ASSERT_TRUE(series.full());
+	TEST_ASSERT_FLOAT_WITHIN(0.01, 1003.0, series.oldest());
+	TEST_ASSERT_FLOAT_WITHIN(0.01, 1007.0, series.latest());
+	TEST_ASSERT_EQUAL_INT16(70, series.latest_code());
+	TEST_ASSERT_EQUAL_INT16(30, series.code(0));
+
+	uint16_t idx = 0;
+	for (float value : series.range())
+	{
+		TEST_ASSERT_FLOAT_WITHIN(0.01, series[idx], value);
+		TEST_ASSERT_FLOAT_WITHIN(0.01, 1003.0 + idx, value);
+		idx++;
+	}
+	TEST_ASSERT_EQUAL_UINT16(5, idx);
+
+	// Codes from the history log give the same values
+	QuantizedSeries<5> replayed(0.1, 1000.0);
+	for (idx = 0; idx < series.size(); idx++)
+	{
+		replayed.push_code(series.code(idx));
+	}
+	for (idx = 0; idx < series.size(); idx++)
+	{
+		TEST_ASSERT_EQUAL_FLOAT(series[idx], replayed[idx]);
+	}
+}
+
+/**
+ * @brief Statistics are calculated on the codes and decoded
+ *
+ */
+void test_stats(void)
+{
+	QuantizedSeries<4, true> series(0.5, 400.0);
+
+	series.push(410.0);
+	series.push(390.0);
+	series.push(400.0);
+	series.push(420.0);
+
+	TEST_ASSERT_FLOAT_WITHIN(0.01, 390.0, series.min_value());
+	TEST_ASSERT_FLOAT_WITHIN(0.01, 420.0, series.max_value());
+	TEST_ASSERT_FLOAT_WITHIN(0.01, 405.0, series.mean());
+	TEST_ASSERT_FLOAT_WITHIN(0.01, 125.0, series.variance());
+}
+
+/**
+ * @brief RAM usage, series without statistics take 2 * N + 12 bytes
+ *
+ */
+void test_size(void)
+{
+	TEST_ASSERT_EQUAL_UINT32(2 * 100 + 12, sizeof(QuantizedSeries<100>));
+	TEST_ASSERT_LESS_THAN_UINT32(100 * sizeof(float), sizeof(QuantizedSeries<100>));
+	TEST_ASSERT_GREATER_THAN_UINT32(sizeof(QuantizedSeries<100>), sizeof(QuantizedSeries<100, true>));
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_round_trip);
+	RUN_TEST(test_clipping);
+	RUN_TEST(test_access);
+	RUN_TEST(test_stats);
+	RUN_TEST(test_size);
+	return UNITY_END();
+}
@@ -0,0 +1,472 @@
+/**
+ * @file test_render.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the EPD renderers
+ *        Each screen is rendered into the frame buffer and compared pixel
+ *        by pixel with a golden image in golden/ (PBM, 1 = black).
+ *        Missing golden images are created. To accept changed screens, run
+ *        the tests with RENDER_UPDATE_GOLDEN=1 and check the new images.
+ *        A screen that differs is written as <name>.actual.pbm.
+ *        The render time with and without the static template is printed
+ *        for each module combination. Frames that start from the template
+ *        are compared with a full redraw.
+ *        Text widths from the font tables are compared with getTextBounds().
+ * @version 0.1
+ * @date 2024-03-26
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include <chrono>
+#include <string>
+
+#include "../../src/ui/RAK14000_epd.cpp"
+#include "../../src/ui/RAK14000_graphics.cpp"
+#include "../../src/ui/RAK14000_icon.cpp"
+#include "../../src/ui/RAK14000_scientific_ui.cpp"
+#include "../../src/ui/RAK14000_layout.cpp"
+#include "../../src/ui/rak14000_status.cpp"
+#include "../../src/ui/RAK14000_bitmaps.cpp"
+#include "../../src/ui/epd_partial.cpp"
+
+// Application parts the renderers use, fixed values for the screens
+date_time_s g_date_time = {2024, 3, 2, 26, 14, 35, 0};
+bool g_is_using_battery = false;
+bool g_voc_valid = true;
+float g_last_light_lux = 0;
+bool has_rak12002 = false;
+bool has_rak12037 = false;
+bool has_rak12039 = false;
+bool has_rak12047 = false;
+
+/** Modules the screens are rendered for */
+static uint16_t test_caps = 0;
+
+uint16_t sensor_caps(void) { return test_caps; }
+float battery_mv(void) { return 3950.0; }
+void read_rak12002(void) {}
+uint32_t get_rak12002_epoch(void) { return 1711463700; }
+void read_ui_settings(void) {}
+void read_graph_settings(void) {}
+void set_rgb_air_status(void) {}
+void add_history_log(uint8_t series, int16_t code, uint32_t time)
+{
+	(void)series;
+	(void)code;
+	(void)time;
+}
+void history_tiers_changed(void) {}
+
+/** All modules of the RAK10702 */
+#define CAPS_ALL (SENSOR_CAP_TEMP | SENSOR_CAP_HUMID | SENSOR_CAP_BARO | SENSOR_CAP_LIGHT | \
+				  SENSOR_CAP_CO2 | SENSOR_CAP_PM | SENSOR_CAP_VOC)
+
+/** Bytes of one row of the PBM image */
+#define PBM_ROW ((400 + 7) / 8)
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/**
+ * @brief Select the modules, the module flags follow the caps
+ *
+ * @param caps SENSOR_CAP_xxx of the found modules
+ */
+static void set_modules(uint16_t caps)
+{
+	test_caps = caps;
+	has_rak12037 = (caps & SENSOR_CAP_CO2) != 0;
+	has_rak12039 = (caps & SENSOR_CAP_PM) != 0;
+	has_rak12047 = (caps & SENSOR_CAP_VOC) != 0;
+}
+
+/**
+ * @brief Fill the value history with one sample every 15 minutes
+ *
+ */
+static void fill_history(void)
+{
+	for (uint16_t idx = 0; idx < num_values; idx++)
+	{
+		mock_time_ms += 15 * 60000;
+		set_voc_rak14000(100 + (idx * 7) % 150);
+		set_temp_rak14000(22.5 + (idx % 10) * 0.1);
+		set_humid_rak14000(45.0 + (idx % 8));
+		set_co2_rak14000(600 + (idx * 13) % 500);
+		set_baro_rak14000(1008.0 + (idx % 5) * 0.5);
+		set_pm_rak14000(5 + idx % 10, 12 + idx % 20, 20 + idx % 30);
+		set_light_rak14000(300 + idx);
+	}
+	g_last_light_lux = 350.5;
+}
+
+/**
+ * @brief Get the frame buffer as PBM image
+ *
+ * @param image buffer for the image, PBM_ROW * display_height bytes
+ */
+static void frame_to_pbm(uint8_t *image)
+{
+	memset(image, 0, PBM_ROW * display_height);
+	for (int16_t y = 0; y < display_height; y++)
+	{
+		for (int16_t x = 0; x < display_width; x++)
+		{
+			if (display.get_pixel(x, y))
+			{
+				image[y * PBM_ROW + x / 8] |= 0x80 >> (x % 8);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Path of a golden image, next to this file
+ *
+ * @param name screen name
+ * @param suffix file name suffix
+ * @return std::string path
+ */
+static std::string golden_path(const char *name, const char *suffix)
+{
+	std::string path = __FILE__;
+	size_t slash = path.find_last_of("/\\");
+	path = (slash == std::string::npos) ? std::string(".") : path.substr(0, slash);
+	return path + "/golden/" + name + suffix;
+}
+
+static bool write_pbm(const std::string &path, const uint8_t *image)
+{
+	FILE *file = fopen(path.c_str(), "wb");
+	if (file == NULL)
+	{
+		return false;
+	}
+	fprintf(file, "P4\n%d %d\n", display_width, display_height);
+	fwrite(image, 1, PBM_ROW * display_height, file);
+	fclose(file);
+	return true;
+}
+
+static bool read_pbm(const std::string &path, uint8_t *image)
+{
+	FILE *file = fopen(path.c_str(), "rb");
+	if (file == NULL)
+	{
+		return false;
+	}
+	int w = 0;
+	int h = 0;
+	bool ok = (fscanf(file, "P4 %d %d", &w, &h) == 2) && (fgetc(file) == '\n') &&
+			  (w == display_width) && (h == display_height) &&
+			  (fread(image, 1, PBM_ROW * display_height, file) == (size_t)(PBM_ROW * display_height));
+	fclose(file);
+	return ok;
+}
+
+/**
+ * @brief Compare the frame buffer with the golden image of the screen
+ *
+ * @param name screen name
+ */
+static void check_golden(const char *name)
+{
+	static uint8_t frame[PBM_ROW * 300];
+	static uint8_t golden[PBM_ROW * 300];
+	char message[128];
+
+	frame_to_pbm(frame);
+
+	std::string path = golden_path(name, ".pbm");
+	if ((getenv("RENDER_UPDATE_GOLDEN") != NULL) || !read_pbm(path, golden))
+	{
+		TEST_ASSERT_TRUE_MESSAGE(write_pbm(path, frame), "Cannot write golden image");
+		snprintf(message, sizeof(message), "Golden image %s written", name);
+		TEST_MESSAGE(message);
+		return;
+	}
+
+	uint32_t diff = 0;
+	for (uint32_t idx = 0; idx < sizeof(frame); idx++)
+	{
+		diff += __builtin_popcount(frame[idx] ^ golden[idx]);
+	}
+	if (diff != 0)
+	{
+		write_pbm(golden_path(name, ".actual.pbm"), frame);
+		snprintf(message, sizeof(message), "%s: %u pixels differ, see %s.actual.pbm", name, diff, name);
+		TEST_FAIL_MESSAGE(message);
+	}
+}
+
+/**
+ * @brief Render a screen and measure the time
+ *
+ * @return double render time in ms
+ */
+static double timed_render(void)
+{
+	auto start = std::chrono::steady_clock::now();
+	render_rak14000();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/**
+ * @brief Render the scientific UI for a module combination
+ *        The first render draws the static layer, the next renders start from the template
+ *
+ * @param name screen name
+ * @param caps SENSOR_CAP_xxx of the found modules
+ */
+static void scientific_screen(const char *name, uint16_t caps)
+{
+	const uint16_t rounds = 50;
+	char message[128];
+
+	set_modules(caps);
+
+	// A different layout first, the template is drawn again
+	g_ui_selected = 1;
+	render_rak14000();
+	g_ui_selected = 0;
+
+	double first = timed_render();
+	double sum = 0;
+	for (uint16_t round = 0; round < rounds; round++)
+	{
+		sum += timed_render();
+	}
+	snprintf(message, sizeof(message), "%s: first render %.3f ms, from template %.3f ms", name, first, sum / rounds);
+	TEST_MESSAGE(message);
+
+	check_golden(name);
+}
+
+void test_scientific_all(void)
+{
+	scientific_screen("scientific_all", CAPS_ALL);
+}
+
+void test_scientific_no_pm(void)
+{
+	scientific_screen("scientific_no_pm", CAPS_ALL & ~SENSOR_CAP_PM);
+}
+
+void test_scientific_no_baro(void)
+{
+	scientific_screen("scientific_no_baro", CAPS_ALL & ~SENSOR_CAP_BARO);
+}
+
+void test_scientific_no_light(void)
+{
+	scientific_screen("scientific_no_light", CAPS_ALL & ~SENSOR_CAP_LIGHT);
+}
+
+void test_scientific_no_pm_baro(void)
+{
+	scientific_screen("scientific_no_pm_baro", CAPS_ALL & ~(SENSOR_CAP_PM | SENSOR_CAP_BARO));
+}
+
+/**
+ * @brief Graphs with the hourly aggregates
+ *
+ */
+void test_scientific_hourly(void)
+{
+	g_graph_tier = TIER_HOUR;
+	scientific_screen("scientific_hourly", CAPS_ALL & ~SENSOR_CAP_PM);
+	g_graph_tier = TIER_RAW;
+}
+
+void test_icon(void)
+{
+	set_modules(CAPS_ALL);
+	g_ui_selected = 1;
+	render_rak14000();
+	check_golden("icon");
+	g_ui_selected = 0;
+}
+
+void test_status(void)
+{
+	set_modules(CAPS_ALL);
+	g_ui_selected = 2;
+	render_rak14000();
+	check_golden("status");
+	g_ui_selected = 0;
+}
+
+void test_start_screen(void)
+{
+	draw_start_screen_rak14000(true);
+	check_golden("start");
+}
+
+/**
+ * @brief A frame that starts from the template has to be equal to a full redraw
+ *        New values are added between the frames, the old values must not be left in the frame
+ *
+ * @param caps SENSOR_CAP_xxx of the found modules
+ * @param ui UI to draw, 0 = scientific, 1 = icon
+ */
+static void check_template_frame(uint16_t caps, uint8_t ui)
+{
+	static uint8_t from_template[PBM_ROW * 300];
+	static uint8_t full[PBM_ROW * 300];
+	static uint8_t first[PBM_ROW * 300];
+
+	// Keep the history for the golden images
+	TieredHistory<num_values> voc_saved = voc_values;
+	TieredHistory<num_values, true> co2_saved = co2_values;
+	QuantizedSeries<num_values> temp_saved = temp_values;
+
+	set_modules(caps);
+	g_ui_selected = ui;
+	render_rak14000();
+	frame_to_pbm(first);
+
+	mock_time_ms += 15 * 60000;
+	set_voc_rak14000(420);
+	set_co2_rak14000(1450);
+	set_temp_rak14000(19.75);
+	render_rak14000();
+	frame_to_pbm(from_template);
+
+	// A template of an unknown layout forces the full redraw
+	display.store_template(UINT32_MAX);
+	render_rak14000();
+	frame_to_pbm(full);
+
+	TEST_ASSERT_TRUE(memcmp(first, from_template, sizeof(first)) != 0);
+	TEST_ASSERT_EQUAL_MEMORY(full, from_template, sizeof(full));
+
+	voc_values = voc_saved;
+	co2_values = co2_saved;
+	temp_values = temp_saved;
+	g_ui_selected = 0;
+}
+
+void test_template_scientific(void)
+{
+	check_template_frame(CAPS_ALL, 0);
+	check_template_frame(CAPS_ALL & ~SENSOR_CAP_PM, 0);
+}
+
+void test_template_icon(void)
+{
+	check_template_frame(CAPS_ALL, 1);
+}
+
+/**
+ * @brief Template with white text on black background
+ *
+ */
+void test_template_inverted(void)
+{
+	rak14000_switch_bg();
+	check_template_frame(CAPS_ALL & ~SENSOR_CAP_PM, 0);
+	rak14000_switch_bg();
+}
+
+/**
+ * @brief Width of a text measured with getTextBounds()
+ *
+ * @param font font of the text
+ * @param text text to measure
+ * @return uint16_t width in pixel
+ */
+static uint16_t bounds_width(const GFXfont *font, const char *text)
+{
+	int16_t x1, y1;
+	uint16_t w, h;
+	display.setFont(font);
+	display.getTextBounds(text, 0, 50, &x1, &y1, &w, &h);
+	return w;
+}
+
+/**
+ * @brief Widths calculated by the compiler and by text_width_rak14000()
+ *        are the same as the widths from getTextBounds()
+ *
+ */
+void test_text_width(void)
+{
+	TEST_ASSERT_EQUAL_UINT16(bounds_width(SMALL_FONT, "ppm"), SMALL_TEXT_W("ppm"));
+	TEST_ASSERT_EQUAL_UINT16(bounds_width(SMALL_FONT, "Lux"), SMALL_TEXT_W("Lux"));
+	TEST_ASSERT_EQUAL_UINT16(bounds_width(SMALL_FONT, "IoT Made Easy"), SMALL_TEXT_W("IoT Made Easy"));
+	TEST_ASSERT_EQUAL_UINT16(bounds_width(LARGE_FONT, "ppm"), LARGE_TEXT_W("ppm"));
+	TEST_ASSERT_EQUAL_UINT16(bounds_width(LARGE_FONT, "IoT Made Easy"), LARGE_TEXT_W("IoT Made Easy"));
+	TEST_ASSERT_EQUAL_UINT16(0, SMALL_TEXT_W(""));
+
+	const char *values[] = {"0", "1", "23.5", "-4.25", "1013.2", "65535", " 12 ", "100%", "W.I.P."};
+	for (const char *text : values)
+	{
+		TEST_ASSERT_EQUAL_UINT16_MESSAGE(bounds_width(SMALL_FONT, text), text_width_rak14000(SMALL_FONT, text), text);
+		TEST_ASSERT_EQUAL_UINT16_MESSAGE(bounds_width(LARGE_FONT, text), text_width_rak14000(LARGE_FONT, text), text);
+	}
+	display.setFont(NULL);
+}
+
+/** Number of measurements for the benchmark */
+#define WIDTH_RUNS 10000
+
+/**
+ * @brief Time to measure a formatted value with text_width_rak14000() and with getTextBounds()
+ *
+ */
+void test_text_width_benchmark(void)
+{
+	int16_t x1, y1;
+	uint16_t w, h;
+	volatile uint32_t sum = 0;
+	char message[128];
+
+	display.setFont(LARGE_FONT);
+	auto start = std::chrono::steady_clock::now();
+	for (uint16_t run = 0; run < WIDTH_RUNS; run++)
+	{
+		display.getTextBounds("1013.2", 0, 50, &x1, &y1, &w, &h);
+		sum = sum + w;
+	}
+	auto end = std::chrono::steady_clock::now();
+	double bounds_ns = std::chrono::duration<double, std::nano>(end - start).count() / WIDTH_RUNS;
+
+	start = std::chrono::steady_clock::now();
+	for (uint16_t run = 0; run < WIDTH_RUNS; run++)
+	{
+		sum = sum + text_width_rak14000(LARGE_FONT, "1013.2");
+	}
+	end = std::chrono::steady_clock::now();
+	double table_ns = std::chrono::duration<double, std::nano>(end - start).count() / WIDTH_RUNS;
+	display.setFont(NULL);
+
+	snprintf(message, sizeof(message), "Width of \"1013.2\": text_width_rak14000 %.0f ns, getTextBounds %.0f ns", table_ns, bounds_ns);
+	TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv)
+{
+	has_rak14000 = true;
+	display.begin();
+	display.setRotation(EPD_ROTATION);
+	fill_history();
+
+	UNITY_BEGIN();
+	RUN_TEST(test_scientific_all);
+	RUN_TEST(test_scientific_no_pm);
+	RUN_TEST(test_scientific_no_baro);
+	RUN_TEST(test_scientific_no_light);
+	RUN_TEST(test_scientific_no_pm_baro);
+	RUN_TEST(test_scientific_hourly);
+	RUN_TEST(test_icon);
+	RUN_TEST(test_status);
+	RUN_TEST(test_start_screen);
+	RUN_TEST(test_template_scientific);
+	RUN_TEST(test_template_icon);
+	RUN_TEST(test_template_inverted);
+	RUN_TEST(test_text_width);
+	RUN_TEST(test_text_width_benchmark);
+	return UNITY_END();
+}
@@ -0,0 +1,203 @@
+/**
+ * @file test_ring_buffer.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the ring buffer that replaced the shifted history arrays
+ *        The benchmark prints the time of one push, ring buffer and array shift.
+ * @version 0.1
+ * @date 2024-03-25
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include <chrono>
+#include "ring_series.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/**
+ * @brief An empty buffer returns 0 and has no values to iterate
+ *
+ */
+void test_empty(void)
+{
+	RingBuffer<float, 4> buffer;
+
+	TEST_ASSERT_TRUE(buffer.empty());
+	TEST_ASSERT_FALSE(buffer.full());
+	TEST_ASSERT_EQUAL_UINT16(0, buffer.size());
+	TEST_ASSERT_EQUAL_UINT16(4, buffer.capacity());
+	TEST_ASSERT_EQUAL_FLOAT(0.0, buffer.latest());
+	TEST_ASSERT_EQUAL_FLOAT(0.0, buffer.oldest());
+	TEST_ASSERT_TRUE(buffer.begin() == buffer.end());
+}
+
+/**
+ * @brief Values are returned oldest to newest before the buffer is full
+ *
+ */
+void test_fill(void)
+{
+	RingBuffer<uint16_t, 4> buffer;
+
+	buffer.push(10);
+	buffer.push(20);
+	buffer.push(30);
+
+	TEST_ASSERT_EQUAL_UINT16(3, buffer.size());
+	TEST_ASSERT_FALSE(buffer.full());
+	TEST_ASSERT_EQUAL_UINT16(10, buffer.oldest());
+	TEST_ASSERT_EQUAL_UINT16(30, buffer.latest());
+	TEST_ASSERT_EQUAL_UINT16(10, buffer[0]);
+	TEST_ASSERT_EQUAL_UINT16(20, buffer[1]);
+	TEST_ASSERT_EQUAL_UINT16(30, buffer[2]);
+}
+
+/**
+ * @brief A full buffer drops the oldest value, same result as the old shifted array
+ *
+ */
+void test_wrap(void)
+{
+	RingBuffer<uint16_t, 4> buffer;
+	uint16_t shifted[4];
+	uint16_t shifted_num = 0;
+
+	for (uint16_t value = 1; value <= 11; value++)
+	{
+		buffer.push(value);
+
+		// Reference, the array shift that was used before
+		if (shifted_num == 4)
+		{
+			for (uint16_t idx = 0; idx < 3; idx++)
+			{
+				shifted[idx] = shifted[idx + 1];
+			}
+			shifted_num--;
+		}
+		shifted[shifted_num++] = value;
+
+		TEST_ASSERT_EQUAL_UINT16(shifted_num, buffer.size());
+		for (uint16_t idx = 0; idx < shifted_num; idx++)
+		{
+			TEST_ASSERT_EQUAL_UINT16(shifted[idx], buffer[idx]);
+		}
+	}
+	TEST_ASSERT_TRUE(buffer.full());
+	TEST_ASSERT_EQUAL_UINT16(8, buffer.oldest());
+	TEST_ASSERT_EQUAL_UINT16(11, buffer.latest());
+}
+
+/** Number of values in the history arrays of the EPD */
+#define HISTORY_NUM 100
+/** Number of pushes of the benchmark */
+#define BENCH_PUSHES 200000
+
+/**
+ * @brief Time of a push into a full history, ring buffer and the array shift used before
+ *
+ */
+void test_push_benchmark(void)
+{
+	static RingBuffer<float, HISTORY_NUM> buffer;
+	static float shifted[HISTORY_NUM];
+	uint16_t shifted_num = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t value = 0; value < BENCH_PUSHES; value++)
+	{
+		buffer.push((float)value);
+	}
+	auto end = std::chrono::steady_clock::now();
+	double ring_ns = std::chrono::duration<double, std::nano>(end - start).count() / BENCH_PUSHES;
+
+	start = std::chrono::steady_clock::now();
+	for (uint32_t value = 0; value < BENCH_PUSHES; value++)
+	{
+		// Old code of set_voc_rak14000() and the other history functions
+		if (shifted_num == HISTORY_NUM)
+		{
+			for (uint16_t idx = 0; idx < HISTORY_NUM - 1; idx++)
+			{
+				shifted[idx] = shifted[idx + 1];
+			}
+			shifted[HISTORY_NUM - 1] = (float)value;
+		}
+		else
+		{
+			shifted[shifted_num++] = (float)value;
+		}
+	}
+	end = std::chrono::steady_clock::now();
+	double shift_ns = std::chrono::duration<double, std::nano>(end - start).count() / BENCH_PUSHES;
+
+	// Both keep the same values
+	for (uint16_t idx = 0; idx < HISTORY_NUM; idx++)
+	{
+		TEST_ASSERT_EQUAL_FLOAT(shifted[idx], buffer[idx]);
+	}
+
+	char message[128];
+	snprintf(message, sizeof(message), "Push of %d values: ring buffer %.1f ns, array shift %.1f ns", HISTORY_NUM, ring_ns, shift_ns);
+	TEST_MESSAGE(message);
+	TEST_ASSERT_LESS_THAN(shift_ns, ring_ns);
+}
+
+/**
+ * @brief The iterator walks the values oldest to newest across the wrap
+ *
+ */
+void test_iterator(void)
+{
+	RingBuffer<int16_t, 5> buffer;
+
+	for (int16_t value = -3; value < 4; value++)
+	{
+		buffer.push(value);
+	}
+
+	int16_t expected = -1;
+	uint16_t count = 0;
+	for (int16_t value : buffer)
+	{
+		TEST_ASSERT_EQUAL_INT16(expected, value);
+		expected++;
+		count++;
+	}
+	TEST_ASSERT_EQUAL_UINT16(5, count);
+}
+
+/**
+ * @brief Clear removes all values and the buffer can be filled again
+ *
+ */
+void test_clear(void)
+{
+	RingBuffer<uint8_t, 3> buffer;
+
+	for (uint8_t value = 0; value < 5; value++)
+	{
+		buffer.push(value);
+	}
+	buffer.clear();
+	TEST_ASSERT_TRUE(buffer.empty());
+
+	buffer.push(42);
+	TEST_ASSERT_EQUAL_UINT16(1, buffer.size());
+	TEST_ASSERT_EQUAL_UINT8(42, buffer.oldest());
+	TEST_ASSERT_EQUAL_UINT8(42, buffer.latest());
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_empty);
+	RUN_TEST(test_fill);
+	RUN_TEST(test_wrap);
+	RUN_TEST(test_push_benchmark);
+	RUN_TEST(test_iterator);
+	RUN_TEST(test_clear);
+	return UNITY_END();
+}
@@ -0,0 +1,163 @@
+/**
+ * @file test_ring_series.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the sliding window statistics of RingSeries
+ *        The incremental min, max, mean and variance are compared with
+ *        a full scan over the buffer after each new value.
+ * @version 0.1
+ * @date 2024-03-25
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include <stdlib.h>
+#include "ring_series.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/**
+ * @brief Compare the statistics with a full scan over the buffer
+ *
+ * @param series series to check
+ */
+template <typename T, uint16_t N>
+static void check_stats(const RingSeries<T, N> &series)
+{
+	T min_value = series[0];
+	T max_value = series[0];
+	double sum = 0.0;
+	double sum_sq = 0.0;
+	for (uint16_t idx = 0; idx < series.size(); idx++)
+	{
+		T value = series[idx];
+		if (value < min_value)
+		{
+			min_value = value;
+		}
+		if (value > max_value)
+		{
+			max_value = value;
+		}
+		sum += value;
+		sum_sq += (double)value * value;
+	}
+	double mean = sum / series.size();
+	double variance = (sum_sq / series.size()) - (mean * mean);
+
+	TEST_ASSERT_EQUAL_FLOAT(min_value, series.min_value());
+	TEST_ASSERT_EQUAL_FLOAT(max_value, series.max_value());
+	TEST_ASSERT_FLOAT_WITHIN(0.01, mean, series.mean());
+	TEST_ASSERT_FLOAT_WITHIN(0.01 + variance * 1e-4, variance, series.variance());
+}
+
+/**
+ * @brief Empty series return 0 for all statistics
+ *
+ */
+void test_empty(void)
+{
+	RingSeries<float, 8> series;
+
+	TEST_ASSERT_EQUAL_FLOAT(0.0, series.min_value());
+	TEST_ASSERT_EQUAL_FLOAT(0.0, series.max_value());
+	TEST_ASSERT_EQUAL_FLOAT(0.0, series.mean());
+	TEST_ASSERT_EQUAL_FLOAT(0.0, series.variance());
+}
+
+/**
+ * @brief Random values, several buffer wraps
+ *
+ */
+void test_random(void)
+{
+	RingSeries<float, 100> series;
+
+	srand(1);
+	for (uint16_t count = 0; count < 1000; count++)
+	{
+		series.push((float)(rand() % 5000) / 10.0);
+		check_stats(series);
+	}
+}
+
+/**
+ * @brief Only rising or falling values, the min/max queues hold the whole buffer
+ *
+ */
+void test_monotonic(void)
+{
+	RingSeries<int16_t, 50> series;
+
+	for (int16_t value = 0; value < 200; value++)
+	{
+		series.push(value);
+		check_stats(series);
+	}
+	for (int16_t value = 200; value > -200; value--)
+	{
+		series.push(value);
+		check_stats(series);
+	}
+}
+
+/**
+ * @brief Repeated values, equal values must not leave stale queue entries
+ *
+ */
+void test_repeated(void)
+{
+	RingSeries<uint16_t, 10> series;
+
+	srand(2);
+	for (uint16_t count = 0; count < 500; count++)
+	{
+		series.push(400 + (rand() % 3));
+		check_stats(series);
+	}
+}
+
+/**
+ * @brief Large values over many wraps, the sums must not drift
+ *
+ */
+void test_no_drift(void)
+{
+	RingSeries<float, 16> series;
+
+	srand(3);
+	for (uint32_t count = 0; count < 20000; count++)
+	{
+		series.push(40000.0 + (float)(rand() % 1000) / 100.0);
+	}
+	check_stats(series);
+}
+
+/**
+ * @brief Clear resets the statistics
+ *
+ */
+void test_clear(void)
+{
+	RingSeries<float, 4> series;
+
+	series.push(100.0);
+	series.push(-100.0);
+	series.clear();
+	series.push(5.0);
+	check_stats(series);
+	TEST_ASSERT_EQUAL_FLOAT(0.0, series.variance());
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_empty);
+	RUN_TEST(test_random);
+	RUN_TEST(test_monotonic);
+	RUN_TEST(test_repeated);
+	RUN_TEST(test_no_drift);
+	RUN_TEST(test_clear);
+	return UNITY_END();
+}
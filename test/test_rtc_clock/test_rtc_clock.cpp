@@ -0,0 +1,492 @@
+/**
+ * @file test_rtc_clock.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the software clock of the RAK12002 RTC
+ *        The RV3028 is simulated on the I2C bus of the mocks. Its time can
+ *        run faster or slower than millis(), the software clock has to follow
+ *        it with one burst read per hour. The date conversion is compared with
+ *        gmtime() and timegm() of the C library.
+ *        The alarm of the RV3028 is simulated from its alarm registers, one
+ *        day of readings started by the alarm is checked for alignment to the
+ *        send interval and for jitter.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include "../../src/sensors/RAK12002_rtc.cpp"
+
+// Application parts the RTC code uses
+bool has_rak12002 = true;
+
+void read_align_settings(void) {}
+void save_align_settings(bool align) { (void)align; }
+
+/** Start time of the simulated RTC, 2024-03-27 00:40:00 */
+#define RTC_START 1711500000
+/** Hour in ms */
+#define HOUR_MS 3600000UL
+/** Time step of the alignment simulation in ms */
+#define SIM_STEP_MS 10
+
+/** Flag if the simulated RTC answers */
+static bool rtc_present = true;
+/** RTC time at rtc_start_ms */
+static uint32_t rtc_start_epoch = RTC_START;
+/** mock_time_ms when the RTC was set */
+static unsigned long rtc_start_ms = 0;
+/** Deviation of the RTC from millis() in ppm, positive values make the RTC faster */
+static int32_t rtc_drift_ppm = 0;
+/** setTime() calls that were taken over */
+static uint32_t rtc_set_count = 0;
+
+/**
+ * @brief Time of the simulated RTC
+ *
+ * @return uint64_t milliseconds since 1970-01-01
+ */
+static uint64_t rtc_now_ms(void)
+{
+	int64_t elapsed = (int64_t)(mock_time_ms - rtc_start_ms);
+	return (uint64_t)rtc_start_epoch * 1000 + elapsed + elapsed * rtc_drift_ppm / 1000000;
+}
+
+/**
+ * @brief Time of the simulated RTC
+ *
+ * @return uint32_t seconds since 1970-01-01
+ */
+static uint32_t rtc_now(void)
+{
+	return (uint32_t)(rtc_now_ms() / 1000);
+}
+
+static uint8_t to_bcd(int value)
+{
+	return ((value / 10) << 4) | (value % 10);
+}
+
+/**
+ * @brief Take over the time written with setTime()
+ *
+ */
+static void rtc_take_set_time(void)
+{
+	if (rtc_set_count == mock_rv3028_set_count)
+	{
+		return;
+	}
+	rtc_set_count = mock_rv3028_set_count;
+	struct tm set_time = {};
+	set_time.tm_year = mock_rv3028_set_time[0] - 1900;
+	set_time.tm_mon = mock_rv3028_set_time[1] - 1;
+	set_time.tm_mday = mock_rv3028_set_time[3];
+	set_time.tm_hour = mock_rv3028_set_time[4];
+	set_time.tm_min = mock_rv3028_set_time[5];
+	set_time.tm_sec = mock_rv3028_set_time[6];
+	rtc_start_epoch = (uint32_t)timegm(&set_time);
+	rtc_start_ms = mock_time_ms;
+}
+
+/**
+ * @brief Simulated RV3028 on the I2C bus, answers with the time registers
+ *
+ */
+static bool rtc_i2c_read(uint8_t address, uint8_t reg, uint8_t *data, uint8_t len)
+{
+	if ((address != RV3028_ADDR) || !rtc_present)
+	{
+		return false;
+	}
+	time_t now = rtc_now();
+	struct tm date;
+	gmtime_r(&now, &date);
+	uint8_t regs[RV3028_TIME_REGS] = {
+		to_bcd(date.tm_sec), to_bcd(date.tm_min), to_bcd(date.tm_hour), (uint8_t)date.tm_wday,
+		to_bcd(date.tm_mday), to_bcd(date.tm_mon + 1), to_bcd(date.tm_year - 100)};
+	for (uint8_t idx = 0; idx < len; idx++)
+	{
+		data[idx] = (reg + idx < RV3028_TIME_REGS) ? regs[reg + idx] : 0;
+	}
+	return true;
+}
+
+/**
+ * @brief Alarm of the simulated RV3028, called at each full minute of the RTC
+ *        Minutes, hours and date must match the alarm registers
+ *
+ * @param epoch RTC time
+ */
+static void rtc_check_alarm(uint32_t epoch)
+{
+	if ((mock_rv3028_regs[RV3028_REG_CONTROL2] & RV3028_AIE) == 0)
+	{
+		return;
+	}
+	time_t now = epoch;
+	struct tm date;
+	gmtime_r(&now, &date);
+	if ((mock_rv3028_regs[RV3028_REG_ALARM] == to_bcd(date.tm_min)) &&
+		(mock_rv3028_regs[RV3028_REG_ALARM + 1] == to_bcd(date.tm_hour)) &&
+		(mock_rv3028_regs[RV3028_REG_ALARM + 2] == to_bcd(date.tm_mday)))
+	{
+		mock_rv3028_regs[RV3028_REG_STATUS] |= RV3028_AF;
+		TEST_ASSERT_NOT_NULL(mock_interrupt[RTC_INT]);
+		mock_interrupt[RTC_INT]();
+	}
+}
+
+/**
+ * @brief Difference between the software clock and the simulated RTC
+ *
+ */
+static int32_t clock_error(void)
+{
+	return (int32_t)(get_rak12002_epoch() - rtc_now());
+}
+
+void setUp(void)
+{
+	mock_time_ms = 5000;
+	mock_i2c_read = rtc_i2c_read;
+	rtc_present = true;
+	rtc_start_epoch = RTC_START;
+	rtc_start_ms = 0;
+	rtc_drift_ppm = 0;
+	rtc_set_count = mock_rv3028_set_count;
+	memset(mock_rv3028_regs, 0, sizeof(mock_rv3028_regs));
+	g_task_event_type = 0;
+	g_rtc_align = false;
+	rtc_alarm = false;
+	mock_interrupt[RTC_INT] = NULL;
+}
+
+void tearDown(void)
+{
+	mock_i2c_read = NULL;
+}
+
+/**
+ * @brief Date conversion in both directions for every day from 1970 to 2106
+ *
+ */
+void test_epoch_conversion(void)
+{
+	for (uint32_t day = 0; day < 49710; day++)
+	{
+		uint32_t epoch = day * 86400 + (day * 7919) % 86400;
+		time_t expected_time = epoch;
+		struct tm expected;
+		gmtime_r(&expected_time, &expected);
+
+		date_time_s date_time;
+		epoch_to_date(epoch, &date_time);
+		TEST_ASSERT_EQUAL_UINT16(expected.tm_year + 1900, date_time.year);
+		TEST_ASSERT_EQUAL_UINT8(expected.tm_mon + 1, date_time.month);
+		TEST_ASSERT_EQUAL_UINT8(expected.tm_mday, date_time.date);
+		TEST_ASSERT_EQUAL_UINT8(expected.tm_wday, date_time.weekday);
+		TEST_ASSERT_EQUAL_UINT8(expected.tm_hour, date_time.hour);
+		TEST_ASSERT_EQUAL_UINT8(expected.tm_min, date_time.minute);
+		TEST_ASSERT_EQUAL_UINT8(expected.tm_sec, date_time.second);
+
+		TEST_ASSERT_EQUAL_UINT32(epoch, date_to_epoch(&date_time));
+	}
+
+	// Leap days and the end of the 32 bit time
+	date_time_s leap_day = {2000, 2, 2, 29, 12, 0, 0};
+	TEST_ASSERT_EQUAL_UINT32(951825600, date_to_epoch(&leap_day));
+	date_time_s no_leap_day = {2100, 3, 1, 1, 0, 0, 0};
+	TEST_ASSERT_EQUAL_UINT32(4107542400UL, date_to_epoch(&no_leap_day));
+	date_time_s last = {2106, 2, 0, 7, 6, 28, 15};
+	TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFUL, date_to_epoch(&last));
+}
+
+/**
+ * @brief The RTC is read once during boot and then once per hour
+ *        In between the time is read without I2C transfers
+ *
+ */
+void test_burst_read(void)
+{
+	TEST_ASSERT_TRUE(init_rak12002());
+	time_t now = rtc_now();
+	struct tm expected;
+	gmtime_r(&now, &expected);
+	TEST_ASSERT_EQUAL_UINT16(expected.tm_year + 1900, g_date_time.year);
+	TEST_ASSERT_EQUAL_UINT8(expected.tm_mday, g_date_time.date);
+	TEST_ASSERT_EQUAL_UINT8(expected.tm_hour, g_date_time.hour);
+	TEST_ASSERT_EQUAL_UINT8(expected.tm_min, g_date_time.minute);
+
+	uint32_t transfers = mock_i2c_transfers;
+	for (uint16_t minute = 0; minute < 59; minute++)
+	{
+		mock_time_ms += 60000;
+		TEST_ASSERT_EQUAL_INT32(0, clock_error());
+		read_rak12002();
+	}
+	TEST_ASSERT_EQUAL_UINT32(transfers, mock_i2c_transfers);
+
+	// One write of the register address and one read of all time registers
+	mock_time_ms += 60000;
+	TEST_ASSERT_EQUAL_INT32(0, clock_error());
+	TEST_ASSERT_EQUAL_UINT32(transfers + 2, mock_i2c_transfers);
+}
+
+/**
+ * @brief Follow a drifting RTC for one day
+ *        The error stays below the drift of one hour, after each read of the
+ *        RTC the clock is corrected
+ *
+ */
+static void check_drift(int32_t drift_ppm)
+{
+	rtc_drift_ppm = drift_ppm;
+	TEST_ASSERT_TRUE(init_rak12002());
+
+	// 1000 ppm are 3.6 seconds per hour
+	int32_t max_error = (abs(drift_ppm) * 3600 + 999999) / 1000000 + RTC_DRIFT_MAX + 1;
+	uint32_t transfers = mock_i2c_transfers;
+	uint16_t syncs = 0;
+	for (uint32_t step = 0; step < 24 * 360; step++)
+	{
+		mock_time_ms += 10000;
+		int32_t error = clock_error();
+		TEST_ASSERT_LESS_OR_EQUAL(max_error, abs(error));
+		if (mock_i2c_transfers != transfers)
+		{
+			transfers = mock_i2c_transfers;
+			syncs++;
+			TEST_ASSERT_LESS_OR_EQUAL(RTC_DRIFT_MAX + 1, abs(error));
+		}
+	}
+	TEST_ASSERT_EQUAL_UINT16(24, syncs);
+}
+
+void test_drift_fast(void)
+{
+	check_drift(1000);
+}
+
+void test_drift_slow(void)
+{
+	check_drift(-1000);
+}
+
+/**
+ * @brief The clock continues through the wrap around of millis()
+ *
+ */
+void test_millis_wrap(void)
+{
+	mock_time_ms = 0xFFFFFFFFUL - HOUR_MS / 2;
+	rtc_start_ms = mock_time_ms;
+	TEST_ASSERT_TRUE(init_rak12002());
+
+	for (uint16_t minute = 0; minute < 180; minute++)
+	{
+		mock_time_ms += 60000;
+		TEST_ASSERT_INT32_WITHIN(RTC_DRIFT_MAX, 0, clock_error());
+	}
+}
+
+/**
+ * @brief Setting the time forces a new read of the RTC
+ *
+ */
+void test_set_time(void)
+{
+	TEST_ASSERT_TRUE(init_rak12002());
+	mock_time_ms += 60000;
+
+	set_rak12002(2025, 1, 2, 3, 4);
+	rtc_take_set_time();
+	mock_time_ms += 1000;
+	// 2025-01-02 03:04:01
+	TEST_ASSERT_EQUAL_UINT32(1735787041, get_rak12002_epoch());
+	read_rak12002();
+	TEST_ASSERT_EQUAL_UINT16(2025, g_date_time.year);
+	TEST_ASSERT_EQUAL_UINT8(1, g_date_time.month);
+	TEST_ASSERT_EQUAL_UINT8(2, g_date_time.date);
+	TEST_ASSERT_EQUAL_UINT8(4, g_date_time.weekday);
+	TEST_ASSERT_EQUAL_UINT8(3, g_date_time.hour);
+	TEST_ASSERT_EQUAL_UINT8(4, g_date_time.minute);
+	TEST_ASSERT_EQUAL_UINT8(1, g_date_time.second);
+}
+
+/**
+ * @brief Without RTC the init fails, a failed read keeps the clock running
+ *
+ */
+void test_no_rtc(void)
+{
+	rtc_present = false;
+	TEST_ASSERT_FALSE(init_rak12002());
+
+	rtc_present = true;
+	TEST_ASSERT_TRUE(init_rak12002());
+	rtc_present = false;
+	mock_time_ms += 2 * HOUR_MS;
+	TEST_ASSERT_EQUAL_INT32(0, clock_error());
+}
+
+/**
+ * @brief Simulate one day of readings started by the RTC alarm
+ *        Each STATUS event calls align_rak12002() like main.cpp, the sensors
+ *        are read after the returned cycle length. Every reading after the
+ *        first has to be on a multiple of the send interval of the RTC time,
+ *        without a missed interval.
+ *
+ * @param send_interval_ms send interval of the LoRaWAN settings
+ * @param drift_ppm deviation of the RTC from millis()
+ */
+static void check_aligned_day(uint32_t send_interval_ms, int32_t drift_ppm)
+{
+	char message[128];
+	rtc_drift_ppm = drift_ppm;
+	g_lorawan_settings.send_repeat_time = send_interval_ms;
+	g_rtc_align = true;
+	TEST_ASSERT_TRUE(init_rak12002());
+
+	uint64_t interval_ms = (uint64_t)(send_interval_ms + 59999) / 60000 * 60000;
+	if (interval_ms < RTC_ALIGN_MIN * 1000)
+	{
+		interval_ms = RTC_ALIGN_MIN * 1000;
+	}
+	// The sensors are read RTC_ALIGN_LEAD after the alarm, timed by millis()
+	int64_t max_jitter = (int64_t)RTC_ALIGN_LEAD * abs(drift_ppm) / 1000000 + SIM_STEP_MS;
+
+	// The first cycle is started by the send timer of the API
+	api_wake_loop(STATUS);
+	uint64_t last_minute = rtc_now_ms() / 60000;
+	bool reading_pending = false;
+	unsigned long reading_ms = 0;
+	uint64_t last_boundary = 0;
+	uint32_t readings = 0;
+	int64_t worst_jitter = 0;
+	unsigned long end = mock_time_ms + 24 * HOUR_MS;
+
+	while (mock_time_ms < end)
+	{
+		mock_time_ms += SIM_STEP_MS;
+		uint64_t now_ms = rtc_now_ms();
+		if (now_ms / 60000 != last_minute)
+		{
+			last_minute = now_ms / 60000;
+			rtc_check_alarm((uint32_t)(now_ms / 1000));
+		}
+
+		if (g_task_event_type & STATUS)
+		{
+			g_task_event_type &= N_STATUS;
+			uint32_t cycle_ms = align_rak12002();
+			if (cycle_ms != 0)
+			{
+				reading_pending = true;
+				reading_ms = mock_time_ms + cycle_ms;
+			}
+		}
+
+		if (reading_pending && (mock_time_ms >= reading_ms))
+		{
+			reading_pending = false;
+			uint64_t boundary = (now_ms + interval_ms / 2) / interval_ms * interval_ms;
+			int64_t jitter = (int64_t)(now_ms - boundary);
+			snprintf(message, sizeof(message), "reading %lu ms from the interval boundary", (unsigned long)llabs(jitter));
+			TEST_ASSERT_TRUE_MESSAGE(llabs(jitter) <= max_jitter, message);
+			if (readings != 0)
+			{
+				TEST_ASSERT_EQUAL_UINT32(interval_ms, boundary - last_boundary);
+			}
+			worst_jitter = llabs(jitter) > worst_jitter ? llabs(jitter) : worst_jitter;
+			last_boundary = boundary;
+			readings++;
+		}
+	}
+
+	snprintf(message, sizeof(message), "Interval %lu s, drift %ld ppm: %lu readings, max jitter %ld ms",
+			 (unsigned long)(interval_ms / 1000), (long)drift_ppm, (unsigned long)readings, (long)worst_jitter);
+	TEST_MESSAGE(message);
+	TEST_ASSERT_GREATER_OR_EQUAL(24 * HOUR_MS / interval_ms - 1, readings);
+}
+
+/**
+ * @brief Readings on multiples of the send interval for one day
+ *        The simulation starts before midnight at the end of a month
+ *
+ */
+void test_align(void)
+{
+	// 2024-03-31 22:17:23
+	rtc_start_epoch = 1711923443;
+	check_aligned_day(300000, 0);
+}
+
+/**
+ * @brief Alignment with different intervals and a drifting RTC
+ *        Send intervals that are not full minutes are rounded up,
+ *        1 minute is aligned to RTC_ALIGN_MIN
+ *
+ */
+void test_align_intervals(void)
+{
+	uint32_t intervals[] = {60000, 90000, 900000, 3600000};
+	int32_t drifts[] = {1000, -1000};
+	for (uint32_t interval : intervals)
+	{
+		for (int32_t drift : drifts)
+		{
+			setUp();
+			rtc_start_epoch = 1711923443;
+			check_aligned_day(interval, drift);
+		}
+	}
+}
+
+/**
+ * @brief Switching the alignment off stops the alarm
+ *
+ */
+void test_align_off(void)
+{
+	g_lorawan_settings.send_repeat_time = 300000;
+	TEST_ASSERT_TRUE(init_rak12002());
+	TEST_ASSERT_EQUAL_UINT32(0, align_rak12002());
+	TEST_ASSERT_EQUAL_HEX8(0, mock_rv3028_regs[RV3028_REG_CONTROL2] & RV3028_AIE);
+
+	// Without alignment the interrupt is not attached
+	TEST_ASSERT_NULL(mock_interrupt[RTC_INT]);
+
+	set_align_rak12002(true);
+	TEST_ASSERT_EQUAL_HEX8(RV3028_AIE, mock_rv3028_regs[RV3028_REG_CONTROL2] & RV3028_AIE);
+	TEST_ASSERT_NOT_NULL(mock_interrupt[RTC_INT]);
+	set_align_rak12002(false);
+	TEST_ASSERT_EQUAL_HEX8(0, mock_rv3028_regs[RV3028_REG_CONTROL2] & RV3028_AIE);
+	TEST_ASSERT_NULL(mock_interrupt[RTC_INT]);
+
+	// An edge on the pin while the alignment is off does not start a reading
+	set_align_rak12002(true);
+	void (*alarm_int)(void) = mock_interrupt[RTC_INT];
+	set_align_rak12002(false);
+	g_task_event_type = 0;
+	alarm_int();
+	TEST_ASSERT_EQUAL_UINT16(0, g_task_event_type & STATUS);
+	TEST_ASSERT_EQUAL_UINT32(0, align_rak12002());
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_epoch_conversion);
+	RUN_TEST(test_burst_read);
+	RUN_TEST(test_drift_fast);
+	RUN_TEST(test_drift_slow);
+	RUN_TEST(test_millis_wrap);
+	RUN_TEST(test_set_time);
+	RUN_TEST(test_no_rtc);
+	RUN_TEST(test_align);
+	RUN_TEST(test_align_intervals);
+	RUN_TEST(test_align_off);
+	return UNITY_END();
+}
@@ -0,0 +1,275 @@
+/**
+ * @file test_sensor_scheduler.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the sensor scheduler with the real sensor_drivers[] table
+ *        The sensor drivers are replaced by stubs that remember when a sensor
+ *        was started and shut down. The fixed window used before (all sensors
+ *        started together, read after 30 seconds with PM sensor, else after
+ *        12 seconds) is compared with the scheduler, which starts each sensor
+ *        at cycle end - (warm-up + conversion).
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include <strings.h>
+#include "../../src/sensors/sensor_registry.cpp"
+#include "../../src/tools/sensor_scheduler.cpp"
+
+/** Fixed window with PM sensor used before the scheduler */
+#define FIXED_WINDOW_PM 30000
+/** Fixed window without PM sensor used before the scheduler */
+#define FIXED_WINDOW 12000
+
+// Application parts the scheduler uses
+SoftwareTimer g_sensor_timer;
+bool g_is_using_battery = true;
+void sensor_wakeup(TimerHandle_t unused) { (void)unused; }
+
+/** Time a sensor was started */
+static unsigned long started_at[SENSOR_DRIVERS_MAX];
+/** Time from startup to shutdown of a sensor, 0 if it was not started */
+static unsigned long awake_ms[SENSOR_DRIVERS_MAX];
+/** Time a sensor was read */
+static unsigned long read_at[SENSOR_DRIVERS_MAX];
+
+/**
+ * @brief Find a module in sensor_drivers[]
+ *
+ * @param name module name
+ * @return uint8_t index in sensor_drivers[]
+ */
+static uint8_t driver_idx(const char *name)
+{
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		if (strcasecmp(sensor_drivers[idx].name, name) == 0)
+		{
+			return idx;
+		}
+	}
+	TEST_FAIL_MESSAGE(name);
+	return 0;
+}
+
+/** Driver stubs, record the startup, read and shutdown time of the module */
+#define SENSOR_STUBS(module)                                                                 \
+	bool has_##module = false;                                                               \
+	bool init_##module(void) { return true; }                                                \
+	void startup_##module(void) { started_at[driver_idx(#module)] = mock_time_ms; }         \
+	void shutdown_##module(void)                                                             \
+	{                                                                                        \
+		awake_ms[driver_idx(#module)] = mock_time_ms - started_at[driver_idx(#module)];     \
+	}
+
+SENSOR_STUBS(rak1901)
+SENSOR_STUBS(rak1902)
+SENSOR_STUBS(rak1903)
+SENSOR_STUBS(rak1906)
+SENSOR_STUBS(rak12010)
+SENSOR_STUBS(rak12039)
+SENSOR_STUBS(rak12037)
+bool has_rak12002 = false;
+bool has_rak12047 = false;
+bool init_rak12047(void) { return true; }
+
+void read_rak1901(void) { read_at[driver_idx("rak1901")] = mock_time_ms; }
+void read_rak1902(void) { read_at[driver_idx("rak1902")] = mock_time_ms; }
+void read_rak1903(void) { read_at[driver_idx("rak1903")] = mock_time_ms; }
+bool read_rak1906(void)
+{
+	read_at[driver_idx("rak1906")] = mock_time_ms;
+	return true;
+}
+void read_rak12010(void) { read_at[driver_idx("rak12010")] = mock_time_ms; }
+void read_rak12039(void) { read_at[driver_idx("rak12039")] = mock_time_ms; }
+void read_rak12037(void) { read_at[driver_idx("rak12037")] = mock_time_ms; }
+bool request_rak12037(void) { return true; }
+void read_rak12047(void) {}
+
+/**
+ * @brief Mark the modules as found
+ *
+ * @param with_pm true if the PM sensor is connected
+ */
+static void set_modules(bool with_pm)
+{
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		*sensor_drivers[idx].available = true;
+	}
+	has_rak12039 = with_pm;
+}
+
+/**
+ * @brief Readings as done before the scheduler, all sensors
+ *        are started together and read at the end of a fixed window
+ *
+ * @param window length of the window in ms
+ */
+static void run_fixed_window(uint32_t window)
+{
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		if (*sensor_drivers[idx].available && (sensor_drivers[idx].startup != NULL))
+		{
+			sensor_drivers[idx].startup();
+		}
+	}
+	mock_time_ms += window;
+	TEST_ASSERT_TRUE(request_sensors());
+	read_sensors();
+}
+
+/**
+ * @brief Readings with the scheduler, the sensor timer is
+ *        simulated by advancing the time by the timer period
+ *
+ * @return uint32_t time from the start of the cycle until SEND_NOW
+ */
+static uint32_t run_scheduler(void)
+{
+	unsigned long cycle_begin = mock_time_ms;
+	start_sensor_schedule(0);
+	while ((g_task_event_type & SEND_NOW) == 0)
+	{
+		TEST_ASSERT_TRUE(g_sensor_timer.running);
+		g_sensor_timer.stop();
+		mock_time_ms += g_sensor_timer.period;
+		run_sensor_schedule();
+	}
+	g_task_event_type &= N_SEND_NOW;
+	TEST_ASSERT_TRUE(request_sensors());
+	read_sensors();
+	return mock_time_ms - cycle_begin;
+}
+
+/**
+ * @brief Run both reading methods and compare the awake time of the sensors
+ *
+ * @param with_pm true if the PM sensor is connected
+ */
+static void compare_awake_time(bool with_pm)
+{
+	uint32_t window = with_pm ? FIXED_WINDOW_PM : FIXED_WINDOW;
+	unsigned long fixed_awake[SENSOR_DRIVERS_MAX];
+	unsigned long fixed_total = 0;
+	unsigned long sched_total = 0;
+	char msg[128];
+
+	set_modules(with_pm);
+	run_fixed_window(window);
+	memcpy(fixed_awake, awake_ms, sizeof(fixed_awake));
+	memset(awake_ms, 0, sizeof(awake_ms));
+
+	uint32_t longest = 0;
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		const sensor_driver_s *driver = &sensor_drivers[idx];
+		if (*driver->available && (driver->startup != NULL) &&
+			(driver->warmup_ms + driver->conversion_ms > longest))
+		{
+			longest = driver->warmup_ms + driver->conversion_ms;
+		}
+	}
+
+	mock_time_ms += 60000;
+	uint32_t cycle = run_scheduler();
+	TEST_ASSERT_EQUAL_UINT32(longest, cycle);
+
+	snprintf(msg, sizeof(msg), "%s PM sensor, fixed window %ld ms, scheduled cycle %ld ms",
+			 with_pm ? "With" : "Without", (long)window, (long)cycle);
+	TEST_MESSAGE(msg);
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		const sensor_driver_s *driver = &sensor_drivers[idx];
+		if (!*driver->available || (driver->startup == NULL))
+		{
+			continue;
+		}
+		snprintf(msg, sizeof(msg), "%-8s awake fixed %6ld ms, scheduled %6ld ms",
+				 driver->name, fixed_awake[idx], awake_ms[idx]);
+		TEST_MESSAGE(msg);
+
+		TEST_ASSERT_EQUAL_UINT32_MESSAGE(window, fixed_awake[idx], driver->name);
+		// Started just in time, all sensors finish at the end of the cycle
+		TEST_ASSERT_EQUAL_UINT32_MESSAGE(driver->warmup_ms + driver->conversion_ms, awake_ms[idx], driver->name);
+		TEST_ASSERT_EQUAL_UINT32_MESSAGE(mock_time_ms, read_at[idx], driver->name);
+		TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(fixed_awake[idx], awake_ms[idx], driver->name);
+		fixed_total += fixed_awake[idx];
+		sched_total += awake_ms[idx];
+	}
+	snprintf(msg, sizeof(msg), "Sum of awake times fixed %ld ms, scheduled %ld ms", fixed_total, sched_total);
+	TEST_MESSAGE(msg);
+	TEST_ASSERT_LESS_THAN_UINT32(fixed_total, sched_total);
+}
+
+void setUp(void)
+{
+	mock_time_ms = 100000;
+	g_task_event_type = 0;
+	g_sensor_timer.stop();
+	memset(started_at, 0, sizeof(started_at));
+	memset(awake_ms, 0, sizeof(awake_ms));
+	memset(read_at, 0, sizeof(read_at));
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief All modules, the fixed window was 30 seconds for the PM sensor
+ *
+ */
+void test_with_pm(void)
+{
+	compare_awake_time(true);
+}
+
+/**
+ * @brief No PM sensor, the fixed window was 12 seconds
+ *
+ */
+void test_without_pm(void)
+{
+	compare_awake_time(false);
+}
+
+/**
+ * @brief A cycle aligned to the RTC is longer than the sensor times,
+ *        the sensors are still started just in time
+ *
+ */
+void test_min_length(void)
+{
+	set_modules(true);
+	unsigned long cycle_begin = mock_time_ms;
+	start_sensor_schedule(60000);
+	while ((g_task_event_type & SEND_NOW) == 0)
+	{
+		TEST_ASSERT_TRUE(g_sensor_timer.running);
+		g_sensor_timer.stop();
+		mock_time_ms += g_sensor_timer.period;
+		run_sensor_schedule();
+	}
+	TEST_ASSERT_EQUAL_UINT32(60000, mock_time_ms - cycle_begin);
+	read_sensors();
+	for (uint8_t idx = 0; idx < sensor_drivers_num; idx++)
+	{
+		const sensor_driver_s *driver = &sensor_drivers[idx];
+		if (driver->startup != NULL)
+		{
+			TEST_ASSERT_EQUAL_UINT32_MESSAGE(driver->warmup_ms + driver->conversion_ms, awake_ms[idx], driver->name);
+		}
+	}
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_with_pm);
+	RUN_TEST(test_without_pm);
+	RUN_TEST(test_min_length);
+	return UNITY_END();
+}
@@ -0,0 +1,172 @@
+/**
+ * @file test_tiered_history.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of the hourly and daily history tiers
+ * @version 0.1
+ * @date 2024-03-25
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include "tiered_history.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/** Time of the first sample, start of a day */
+#define START_TIME (19800 * 86400UL)
+
+/**
+ * @brief Hourly aggregates are stored when the first sample of the next hour arrives
+ *
+ */
+void test_hour_aggregate(void)
+{
+	TieredHistory<10, true> history(1.0, 0.0);
+	uint32_t now = START_TIME;
+
+	// 4 samples per hour, 400 ... 403 ppm in the first hour
+	for (uint16_t count = 0; count < 4; count++)
+	{
+		TEST_ASSERT_FALSE(history.push(400.0 + count, now));
+		now += 900;
+	}
+	TEST_ASSERT_TRUE(history.series(TIER_HOUR).empty());
+
+	// First sample of the next hour closes the first hour
+	TEST_ASSERT_TRUE(history.push(500.0, now));
+	const TieredHistory<10, true>::Tier &hour = history.tier(TIER_HOUR);
+	TEST_ASSERT_EQUAL_UINT16(1, hour.mean.size());
+	TEST_ASSERT_FLOAT_WITHIN(0.5, 401.5, hour.mean.latest());
+	TEST_ASSERT_EQUAL_FLOAT(400.0, hour.low.latest());
+	TEST_ASSERT_EQUAL_FLOAT(403.0, hour.high.latest());
+	TEST_ASSERT_EQUAL_UINT32(START_TIME / 3600, hour.last_slot());
+	TEST_ASSERT_TRUE(hour.stored(START_TIME + 3599));
+	TEST_ASSERT_FALSE(hour.stored(START_TIME + 3600));
+
+	// Raw tier has all samples
+	TEST_ASSERT_EQUAL_UINT16(5, history.size());
+	TEST_ASSERT_EQUAL_FLOAT(500.0, history.latest());
+}
+
+/**
+ * @brief Hours without samples are skipped, the graph gets no empty entries
+ *
+ */
+void test_gap(void)
+{
+	TieredHistory<10> history(1.0, 0.0);
+
+	history.push(10.0, START_TIME);
+	history.push(20.0, START_TIME + 5 * 3600);
+	history.push(30.0, START_TIME + 6 * 3600);
+
+	const TieredHistory<10>::Tier &hour = history.tier(TIER_HOUR);
+	TEST_ASSERT_EQUAL_UINT16(2, hour.mean.size());
+	TEST_ASSERT_EQUAL_FLOAT(10.0, hour.mean[0]);
+	TEST_ASSERT_EQUAL_FLOAT(20.0, hour.mean[1]);
+	TEST_ASSERT_EQUAL_UINT32(START_TIME / 3600 + 5, hour.last_slot());
+}
+
+/**
+ * @brief Daily aggregates and graph scaling over the tiers
+ *
+ */
+void test_day_aggregate(void)
+{
+	TieredHistory<10, true> history(1.0, 0.0);
+	uint32_t now = START_TIME;
+
+	// Two days with one sample every 10 minutes, second day 100 ppm higher
+	for (uint16_t count = 0; count < 2 * 144; count++)
+	{
+		history.push(400.0 + (count / 144) * 100.0 + (count % 6), now);
+		now += 600;
+	}
+	history.push(900.0, now);
+
+	QuantizedRange<10> days = history.series(TIER_DAY);
+	float expected[2] = {402.5, 502.5};
+	uint16_t idx = 0;
+	for (float value : days)
+	{
+		TEST_ASSERT_FLOAT_WITHIN(0.5, expected[idx], value);
+		idx++;
+	}
+	TEST_ASSERT_EQUAL_UINT16(2, idx);
+
+	TEST_ASSERT_EQUAL_FLOAT(400.0, history.min_value(TIER_DAY));
+	TEST_ASSERT_EQUAL_FLOAT(505.0, history.max_value(TIER_DAY));
+	// The hourly tier holds only the last 10 hours of the second day
+	TEST_ASSERT_EQUAL_FLOAT(500.0, history.min_value(TIER_HOUR));
+	TEST_ASSERT_EQUAL_FLOAT(505.0, history.max_value(TIER_HOUR));
+	TEST_ASSERT_EQUAL_FLOAT(900.0, history.max_value(TIER_RAW));
+}
+
+/**
+ * @brief Restored aggregates plus the replayed log give the same tiers as before the reset
+ *        The log holds only the last samples, some of them are already in the restored aggregates
+ *
+ */
+void test_restore_replay(void)
+{
+	TieredHistory<20> before(1.0, 0.0);
+	int16_t codes[300];
+	uint32_t times[300];
+	uint32_t now = START_TIME;
+
+	for (uint16_t count = 0; count < 300; count++)
+	{
+		codes[count] = 100 + (count * 7) % 50;
+		times[count] = now;
+		before.push_code(codes[count], now);
+		now += 1200;
+	}
+
+	// Restore the saved aggregates as history_log.cpp does
+	TieredHistory<20> after(1.0, 0.0);
+	for (uint8_t tier = TIER_HOUR; tier <= TIER_DAY; tier++)
+	{
+		const TieredHistory<20>::Tier &saved = before.tier(tier);
+		for (uint16_t idx = 0; idx < saved.mean.size(); idx++)
+		{
+			after.tier(tier).restore(saved.last_slot(), saved.mean.code(idx), saved.low.code(idx), saved.high.code(idx));
+		}
+	}
+
+	// The log still has the last 100 samples
+	for (uint16_t count = 200; count < 300; count++)
+	{
+		after.replay_code(codes[count], times[count]);
+	}
+
+	// Next sample closes the current hour in both histories
+	TEST_ASSERT_EQUAL(before.push(200.0, now), after.push(200.0, now));
+
+	for (uint8_t tier = TIER_RAW; tier <= TIER_DAY; tier++)
+	{
+		QuantizedRange<20> expected = before.series(tier);
+		QuantizedRange<20> restored = after.series(tier);
+		QuantizedIterator<20> it = restored.begin();
+		for (float value : expected)
+		{
+			TEST_ASSERT_TRUE(it != restored.end());
+			TEST_ASSERT_EQUAL_FLOAT(value, *it);
+			++it;
+		}
+		TEST_ASSERT_TRUE(it == restored.end());
+	}
+	TEST_ASSERT_EQUAL_UINT32(before.tier(TIER_HOUR).last_slot(), after.tier(TIER_HOUR).last_slot());
+	TEST_ASSERT_EQUAL_UINT32(before.tier(TIER_DAY).last_slot(), after.tier(TIER_DAY).last_slot());
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_hour_aggregate);
+	RUN_TEST(test_gap);
+	RUN_TEST(test_day_aggregate);
+	RUN_TEST(test_restore_replay);
+	return UNITY_END();
+}
@@ -0,0 +1,330 @@
+/**
+ * @file test_voc_state.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief Host tests of saving and restoring the learned VOC algorithm state
+ *        The SGP40 is replaced by a synthetic raw signal trace, a slow daily
+ *        drift with noise and a VOC event. The VOC algorithm is the Sensirion
+ *        Gas Index Algorithm library.
+ *        A device that is reset and restores the saved state, saved before the
+ *        reset or by the last checkpoint, has to continue close to the VOC
+ *        index of a device that was not reset.
+ * @version 0.1
+ * @date 2024-03-27
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <unity.h>
+#include "../../src/sensors/RAK12047_voc.cpp"
+
+// Application parts the VOC sensor code uses
+WisCayenne g_solution_data(255);
+bool has_rak1901 = false;
+bool has_rak1906 = false;
+bool has_rak12002 = false;
+bool has_rak12037 = false;
+bool has_rak12047 = true;
+
+/** Time returned by the RTC */
+static uint32_t rtc_epoch = 1711500000;
+
+uint32_t get_rak12002_epoch(void) { return rtc_epoch; }
+void get_rak1901_values(float *values) { (void)values; }
+void get_rak1906_values(float *values) { (void)values; }
+void get_rak12037_values(float *values) { (void)values; }
+void set_voc_rak14000(uint16_t voc_value) { (void)voc_value; }
+void voc_read_wakeup(TimerHandle_t unused) { (void)unused; }
+
+/** Number of samples in the trace, 4 hours with one sample every 30 seconds */
+#define TRACE_NUM 480
+/** Sample at which the device is reset, after 3 hours */
+#define RESET_AT 360
+/** Start and end of the VOC event */
+#define EVENT_START (RESET_AT + 20)
+#define EVENT_END (RESET_AT + 60)
+/** Max difference of the VOC index between the reset and the not reset device, the state of a checkpoint is up to 10 minutes old */
+#define INDEX_TOLERANCE 5
+/**
+ * Max difference during and after a VOC event shortly after the restore
+ * The gating time of the algorithm is not part of the state. After a restore
+ * the algorithm learns with the higher initial gating threshold, a strong event
+ * in the first hour shifts the restored device a bit.
+ */
+#define EVENT_TOLERANCE 20
+
+/** VOC index after each sample */
+static int32_t index_trace[TRACE_NUM];
+/** Valid flag after each sample */
+static bool valid_trace[TRACE_NUM];
+
+/**
+ * @brief Raw signal of the synthetic trace
+ *        Baseline 30000 with a slow drift and +/-20 noise, lower during the VOC event
+ *
+ * @param sample sample number
+ * @return uint16_t raw signal
+ */
+static uint16_t trace_sraw(uint16_t sample)
+{
+	uint32_t noise = (sample * 1103515245UL + 12345UL) >> 16;
+	float sraw = 30000.0 + 300.0 * sinf(2.0 * M_PI * sample / 2880.0) + (float)(noise % 41) - 20.0;
+	if ((sample >= EVENT_START) && (sample < EVENT_END))
+	{
+		sraw -= 1500.0;
+	}
+	return (uint16_t)sraw;
+}
+
+/**
+ * @brief Start the device, RAM is cleared, the files stay
+ *
+ * @param reset_reason POWER_RESETREAS_xxx, 0 for power on
+ */
+static void power_up(uint32_t reset_reason)
+{
+	mock_reset_reason = reset_reason;
+	voc_algorithm = VOCGasIndexAlgorithm(sampling_interval);
+	voc_index = 0;
+	g_voc_valid = false;
+	discard_number = 60;
+	checkpoint_counter = 0;
+	TEST_ASSERT_TRUE(init_rak12047());
+}
+
+/**
+ * @brief Feed the samples first ... last - 1 of the trace to the sensor code
+ *
+ */
+static void run_trace(uint16_t first, uint16_t last)
+{
+	for (uint16_t sample = first; sample < last; sample++)
+	{
+		mock_sgp40_sraw = trace_sraw(sample);
+		run_rak12047_algo();
+		index_trace[sample] = voc_index;
+		valid_trace[sample] = g_voc_valid;
+	}
+}
+
+/**
+ * @brief Number of samples until the first valid VOC index
+ *
+ */
+static uint16_t samples_to_valid(uint16_t first)
+{
+	uint16_t sample = first;
+	while ((sample < TRACE_NUM) && !valid_trace[sample])
+	{
+		sample++;
+	}
+	return sample - first + 1;
+}
+
+void setUp(void)
+{
+	mock_fs_files.clear();
+	has_rak12002 = false;
+}
+
+void tearDown(void) {}
+
+/**
+ * @brief The state is saved every VOC_CHECKPOINT_SAMPLES after the first valid index
+ *
+ */
+void test_checkpoint(void)
+{
+	power_up(0);
+
+	// discard_number + 1 discarded readings, the first valid reading, then the checkpoint interval
+	run_trace(0, 61 + 1 + VOC_CHECKPOINT_SAMPLES - 1);
+	TEST_ASSERT_FALSE(InternalFS.exists(voc_state_name));
+	run_trace(61 + 1 + VOC_CHECKPOINT_SAMPLES - 1, 61 + 1 + VOC_CHECKPOINT_SAMPLES);
+	TEST_ASSERT_TRUE(InternalFS.exists(voc_state_name));
+
+	voc_state_s saved;
+	TEST_ASSERT_EQUAL(sizeof(voc_state_s), mock_fs_files[voc_state_name].size());
+	memcpy(&saved, mock_fs_files[voc_state_name].data(), sizeof(voc_state_s));
+	float state0;
+	float state1;
+	voc_algorithm.get_states(state0, state1);
+	TEST_ASSERT_EQUAL_HEX32(VOC_STATE_MARK, saved.mark);
+	TEST_ASSERT_EQUAL_FLOAT(state0, saved.state0);
+	TEST_ASSERT_EQUAL_FLOAT(state1, saved.state1);
+}
+
+/**
+ * @brief No state is saved before the algorithm delivers valid values
+ *
+ */
+void test_no_save_before_valid(void)
+{
+	power_up(0);
+	run_trace(0, 10);
+	save_rak12047_state();
+	TEST_ASSERT_FALSE(InternalFS.exists(voc_state_name));
+}
+
+/**
+ * @brief Compare the VOC index after a restore with the device without reset
+ *
+ * @param reference VOC index of the device without reset
+ * @param restored_at sample at which the saved state was taken
+ */
+static void check_continuity(const int32_t *reference, uint16_t restored_at)
+{
+	char message[64];
+	snprintf(message, sizeof(message), "state of sample %d", restored_at);
+
+	TEST_ASSERT_EQUAL_UINT16_MESSAGE(VOC_RESTORE_DISCARD + 2, samples_to_valid(RESET_AT), message);
+
+	// Give the averaging of read_rak12047() two samples to settle
+	for (uint16_t sample = RESET_AT + VOC_RESTORE_DISCARD + 4; sample < EVENT_START; sample++)
+	{
+		TEST_ASSERT_INT32_WITHIN_MESSAGE(INDEX_TOLERANCE, reference[sample], index_trace[sample], message);
+	}
+
+	// The event is seen by both devices
+	for (uint16_t sample = EVENT_START + 10; sample < EVENT_END; sample++)
+	{
+		TEST_ASSERT_GREATER_THAN_MESSAGE(400, reference[sample], message);
+		TEST_ASSERT_GREATER_THAN_MESSAGE(400, index_trace[sample], message);
+		TEST_ASSERT_INT32_WITHIN_MESSAGE(EVENT_TOLERANCE, reference[sample], index_trace[sample], message);
+	}
+	for (uint16_t sample = EVENT_END; sample < TRACE_NUM; sample++)
+	{
+		TEST_ASSERT_INT32_WITHIN_MESSAGE(EVENT_TOLERANCE, reference[sample], index_trace[sample], message);
+	}
+}
+
+/**
+ * @brief After a software reset the restored state continues the VOC index
+ *        The state is saved before the reset, as main.cpp does
+ *
+ */
+void test_restore_continuity(void)
+{
+	static int32_t reference[TRACE_NUM];
+
+	// Device without reset
+	power_up(0);
+	run_trace(0, TRACE_NUM);
+	memcpy(reference, index_trace, sizeof(reference));
+
+	// Same trace, software reset after 3 hours
+	mock_fs_files.clear();
+	power_up(0);
+	run_trace(0, RESET_AT);
+	save_rak12047_state();
+	power_up(POWER_RESETREAS_SREQ_Msk);
+
+	// The state is used only once
+	TEST_ASSERT_FALSE(InternalFS.exists(voc_state_name));
+	TEST_ASSERT_EQUAL_UINT16(VOC_RESTORE_DISCARD, discard_number);
+
+	run_trace(RESET_AT, TRACE_NUM);
+	check_continuity(reference, RESET_AT);
+}
+
+/**
+ * @brief After a watchdog reset the state of the last checkpoint is used
+ *        It is up to VOC_CHECKPOINT_SAMPLES old
+ *
+ */
+void test_restore_checkpoint(void)
+{
+	static int32_t reference[TRACE_NUM];
+
+	power_up(0);
+	run_trace(0, TRACE_NUM);
+	memcpy(reference, index_trace, sizeof(reference));
+
+	// Reset at every sample of one checkpoint interval, nothing is saved before the reset
+	for (uint16_t last_sample = RESET_AT - VOC_CHECKPOINT_SAMPLES; last_sample < RESET_AT; last_sample++)
+	{
+		mock_fs_files.clear();
+		power_up(0);
+		run_trace(0, last_sample);
+		TEST_ASSERT_TRUE(InternalFS.exists(voc_state_name));
+		// The samples between the checkpoint and the reset are lost
+		power_up(POWER_RESETREAS_DOG_Msk);
+		TEST_ASSERT_EQUAL_UINT16(VOC_RESTORE_DISCARD, discard_number);
+		run_trace(RESET_AT, TRACE_NUM);
+		check_continuity(reference, last_sample);
+	}
+}
+
+/**
+ * @brief After a power loss without RTC the age of the state is unknown
+ *        The state is not used and removed, the algorithm learns again
+ *
+ */
+void test_power_on_reset(void)
+{
+	power_up(0);
+	run_trace(0, RESET_AT);
+	save_rak12047_state();
+	TEST_ASSERT_TRUE(InternalFS.exists(voc_state_name));
+
+	power_up(0);
+	TEST_ASSERT_FALSE(InternalFS.exists(voc_state_name));
+	TEST_ASSERT_EQUAL_UINT16(60, discard_number);
+
+	run_trace(RESET_AT, TRACE_NUM);
+	TEST_ASSERT_EQUAL_UINT16(60 + 2, samples_to_valid(RESET_AT));
+}
+
+/**
+ * @brief With RTC the state is used if it is not older than VOC_STATE_MAX_AGE
+ *
+ */
+void test_rtc_age(void)
+{
+	has_rak12002 = true;
+	power_up(0);
+	run_trace(0, RESET_AT);
+
+	// 5 minutes after saving, even after a power loss
+	save_rak12047_state();
+	rtc_epoch += 300;
+	power_up(0);
+	TEST_ASSERT_EQUAL_UINT16(VOC_RESTORE_DISCARD, discard_number);
+	TEST_ASSERT_FALSE(InternalFS.exists(voc_state_name));
+
+	// Too old
+	run_trace(RESET_AT, RESET_AT + 10);
+	save_rak12047_state();
+	rtc_epoch += VOC_STATE_MAX_AGE + 1;
+	power_up(POWER_RESETREAS_SREQ_Msk);
+	TEST_ASSERT_EQUAL_UINT16(60, discard_number);
+	TEST_ASSERT_FALSE(InternalFS.exists(voc_state_name));
+}
+
+/**
+ * @brief A truncated state file is rejected and removed
+ *
+ */
+void test_invalid_state(void)
+{
+	power_up(0);
+	run_trace(0, RESET_AT);
+	save_rak12047_state();
+	mock_fs_files[voc_state_name].resize(sizeof(voc_state_s) - 1);
+
+	power_up(POWER_RESETREAS_SREQ_Msk);
+	TEST_ASSERT_EQUAL_UINT16(60, discard_number);
+	TEST_ASSERT_FALSE(InternalFS.exists(voc_state_name));
+}
+
+int main(int argc, char **argv)
+{
+	UNITY_BEGIN();
+	RUN_TEST(test_checkpoint);
+	RUN_TEST(test_no_save_before_valid);
+	RUN_TEST(test_restore_continuity);
+	RUN_TEST(test_restore_checkpoint);
+	RUN_TEST(test_power_on_reset);
+	RUN_TEST(test_rtc_age);
+	RUN_TEST(test_invalid_state);
+	return UNITY_END();
+}